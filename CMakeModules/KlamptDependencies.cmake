@@ -160,6 +160,11 @@ ELSE(WIN32)
     MESSAGE("GLEW library not found, camera simulation will be slow")
     SET(KLAMPT_DEFINITIONS ${KLAMPT_DEFINITIONS} -DHAVE_GLEW=0)
   ENDIF(GLEW_FOUND)
+
+  # POSIX shared memory, used by SharedMemoryPipe
+  IF(NOT APPLE)
+    SET(KLAMPT_LIBRARIES ${KLAMPT_LIBRARIES} rt)
+  ENDIF(NOT APPLE)
 ENDIF(WIN32)
 
 SET(ROSDEPS tf rosconsole roscpp roscpp_serialization rostime )
@@ -0,0 +1,422 @@
+#include "MessagePipe.h"
+#include "Modeling/Atomic.h"
+#include <KrisLibrary/utils/threadutils.h>
+#include <KrisLibrary/Timer.h>
+#include <KrisLibrary/math/math.h>
+#include <KrisLibrary/math/infnan.h>
+#include <string.h>
+#include <limits.h>
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#endif //WIN32
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif //__linux__
+
+bool MessagePipe::WaitForMessage(double timeout)
+{
+  Timer timer;
+  while(UnreadCount() == 0) {
+    if(timer.ElapsedTime() >= timeout) return false;
+    ThreadSleep(0.001);
+  }
+  return true;
+}
+
+
+SocketMessagePipe::SocketMessagePipe(const char* addr,bool server)
+  :worker(new SocketPipeWorker(addr,server))
+{}
+
+SocketMessagePipe::SocketMessagePipe(const char* addr,bool server,double timeout)
+  :worker(new SocketPipeWorker(addr,server,timeout))
+{}
+
+bool SocketMessagePipe::Start() { return worker->Start(); }
+void SocketMessagePipe::Stop() { worker->Stop(); }
+bool SocketMessagePipe::IsOpen() { return worker->initialized; }
+bool SocketMessagePipe::WriteReady() { return worker->transport->WriteReady(); }
+bool SocketMessagePipe::Send(const string& msg) { worker->Send(msg); return true; }
+int SocketMessagePipe::UnreadCount() { return worker->UnreadCount(); }
+string SocketMessagePipe::Next() { return worker->Next(); }
+string SocketMessagePipe::Newest() { return worker->Newest(); }
+
+
+
+//must be a power of 2
+const static int kShmRingSize = 1<<23;
+const static int kShmMagic = 0x4b53484d;
+//set in the length of a fragment that is not the last of its message
+const static int kShmMoreFragments = 1<<30;
+
+//Messages are written as fragments, each an int length followed by the
+//data.  Only messages larger than the ring are split into several.
+//Positions are byte counts mod 2^32, so that head-tail is the number of
+//unread bytes even after wrapping around
+struct SharedMemoryRing
+{
+  volatile int head;        //bytes written, only changed by the writer.  Used as the reader's futex word
+  volatile int tail;        //bytes read, only changed by the reader.  Used as the writer's futex word
+  volatile int numWritten;  //complete messages written
+  volatile int numRead;     //messages read
+  volatile int sequence;    //odd while the writer updates head and numWritten
+  volatile int writerWaiting;  //set while the writer waits for room
+  //a client that attaches increments generation, after setting where the
+  //server should resume reading the client to server ring
+  volatile int generation;
+  volatile int resetHead,resetCount;
+  char data[kShmRingSize];
+};
+
+struct SharedMemoryHeader
+{
+  volatile int magic;       //set by the server once the rings are ready
+  volatile int serverAttached,clientAttached;
+  volatile int serverPid,clientPid;  //used to detect an end that has died
+  SharedMemoryRing rings[2];  //server to client, then client to server
+};
+
+static void RingWrite(SharedMemoryRing* ring,unsigned int pos,const char* src,int n)
+{
+  unsigned int start = pos & (kShmRingSize-1);
+  int n1 = (int)Min((unsigned int)n,kShmRingSize-start);
+  memcpy(ring->data+start,src,n1);
+  if(n1 < n) memcpy(ring->data,src+n1,n-n1);
+}
+
+static void RingRead(SharedMemoryRing* ring,unsigned int pos,char* dest,int n)
+{
+  unsigned int start = pos & (kShmRingSize-1);
+  int n1 = (int)Min((unsigned int)n,kShmRingSize-start);
+  memcpy(dest,ring->data+start,n1);
+  if(n1 < n) memcpy(dest+n1,ring->data,n-n1);
+}
+
+//bytes that may still be written to the ring
+static unsigned int RingRoom(SharedMemoryRing* ring)
+{
+  return kShmRingSize - ((unsigned int)ring->head - (unsigned int)AtomicLoad(&ring->tail));
+}
+
+static void FutexWake(volatile int* addr)
+{
+#ifdef __linux__
+  syscall(SYS_futex,addr,FUTEX_WAKE,INT_MAX,NULL,NULL,0);
+#endif //__linux__
+}
+
+//waits up to timeout seconds while *addr == value, possibly less
+static void FutexWait(volatile int* addr,int value,double timeout)
+{
+#ifdef __linux__
+  struct timespec ts;
+  ts.tv_sec = (time_t)timeout;
+  ts.tv_nsec = (long)((timeout - ts.tv_sec)*1e9);
+  //returns immediately if *addr is no longer value
+  syscall(SYS_futex,addr,FUTEX_WAIT,value,&ts,NULL,0);
+#else
+  if(*addr == value) ThreadSleep(Min(timeout,0.001));
+#endif //__linux__
+}
+
+//writes a fragment at the head of the ring, which must have room for it
+static void RingWriteFragment(SharedMemoryRing* ring,const char* src,int n,bool last)
+{
+  unsigned int head = (unsigned int)ring->head;
+  int len = (last ? n : (n | kShmMoreFragments));
+  RingWrite(ring,head,(const char*)&len,sizeof(int));
+  RingWrite(ring,head+sizeof(int),src,n);
+  AtomicAdd(&ring->sequence,1);
+  AtomicExchange(&ring->head,(int)(head+sizeof(int)+n));
+  if(last) AtomicExchange(&ring->numWritten,ring->numWritten+1);
+  AtomicAdd(&ring->sequence,1);
+  FutexWake(&ring->head);
+}
+
+SharedMemoryPipe::SharedMemoryPipe(const char* _name,bool _server,double _timeout)
+  :name(_name),server(_server),timeout(_timeout),header(NULL),in(NULL),out(NULL),generation(0)
+{
+  if(name.empty() || name[0] != '/') name = "/"+name;
+}
+
+SharedMemoryPipe::~SharedMemoryPipe()
+{
+  Stop();
+}
+
+bool SharedMemoryPipe::Start()
+{
+#ifdef WIN32
+  fprintf(stderr,"SharedMemoryPipe: shared memory pipes are not supported on Windows\n");
+  return false;
+#else
+  if(header) return true;
+  int fd;
+  if(server) {
+    shm_unlink(name.c_str());
+    fd = shm_open(name.c_str(),O_CREAT|O_RDWR,0600);
+    if(fd < 0) {
+      perror("SharedMemoryPipe: shm_open");
+      return false;
+    }
+    if(ftruncate(fd,sizeof(SharedMemoryHeader)) != 0) {
+      perror("SharedMemoryPipe: ftruncate");
+      close(fd);
+      shm_unlink(name.c_str());
+      return false;
+    }
+  }
+  else {
+    //wait for the server to create the segment
+    Timer timer;
+    while((fd = shm_open(name.c_str(),O_RDWR,0600)) < 0) {
+      if(timer.ElapsedTime() >= timeout) {
+        fprintf(stderr,"SharedMemoryPipe: could not open %s\n",name.c_str());
+        return false;
+      }
+      ThreadSleep(0.01);
+    }
+  }
+  void* ptr = mmap(NULL,sizeof(SharedMemoryHeader),PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+  close(fd);
+  if(ptr == MAP_FAILED) {
+    perror("SharedMemoryPipe: mmap");
+    if(server) shm_unlink(name.c_str());
+    return false;
+  }
+  header = reinterpret_cast<SharedMemoryHeader*>(ptr);
+  partial.resize(0);
+  if(server) {
+    //a new segment is zero-filled, so only the magic number is needed
+    in = &header->rings[1];
+    out = &header->rings[0];
+    generation = 0;
+    AtomicExchange(&header->serverPid,(int)getpid());
+    AtomicExchange(&header->serverAttached,1);
+    AtomicExchange(&header->magic,kShmMagic);
+  }
+  else {
+    Timer timer;
+    while(AtomicLoad(&header->magic) != kShmMagic) {
+      if(timer.ElapsedTime() >= timeout) {
+        fprintf(stderr,"SharedMemoryPipe: %s was not initialized by a server\n",name.c_str());
+        munmap(header,sizeof(SharedMemoryHeader));
+        header = NULL;
+        return false;
+      }
+      ThreadSleep(0.01);
+    }
+    in = &header->rings[0];
+    out = &header->rings[1];
+    //skip anything the server wrote before we attached.  head and
+    //numWritten must be read at the same point in the message stream, so
+    //retry while a Send is in progress
+    int sequence,head,numWritten;
+    do {
+      sequence = AtomicLoad(&in->sequence);
+      head = AtomicLoad(&in->head);
+      numWritten = AtomicLoad(&in->numWritten);
+    } while((sequence & 1) || AtomicLoad(&in->sequence) != sequence);
+    in->tail = head;
+    in->numRead = numWritten;
+    //an earlier client may have left messages, or part of one, in the
+    //client to server ring.  Only this end writes to it, so its head is
+    //stable, and the server skips to it when it sees the new generation
+    AtomicExchange(&out->resetHead,out->head);
+    AtomicExchange(&out->resetCount,out->numWritten);
+    AtomicAdd(&out->generation,1);
+    AtomicExchange(&header->clientPid,(int)getpid());
+    AtomicExchange(&header->clientAttached,1);
+  }
+  return true;
+#endif //WIN32
+}
+
+void SharedMemoryPipe::Stop()
+{
+#ifndef WIN32
+  if(!header) return;
+  AtomicExchange(server ? &header->serverAttached : &header->clientAttached,0);
+  //wake up a reader or writer on the other end so that it notices
+  FutexWake(&out->head);
+  FutexWake(&in->tail);
+  munmap(header,sizeof(SharedMemoryHeader));
+  if(server) shm_unlink(name.c_str());
+  header = NULL;
+  in = out = NULL;
+  partial.resize(0);
+#endif //WIN32
+}
+
+bool SharedMemoryPipe::IsOpen()
+{
+  if(!header) return false;
+  //a server stays open while it waits for clients
+  if(server) return true;
+  return PeerAlive();
+}
+
+bool SharedMemoryPipe::WriteReady()
+{
+  return PeerAlive();
+}
+
+bool SharedMemoryPipe::PeerAlive()
+{
+#ifdef WIN32
+  return false;
+#else
+  if(!header) return false;
+  if(AtomicLoad(server ? &header->clientAttached : &header->serverAttached) == 0) return false;
+  //the other end may have exited without calling Stop.  Signal 0 only
+  //checks that the process exists.
+  int pid = AtomicLoad(server ? &header->clientPid : &header->serverPid);
+  return pid <= 0 || kill((pid_t)pid,0) == 0 || errno == EPERM;
+#endif //WIN32
+}
+
+bool SharedMemoryPipe::Send(const string& msg)
+{
+  if(!header) return false;
+  int len = (int)msg.length();
+  if(sizeof(int)+(unsigned int)len <= (unsigned int)kShmRingSize) {
+    if(sizeof(int)+(unsigned int)len > RingRoom(out)) {
+      fprintf(stderr,"SharedMemoryPipe: ring buffer full, dropping a %d byte message\n",len);
+      return false;
+    }
+    RingWriteFragment(out,msg.data(),len,true);
+    return true;
+  }
+  //the message is larger than the ring, so it is sent in fragments as the
+  //reader makes room.  Give up if the reader stops or is replaced, since
+  //a new reader would see only the end of the message.
+  int peerPid = AtomicLoad(server ? &header->clientPid : &header->serverPid);
+  int sent = 0;
+  while(sent < len) {
+    if(!PeerAlive() || AtomicLoad(server ? &header->clientPid : &header->serverPid) != peerPid) {
+      fprintf(stderr,"SharedMemoryPipe: reader stopped, dropping the rest of a %d byte message\n",len);
+      return false;
+    }
+    //wait for room for a reasonably large fragment
+    unsigned int room = RingRoom(out);
+    unsigned int wanted = (unsigned int)Min(len-sent+(int)sizeof(int),kShmRingSize/4);
+    if(room < wanted) {
+      AtomicExchange(&out->writerWaiting,1);
+      int tail = AtomicLoad(&out->tail);
+      if(RingRoom(out) < wanted) FutexWait(&out->tail,tail,0.01);
+      AtomicExchange(&out->writerWaiting,0);
+      continue;
+    }
+    int n = (int)Min((unsigned int)(len-sent),room-(unsigned int)sizeof(int));
+    RingWriteFragment(out,msg.data()+sent,n,(sent+n == len));
+    sent += n;
+  }
+  return true;
+}
+
+void SharedMemoryPipe::AdvanceTail(unsigned int tail)
+{
+  AtomicExchange(&in->tail,(int)tail);
+  //the writer may be waiting for room for a large message
+  if(AtomicLoad(&in->writerWaiting)) FutexWake(&in->tail);
+}
+
+void SharedMemoryPipe::ReadFragments()
+{
+  if(server) {
+    int g = AtomicLoad(&in->generation);
+    if(g != generation) {
+      //a new client attached, see Start()
+      generation = g;
+      in->numRead = AtomicLoad(&in->resetCount);
+      AdvanceTail((unsigned int)AtomicLoad(&in->resetHead));
+      partial.resize(0);
+    }
+  }
+  while(true) {
+    unsigned int tail = (unsigned int)in->tail;
+    if(tail == (unsigned int)AtomicLoad(&in->head)) return;
+    int len;
+    RingRead(in,tail,(char*)&len,sizeof(int));
+    if(!(len & kShmMoreFragments)) return;
+    len &= ~kShmMoreFragments;
+    size_t start = partial.size();
+    partial.resize(start+len);
+    RingRead(in,tail+sizeof(int),&partial[start],len);
+    AdvanceTail(tail+sizeof(int)+len);
+  }
+}
+
+int SharedMemoryPipe::UnreadCount()
+{
+  if(!header) return 0;
+  ReadFragments();
+  return AtomicLoad(&in->numWritten) - in->numRead;
+}
+
+bool SharedMemoryPipe::Read(string& msg)
+{
+  if(UnreadCount() <= 0) return false;
+  //ReadFragments has stopped at the last fragment of the message
+  unsigned int tail = (unsigned int)in->tail;
+  int len;
+  RingRead(in,tail,(char*)&len,sizeof(int));
+  msg.swap(partial);
+  partial.resize(0);
+  size_t start = msg.size();
+  msg.resize(start+len);
+  if(len > 0) RingRead(in,tail+sizeof(int),&msg[start],len);
+  AdvanceTail(tail+sizeof(int)+len);
+  in->numRead++;
+  return true;
+}
+
+string SharedMemoryPipe::Next()
+{
+  string msg;
+  Read(msg);
+  return msg;
+}
+
+string SharedMemoryPipe::Newest()
+{
+  string msg;
+  while(Read(msg)) {}
+  return msg;
+}
+
+bool SharedMemoryPipe::WaitForMessage(double timeout)
+{
+  if(!header) return false;
+  Timer timer;
+  while(true) {
+    //head changes with every fragment, so that the fragments of a large
+    //message are read as they arrive
+    int head = AtomicLoad(&in->head);
+    if(UnreadCount() > 0) return true;
+    if(!server && !PeerAlive()) return false;
+    double remaining = timeout - timer.ElapsedTime();
+    if(remaining <= 0) return false;
+    if(IsInf(remaining)) remaining = 1.0;
+    FutexWait(&in->head,head,remaining);
+  }
+}
+
+
+
+MessagePipe* MakeMessagePipe(const string& addr,bool server,double timeout)
+{
+  const static size_t prefixLen = strlen(SHARED_MEMORY_PIPE_PREFIX);
+  if(addr.compare(0,prefixLen,SHARED_MEMORY_PIPE_PREFIX) == 0)
+    return new SharedMemoryPipe(addr.c_str()+prefixLen,server,timeout);
+  if(server)
+    return new SocketMessagePipe(addr.c_str(),true);
+  return new SocketMessagePipe(addr.c_str(),false,timeout);
+}
@@ -0,0 +1,118 @@
+#ifndef CONTROL_MESSAGE_PIPE_H
+#define CONTROL_MESSAGE_PIPE_H
+
+#include <KrisLibrary/utils/AsyncIO.h>
+#include <KrisLibrary/utils/SmartPointer.h>
+#include <string>
+using namespace std;
+
+/** @ingroup Control
+ * @brief A two-way connection that passes whole string messages, used by
+ * SerialController and SerialControlledRobot.
+ *
+ * Use MakeMessagePipe to create the pipe for an address.
+ */
+class MessagePipe
+{
+ public:
+  virtual ~MessagePipe() {}
+  virtual bool Start()=0;
+  virtual void Stop()=0;
+  ///Returns true between a successful Start() and Stop()
+  virtual bool IsOpen()=0;
+  ///Returns true if the other end is ready to receive messages
+  virtual bool WriteReady()=0;
+  virtual bool Send(const string& msg)=0;
+  virtual int UnreadCount()=0;
+  ///Pops the oldest unread message
+  virtual string Next()=0;
+  ///Pops all unread messages and returns the newest one
+  virtual string Newest()=0;
+  ///Waits up to timeout seconds for a message to arrive.  Returns true if
+  ///there is an unread message.
+  virtual bool WaitForMessage(double timeout);
+};
+
+/** @ingroup Control
+ * @brief A MessagePipe over a TCP socket, implemented by SocketPipeWorker.
+ */
+class SocketMessagePipe : public MessagePipe
+{
+ public:
+  SocketMessagePipe(const char* addr,bool server);
+  SocketMessagePipe(const char* addr,bool server,double timeout);
+  virtual bool Start();
+  virtual void Stop();
+  virtual bool IsOpen();
+  virtual bool WriteReady();
+  virtual bool Send(const string& msg);
+  virtual int UnreadCount();
+  virtual string Next();
+  virtual string Newest();
+
+  SmartPointer<SocketPipeWorker> worker;
+};
+
+struct SharedMemoryHeader;
+struct SharedMemoryRing;
+
+/** @ingroup Control
+ * @brief A MessagePipe between two processes on the same machine, through
+ * a POSIX shared memory segment holding one ring buffer per direction.
+ *
+ * The server creates the segment (and removes it in Stop()), and the client
+ * attaches to it, retrying until the timeout passes.  Each ring has a single
+ * writer and a single reader, and is lock-free.  On Linux, WaitForMessage
+ * blocks on a futex that Send wakes, so readers do not need to poll.  Send
+ * fails, dropping the message, if the ring is full.  Messages larger than
+ * a ring are sent in fragments, and Send waits for the reader to make room
+ * for each one.
+ *
+ * A client skips anything the server wrote before it attached, and the
+ * server skips anything that an earlier client left unread.
+ *
+ * Each end records its process ID in the segment.  A client's IsOpen, and
+ * WriteReady on either end, return false once the other end has called
+ * Stop() or its process has exited.
+ *
+ * Not available on Windows.
+ */
+class SharedMemoryPipe : public MessagePipe
+{
+ public:
+  SharedMemoryPipe(const char* name,bool server,double timeout=0);
+  virtual ~SharedMemoryPipe();
+  virtual bool Start();
+  virtual void Stop();
+  virtual bool IsOpen();
+  virtual bool WriteReady();
+  virtual bool Send(const string& msg);
+  virtual int UnreadCount();
+  virtual string Next();
+  virtual string Newest();
+  virtual bool WaitForMessage(double timeout);
+  bool Read(string& msg);
+  ///Returns true if the other end is attached and its process is running
+  bool PeerAlive();
+  ///Moves the leading fragments of an incomplete message into partial
+  void ReadFragments();
+  void AdvanceTail(unsigned int tail);
+
+  string name;
+  bool server;
+  double timeout;
+  SharedMemoryHeader* header;
+  SharedMemoryRing *in,*out;
+  int generation;   ///<server only: the last client generation seen
+  string partial;   ///<the fragments read so far of the next message
+};
+
+///Prefix of the addresses handled by SharedMemoryPipe
+#define SHARED_MEMORY_PIPE_PREFIX "shm://"
+
+/** @brief Creates a SharedMemoryPipe if addr is of the form shm://name, and
+ * a SocketMessagePipe otherwise.  The timeout is only used by clients.
+ */
+MessagePipe* MakeMessagePipe(const string& addr,bool server,double timeout);
+
+#endif
@@ -7,6 +7,10 @@
 #include "Simulation/ControlledSimulator.h"
 #include "Simulation/ODESimulator.h"
 #include "Simulation/WorldSimulation.h"
+#include "Modeling/WorldBVH.h"
+#include "Modeling/RandomStream.h"
+#include <string.h>
+#include "Modeling/ParallelFor.h"
 #include <KrisLibrary/utils/PropertyMap.h>
 #include <KrisLibrary/math/random.h>
 #if HAVE_GLEW
@@ -38,27 +42,25 @@ static inline double round(double val) { return floor(val + 0.5); }
 //defined in ODESimulator.cpp
 bool HasContact(dBodyID a);
 
-//defined in ODESimulator.cpp
-///Will produce bogus o1 and o2 vectors
-void GetContacts(dBodyID a,vector<ODEContactList>& contacts);
-
 //emulates a process that discretizes a continuous value into a digital one
 //with resolution resolution, and variance variance
-Real Discretize(Real value,Real resolution,Real variance)
+//noise is drawn from noise if it is not NULL, otherwise from the global
+//random number generator
+Real Discretize(Real value,Real resolution,Real variance,RandomStream* noise)
 {
   if(variance>0)
-    value += RandGaussian()*Sqrt(variance);
+    value += (noise ? noise->RandGaussian() : RandGaussian())*Sqrt(variance);
   if(resolution>0)
     value = round(value/resolution)*resolution;
   return value;
 }
 
-Vector3 Discretize(const Vector3& value,const Vector3& resolution,const Vector3& variance)
+Vector3 Discretize(const Vector3& value,const Vector3& resolution,const Vector3& variance,RandomStream* noise)
 {
   Vector3 res;
-  res.x = Discretize(value.x,resolution.x,variance.x);
-  res.y = Discretize(value.y,resolution.y,variance.y);
-  res.z = Discretize(value.z,resolution.z,variance.z);
+  res.x = Discretize(value.x,resolution.x,variance.x,noise);
+  res.y = Discretize(value.y,resolution.y,variance.y,noise);
+  res.z = Discretize(value.z,resolution.z,variance.z,noise);
   return res;
 }
 
@@ -106,10 +108,43 @@ bool ReadFile(File& f,vector<T>& v)
 }
 
 
+int SensorMeasurementView::NumElements() const
+{
+  int n=1;
+  for(size_t i=0;i<shape.size();i++) n *= shape[i];
+  return n;
+}
+
+int SensorMeasurementView::ElementSize() const
+{
+  switch(type) {
+  case Float64: return sizeof(double);
+  case Float32: return sizeof(float);
+  default: return 1;
+  }
+}
+
 SensorBase::SensorBase()
-  :name("Unnamed sensor"),rate(0)
+  :name("Unnamed sensor"),rate(0),noise(NULL)
 {}
 
+double SensorBase::NoiseGaussian()
+{
+  if(noise) return noise->RandGaussian();
+  return RandGaussian();
+}
+
+void SensorBase::GetMeasurementViews(vector<SensorMeasurementView>& views)
+{
+  GetMeasurements(viewBuffer);
+  views.resize(1);
+  views[0].name = "measurements";
+  views[0].type = SensorMeasurementView::Float64;
+  views[0].data = (viewBuffer.empty() ? NULL : &viewBuffer[0]);
+  views[0].shape.resize(1);
+  views[0].shape[0] = (int)viewBuffer.size();
+}
+
 bool SensorBase::ReadState(File& f)
 {
   vector<double> values;
@@ -174,7 +209,7 @@ void JointPositionSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
   if(!qvariance.empty()) {
     //cout<<"q: "<<qvariance<<endl;
     for(int i=0;i<q.n;i++)
-      q(i) += RandGaussian()*Sqrt(qvariance(i));
+      q(i) += NoiseGaussian()*Sqrt(qvariance(i));
   }
   if(!qresolution.empty()) {
     //cout<<"q: "<<qresolution<<endl;
@@ -199,7 +234,7 @@ void JointPositionSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulati
   if(!qvariance.empty()) {
     //cout<<"q: "<<qvariance<<endl;
     for(int i=0;i<q.n;i++)
-      q(i) += RandGaussian()*Sqrt(qvariance(i));
+      q(i) += NoiseGaussian()*Sqrt(qvariance(i));
   }
   if(!qresolution.empty()) {
     //cout<<"q: "<<qresolution<<endl;
@@ -308,7 +343,7 @@ void JointVelocitySensor::SimulateKinematic(Robot& robot,RobotWorld& world)
   if(!dqvariance.empty()) {
     //cout<<"dq: "<<qvariance<<endl;
     for(int i=0;i<dq.n;i++)
-      dq(i) += RandGaussian()*Sqrt(dqvariance(i));
+      dq(i) += NoiseGaussian()*Sqrt(dqvariance(i));
   }
   if(!dqresolution.empty()) {
     //cout<<"dq: "<<dqresolution<<endl;
@@ -333,7 +368,7 @@ void JointVelocitySensor::Simulate(ControlledRobotSimulator* robot,WorldSimulati
   if(!dqvariance.empty()) {
     //cout<<"dq: "<<qvariance<<endl;
     for(int i=0;i<dq.n;i++)
-      dq(i) += RandGaussian()*Sqrt(dqvariance(i));
+      dq(i) += NoiseGaussian()*Sqrt(dqvariance(i));
   }
   if(!dqresolution.empty()) {
     //cout<<"dq: "<<dqresolution<<endl;
@@ -439,7 +474,7 @@ void DriverTorqueSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
   t.resize(robot.drivers.size(),0.0);
   if(!tvariance.empty()) {
     for(int i=0;i<t.n;i++)
-      t(i) += RandGaussian()*Sqrt(tvariance(i));
+      t(i) += NoiseGaussian()*Sqrt(tvariance(i));
   }
   if(!tresolution.empty()) {
     for(int i=0;i<t.n;i++) {
@@ -467,7 +502,7 @@ void DriverTorqueSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulatio
   //ODE computed torques
   if(!tvariance.empty()) {
     for(int i=0;i<t.n;i++)
-      t(i) += RandGaussian()*Sqrt(tvariance(i));
+      t(i) += NoiseGaussian()*Sqrt(tvariance(i));
   }
   if(!tresolution.empty()) {
     for(int i=0;i<t.n;i++) {
@@ -596,7 +631,7 @@ void ContactSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* si
   RigidTransform TsensorWorld  = Tlink*Tsensor;
   //look through contacts
   vector<ODEContactList> contacts;
-  GetContacts(body,contacts);
+  sim->odesim.GetBodyContacts(body,contacts);
   Vector3 xlocal,flocal;
   for(size_t i=0;i<contacts.size();i++) {
     for(size_t j=0;j<contacts[i].points.size();j++) {
@@ -621,9 +656,9 @@ void ContactSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* si
 
   if(Abs(force.z) > fSensitivity)
     contact = true;
-  force.x = Discretize(force.x,fResolution.x,fVariance.x);
-  force.y = Discretize(force.y,fResolution.y,fVariance.y);
-  force.z = Discretize(force.z,fResolution.z,fVariance.z);
+  force.x = Discretize(force.x,fResolution.x,fVariance.x,noise);
+  force.y = Discretize(force.y,fResolution.y,fVariance.y,noise);
+  force.z = Discretize(force.z,fResolution.z,fVariance.z,noise);
   if(Abs(force.x) > fSaturation.x) 
     force.x = Sign(force.x)*fSaturation.x;
   if(Abs(force.y) > fSaturation.y) 
@@ -803,8 +838,8 @@ void ForceTorqueSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation
   f.inplaceNegative();
   t.inplaceNegative();
 
-  f = Discretize(f,Vector3(0.0),fVariance);
-  t = Discretize(t,Vector3(0.0),tVariance);
+  f = Discretize(f,Vector3(0.0),fVariance,noise);
+  t = Discretize(t,Vector3(0.0),tVariance,noise);
   for(int i=0;i<3;i++)
     if(!hasForce[i]) f[i] = 0;
   for(int i=0;i<3;i++)
@@ -932,14 +967,14 @@ void Accelerometer::SimulateKinematic(Robot& robot,RobotWorld& world)
   last_v = vp;
 
   accel += Vector3(0,0,-9.8);
-  accel.x += RandGaussian()*Sqrt(accelVariance.x);
-  accel.y += RandGaussian()*Sqrt(accelVariance.y);
-  accel.z += RandGaussian()*Sqrt(accelVariance.z);
+  accel.x += NoiseGaussian()*Sqrt(accelVariance.x);
+  accel.y += NoiseGaussian()*Sqrt(accelVariance.y);
+  accel.z += NoiseGaussian()*Sqrt(accelVariance.z);
 
   Vector3 accelw = accel;
   T.R.mulTranspose(accelw,accel);
 
-  accel = Discretize(accel,Vector3(Zero),accelVariance);
+  accel = Discretize(accel,Vector3(Zero),accelVariance,noise);
   for(int i=0;i<3;i++)
     if(!hasAxis[i]) accel[i] = 0;
 }
@@ -961,14 +996,14 @@ void Accelerometer::Simulate(ControlledRobotSimulator* robot,WorldSimulation* si
   last_v = vp;
 
   accel += Vector3(0,0,-9.8);
-  accel.x += RandGaussian()*Sqrt(accelVariance.x);
-  accel.y += RandGaussian()*Sqrt(accelVariance.y);
-  accel.z += RandGaussian()*Sqrt(accelVariance.z);
+  accel.x += NoiseGaussian()*Sqrt(accelVariance.x);
+  accel.y += NoiseGaussian()*Sqrt(accelVariance.y);
+  accel.z += NoiseGaussian()*Sqrt(accelVariance.z);
 
   Vector3 accelw = accel;
   T.R.mulTranspose(accelw,accel);
 
-  accel = Discretize(accel,Vector3(Zero),accelVariance);
+  accel = Discretize(accel,Vector3(Zero),accelVariance,noise);
   for(int i=0;i<3;i++)
     if(!hasAxis[i]) accel[i] = 0;
 }
@@ -1080,8 +1115,8 @@ void TiltSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
   Rsensor.mulTranspose(wlocal,w);
   wlocal = w;
 
-  alocal = Discretize(alocal,resolution,variance);
-  wlocal = Discretize(wlocal,resolution,variance);
+  alocal = Discretize(alocal,resolution,variance,noise);
+  wlocal = Discretize(wlocal,resolution,variance,noise);
 
   for(int i=0;i<3;i++)
     if(!hasAxis[i]) alocal[i] = 0;
@@ -1111,8 +1146,8 @@ void TiltSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
   Rsensor.mulTranspose(wlocal,w);
   wlocal = w;
 
-  alocal = Discretize(alocal,resolution,variance);
-  wlocal = Discretize(wlocal,resolution,variance);
+  alocal = Discretize(alocal,resolution,variance,noise);
+  wlocal = Discretize(wlocal,resolution,variance,noise);
 
   for(int i=0;i<3;i++)
     if(!hasAxis[i]) alocal[i] = 0;
@@ -1215,15 +1250,15 @@ void GyroSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
       angAccel = (w-last_w)/last_dt;
     }
     last_w = w;
-    angAccel.x += RandGaussian()*Sqrt(angAccelVariance(0,0));
-    angAccel.y += RandGaussian()*Sqrt(angAccelVariance(1,1));
-    angAccel.z += RandGaussian()*Sqrt(angAccelVariance(2,2));
+    angAccel.x += NoiseGaussian()*Sqrt(angAccelVariance(0,0));
+    angAccel.y += NoiseGaussian()*Sqrt(angAccelVariance(1,1));
+    angAccel.z += NoiseGaussian()*Sqrt(angAccelVariance(2,2));
   }
   if(hasAngVel) {
     angVel = w;
-    angVel.x += RandGaussian()*Sqrt(angVelVariance(0,0));
-    angVel.y += RandGaussian()*Sqrt(angVelVariance(1,1));
-    angVel.z += RandGaussian()*Sqrt(angVelVariance(2,2));
+    angVel.x += NoiseGaussian()*Sqrt(angVelVariance(0,0));
+    angVel.y += NoiseGaussian()*Sqrt(angVelVariance(1,1));
+    angVel.z += NoiseGaussian()*Sqrt(angVelVariance(2,2));
   }
   if(hasRotation) {
     rotation = T.R;
@@ -1244,15 +1279,15 @@ void GyroSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
       angAccel = (w-last_w)/last_dt;
     }
     last_w = w;
-    angAccel.x += RandGaussian()*Sqrt(angAccelVariance(0,0));
-    angAccel.y += RandGaussian()*Sqrt(angAccelVariance(1,1));
-    angAccel.z += RandGaussian()*Sqrt(angAccelVariance(2,2));
+    angAccel.x += NoiseGaussian()*Sqrt(angAccelVariance(0,0));
+    angAccel.y += NoiseGaussian()*Sqrt(angAccelVariance(1,1));
+    angAccel.z += NoiseGaussian()*Sqrt(angAccelVariance(2,2));
   }
   if(hasAngVel) {
     angVel = w;
-    angVel.x += RandGaussian()*Sqrt(angVelVariance(0,0));
-    angVel.y += RandGaussian()*Sqrt(angVelVariance(1,1));
-    angVel.z += RandGaussian()*Sqrt(angVelVariance(2,2));
+    angVel.x += NoiseGaussian()*Sqrt(angVelVariance(0,0));
+    angVel.y += NoiseGaussian()*Sqrt(angVelVariance(1,1));
+    angVel.z += NoiseGaussian()*Sqrt(angVelVariance(2,2));
   }
   if(hasRotation) {
     rotation = T.R;
@@ -1588,12 +1623,14 @@ FilteredSensor::FilteredSensor()
 void FilteredSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 {
   if(!sensor) return;
+  sensor->noise = noise;
   sensor->SimulateKinematic(robot,world);
 }
 
 void FilteredSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
 {
   if(!sensor) return;
+  sensor->noise = noise;
   sensor->Simulate(robot,sim);
 }
 
@@ -1679,6 +1716,7 @@ TimeDelayedSensor::TimeDelayedSensor()
 void TimeDelayedSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 {
   if(!sensor) return;
+  sensor->noise = noise;
   sensor->SimulateKinematic(robot,world);
   vector<double> newMeasurements;
   sensor->GetMeasurements(newMeasurements);
@@ -1696,6 +1734,7 @@ void TimeDelayedSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
 void TimeDelayedSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
 {
   if(!sensor) return;
+  sensor->noise = noise;
   sensor->Simulate(robot,sim);
   vector<double> newMeasurements;
   sensor->GetMeasurements(newMeasurements);
@@ -1833,7 +1872,7 @@ LaserRangeSensor::LaserRangeSensor()
  depthVarianceLinear(0),depthVarianceConstant(0),
  xSweepMagnitude(DtoR(90.0)),xSweepPeriod(0),xSweepPhase(0),xSweepType(SweepSawtooth),
  ySweepMagnitude(0),ySweepPeriod(0),ySweepPhase(0),ySweepType(SweepSinusoid),
- last_dt(0),last_t(0)
+ ignoreSelf(true),numThreads(1),last_dt(0),last_t(0)
 {
   Tsensor.setIdentity();
 }
@@ -1854,13 +1893,36 @@ double EvalPattern(int type,double x,double correction=1.0)
 }
 
 void LaserRangeSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
+{
+  PrepareWorldModel(robot,sim);
+  SimulateKinematic(*robot->robot,*sim->world);
+}
+
+void LaserRangeSensor::PrepareWorldModel(ControlledRobotSimulator* robot,WorldSimulation* sim)
 {
   if(link >= 0) 
     robot->oderobot->GetLinkTransform(link,robot->robot->links[link].T_World);
-  SimulateKinematic(*robot->robot,*sim->world);
+}
+
+void LaserRangeSensor::SimulateUpdated(ControlledRobotSimulator* robot,WorldSimulation* sim,bool concurrent)
+{
+  //don't start more threads while the scheduler's threads are busy
+  Sweep(*robot->robot,*sim->world,(concurrent ? 1 : numThreads));
+}
+
+void LaserRangeSensor::FinishSimulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
+{
+  ProcessReadings();
 }
 
 void LaserRangeSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
+{
+  world.UpdateBVH();
+  Sweep(robot,world,numThreads);
+  ProcessReadings();
+}
+
+void LaserRangeSensor::Sweep(Robot& robot,RobotWorld& world,int threads)
 {
   depthReadings.resize(measurementCount);
   //need to make sure that the sawtooth pattern hits the last measurement: scale the time domain so last measurement before
@@ -1878,7 +1940,6 @@ void LaserRangeSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
   //skip previous measurement
   if(xSweepPeriod != 0 && measurementCount > 1) ux0 += (ux1-ux0)/(measurementCount-1);
   if(ySweepPeriod != 0 && measurementCount > 1) uy0 += (uy1-uy0)/(measurementCount-1);
-  Ray3D ray;
   RigidTransform T;
   if(link >= 0) {
     T = robot.links[link].T_World;
@@ -1886,6 +1947,8 @@ void LaserRangeSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
   }
   else
     T = Tsensor;
+  //generate the whole sweep up front, then cast it as one batch
+  rays.resize(measurementCount);
   Real xmin=0,xmax=0;
   Real ymin=0,ymax=0;
   for(int i=0;i<measurementCount;i++) {
@@ -1906,20 +1969,34 @@ void LaserRangeSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
     Real x = Sin(xtheta);
     Real y = Cos(xtheta)*Sin(ytheta);
     Real z = Cos(xtheta)*Cos(ytheta);
-    ray.source = T*(Vector3(x,y,z)*depthMinimum);
-    ray.direction = T.R*Vector3(x,y,z);
-    Vector3 pt;
-    //need to ignore the robot's link geometry
-    int obj = world.RayCast(ray,pt);
-    if (obj >= 0) 
-      depthReadings[i] = pt.distance(ray.source) + depthMinimum;
+    rays[i].source = T*(Vector3(x,y,z)*depthMinimum);
+    rays[i].direction = T.R*Vector3(x,y,z);
+  }
+  //mask out the robot's own links
+  ignoreIDs.resize(world.NumIDs());
+  fill(ignoreIDs.begin(),ignoreIDs.end(),0);
+  if(ignoreSelf) {
+    for(size_t r=0;r<world.robots.size();r++) {
+      Robot* wrobot = world.robots[r];
+      if(wrobot != &robot) continue;
+      for(size_t j=0;j<robot.links.size();j++)
+        ignoreIDs[world.RobotLinkID(r,j)] = 1;
+    }
+  }
+  world.bvh.RayCast(rays,hits,WorldBVH::All,false,&ignoreIDs,threads);
+  for(int i=0;i<measurementCount;i++) {
+    if (hits[i].item >= 0) 
+      depthReadings[i] = hits[i].point.distance(rays[i].source) + depthMinimum;
     else 
       depthReadings[i] = Inf;
   }
-  //process all depth readings
+}
+
+void LaserRangeSensor::ProcessReadings()
+{
   for(size_t i=0;i<depthReadings.size();i++) {
     if(!IsInf(depthReadings[i])) 
-      depthReadings[i] = Discretize(depthReadings[i],depthResolution,depthReadings[i]*depthVarianceLinear + depthVarianceConstant);
+      depthReadings[i] = Discretize(depthReadings[i],depthResolution,depthReadings[i]*depthVarianceLinear + depthVarianceConstant,noise);
     if(depthReadings[i] <= depthMinimum || depthReadings[i] >= depthMaximum) depthReadings[i] = depthMaximum;
   }
 }
@@ -1945,6 +2022,18 @@ void LaserRangeSensor::GetMeasurements(vector<double>& values) const
   values = depthReadings;
 }
 
+void LaserRangeSensor::GetMeasurementViews(vector<SensorMeasurementView>& views)
+{
+  views.resize(0);
+  if(depthReadings.empty()) return;
+  views.resize(1);
+  views[0].name = "depth";
+  views[0].type = SensorMeasurementView::Float64;
+  views[0].data = &depthReadings[0];
+  views[0].shape.resize(1);
+  views[0].shape[0] = (int)depthReadings.size();
+}
+
 void LaserRangeSensor::SetMeasurements(const vector<double>& values)
 {
   depthReadings = values;
@@ -1969,6 +2058,8 @@ map<string,string> LaserRangeSensor::Settings() const
   FILL_SENSOR_SETTING(res,ySweepPeriod);
   FILL_SENSOR_SETTING(res,ySweepPhase);
   FILL_SENSOR_SETTING(res,ySweepType);
+  FILL_SENSOR_SETTING(res,ignoreSelf);
+  FILL_SENSOR_SETTING(res,numThreads);
   return res;
 }
 bool LaserRangeSensor::GetSetting(const string& name,string& str) const
@@ -1989,6 +2080,8 @@ bool LaserRangeSensor::GetSetting(const string& name,string& str) const
   GET_SENSOR_SETTING(ySweepPeriod);
   GET_SENSOR_SETTING(ySweepPhase);
   GET_SENSOR_SETTING(ySweepType);
+  GET_SENSOR_SETTING(ignoreSelf);
+  GET_SENSOR_SETTING(numThreads);
   return false;
 }
 bool LaserRangeSensor::SetSetting(const string& name,const string& str)
@@ -2009,6 +2102,8 @@ bool LaserRangeSensor::SetSetting(const string& name,const string& str)
   SET_SENSOR_SETTING(ySweepPeriod);
   SET_SENSOR_SETTING(ySweepPhase);
   SET_SENSOR_SETTING(ySweepType);
+  SET_SENSOR_SETTING(ignoreSelf);
+  SET_SENSOR_SETTING(numThreads);
   return false;
 }
 
@@ -2068,7 +2163,8 @@ CameraSensor::CameraSensor()
  xfov(DtoR(56.0)),yfov(DtoR(43.0)),
  zmin(0.4),zmax(4.0),zresolution(0),
  zvarianceLinear(0),zvarianceConstant(0),
- useGLFramebuffers(true),color_tex(0),fb(0),depth_rb(0)
+ numRenderThreads(1),
+ useGLFramebuffers(true),color_tex(0),fb(0),depth_rb(0),castPending(false)
 {
   Tsensor.setIdentity();
 }
@@ -2085,7 +2181,54 @@ CameraSensor::~CameraSensor()
   fb = 0;
 }
 
+//Casts the rays for one image row per work item, for the ray casting
+//fallback of CameraSensor.  Writes the hit world ID (-1 for none) and the
+//depth along the view direction of each pixel.
+struct CameraRayCastBody : public ParallelForBody
+{
+  CameraRayCastBody(const WorldBVH& _bvh,const Vector3& _vsrc,const Vector3& _vfwd,const Vector3& _dx,const Vector3& _dy,Real _zmin,int _xres,int _yres,vector<int>& _ids,vector<Real>& _depths)
+    :bvh(_bvh),vsrc(_vsrc),vfwd(_vfwd),dx(_dx),dy(_dy),zmin(_zmin),xres(_xres),yres(_yres),ids(_ids),depths(_depths)
+  {}
+  virtual void Run(int j,int thread)
+  {
+    Ray3D ray;
+    Vector3 pt;
+    Real v = 0.5*yres - Real(j);
+    int k = j*xres;
+    for(int i=0;i<xres;i++,k++) {
+      Real u = Real(i) - 0.5*xres;    
+      ray.direction = vfwd + u*dx + v*dy;
+      ray.direction.inplaceNormalize();
+      ray.source = vsrc + ray.direction * zmin / (vfwd.dot(ray.direction));
+      ids[k] = bvh.RayCast(ray,pt);
+      if(ids[k] >= 0) depths[k] = vfwd.dot(pt - vsrc);
+    }
+  }
+
+  const WorldBVH& bvh;
+  Vector3 vsrc,vfwd,dx,dy;
+  Real zmin;
+  int xres,yres;
+  vector<int>& ids;
+  vector<Real>& depths;
+};
+
 void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
+{
+  Render(robot,world,true,numRenderThreads);
+  FinishRender(world);
+}
+
+bool CameraSensor::IsThreadSafe() const
+{
+#if HAVE_GLEW
+  return !useGLFramebuffers;
+#else
+  return true;
+#endif //HAVE_GLEW
+}
+
+void CameraSensor::Render(Robot& robot,RobotWorld& world,bool refit,int threads)
 {
   RigidTransform Tlink;
   if(link >= 0) Tlink = robot.links[link].T_World;
@@ -2198,18 +2341,21 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
     CheckGLErrors("GL errors during camera sensor simulation: ");
 
     //extract measurements
-    measurements.resize(0);
+    rgbImage.resize(0);
+    depthImage.resize(0);
     if(rgb) {
       pixels.resize(4*xres*yres);
       glBindTexture(GL_TEXTURE_2D, color_tex);
-      glGetTexImage(GL_TEXTURE_2D,0,GL_RGBA,GL_UNSIGNED_INT_8_8_8_8,&pixels[0]);
-      measurements.resize(xres*yres);
+      glGetTexImage(GL_TEXTURE_2D,0,GL_RGBA,GL_UNSIGNED_BYTE,&pixels[0]);
+      rgbImage.resize(3*xres*yres);
       int k=0;
       //don't forget to flip vertically
       for(int j=0;j<yres;j++) {
         for(int i=0;i<xres;i++,k+=4) {
-          unsigned int pix = (pixels[k] << 24 ) | (pixels[k+1] << 16 ) | (pixels[k+2] << 8 ) | (pixels[k+3]);
-          measurements[(yres-j-1)*xres + i] = double(pix);
+          unsigned char* pix = &rgbImage[3*((yres-j-1)*xres + i)];
+          pix[0] = pixels[k];
+          pix[1] = pixels[k+1];
+          pix[2] = pixels[k+2];
         }
       }
     }
@@ -2219,8 +2365,7 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
       glReadPixels(0, 0, xres, yres, GL_DEPTH_COMPONENT, GL_FLOAT, &floats[0]);
       glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, 0); 
 
-      size_t vstart = measurements.size();
-      measurements.resize(measurements.size() + xres*yres); 
+      depthImage.resize(xres*yres); 
       //don't forget to flip vertically
       int k=0;
       for(int j=0;j<yres;j++) {
@@ -2234,9 +2379,9 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
           }
           else {
             floats[k] = 1.0/(1.0/zmin - floats[k]*(1.0/zmin-1.0/zmax));
-            floats[k] = Discretize(floats[k],zresolution,zvarianceLinear*floats[k] + zvarianceConstant);
+            floats[k] = Discretize(floats[k],zresolution,zvarianceLinear*floats[k] + zvarianceConstant,noise);
           }
-          measurements[vstart+(yres-j-1)*xres + i] = floats[k];
+          depthImage[(yres-j-1)*xres + i] = floats[k];
         }
       }
     }
@@ -2251,7 +2396,6 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
     Camera::Viewport vp;
     GetViewport(vp);
     vp.xform = Tlink*vp.xform;
-    Ray3D ray;
     Vector3 vsrc;
     Vector3 vfwd,dx,dy;
     vp.getClickSource(0,0,vsrc);
@@ -2260,79 +2404,111 @@ void CameraSensor::SimulateKinematic(Robot& robot,RobotWorld& world)
     dx *= 1.0/(vp.w*vp.scale);
     dy = vp.yDir();
     dy *= 1.0/(vp.w*vp.scale);
-    measurements.resize(0);
-    int dstart = 0;
-    if(rgb) measurements.resize(xres*yres);
-    if(depth) {
-      dstart = (int)measurements.size();
-      measurements.resize(measurements.size()+xres*yres);
-    }
-    int k=0;
-    double background = double(0xff96aaff);
-    Vector3 pt;
-    for(int j=0;j<yres;j++) {
-      Real v = 0.5*yres - Real(j);
-      for(int i=0;i<xres;i++,k++) {
-        Real u = Real(i) - 0.5*xres;    
-        ray.direction = vfwd + u*dx + v*dy;
-        ray.direction.inplaceNormalize();
-        ray.source = vsrc + ray.direction * zmin / (vfwd.dot(ray.direction));
-        int obj = world.RayCast(ray,pt);
-        if (obj >= 0) {
-          if(rgb) {
-            //get color of object
-            //TODO: lighting
+    //cast the rays in parallel; the images are filled in serially by
+    //FinishRender, so that the depth noise is drawn in the same order for
+    //any thread count
+    if(refit) world.UpdateBVH();
+    hitIDs.resize(xres*yres);
+    hitDepths.resize(xres*yres);
+    CameraRayCastBody body(world.bvh,vsrc,vfwd,dx,dy,zmin,xres,yres,hitIDs,hitDepths);
+    ParallelFor(yres,body,ResolveNumThreads(threads));
+    castPending = true;
+  }
+}
+
+void CameraSensor::FinishRender(RobotWorld& world)
+{
+  if(!castPending) return;
+  castPending = false;
+  rgbImage.resize(rgb ? 3*xres*yres : 0);
+  depthImage.resize(depth ? xres*yres : 0);
+  int k=0;
+  const unsigned char background[3] = {0x96,0xaa,0xff};
+  //colors are looked up once per world ID
+  vector<unsigned char> colors(world.NumIDs()*3);
+  vector<bool> haveColor(world.NumIDs(),false);
+  for(int j=0;j<yres;j++) {
+    for(int i=0;i<xres;i++,k++) {
+      int obj = hitIDs[k];
+      if (obj >= 0) {
+        if(rgb) {
+          //get color of object
+          //TODO: lighting
+          if(!haveColor[obj]) {
             RobotWorld::AppearancePtr app = world.GetAppearance(obj);
             float* rgba = app->faceColor.rgba;
-            measurements[k] = double(((unsigned char)(rgba[3]*255.0) << 24) | ((unsigned char)(rgba[0]*255.0) << 16) | ((unsigned char)(rgba[1]*255.0) << 8) | ((unsigned char)(rgba[2]*255.0)));
+            for(int c=0;c<3;c++)
+              colors[obj*3+c] = (unsigned char)(rgba[c]*255.0);
+            haveColor[obj] = true;
           }
-          Real d = vfwd.dot(pt - vsrc);
-          if(depth) measurements[dstart+k] = Discretize(d,zresolution,zvarianceLinear*d + zvarianceConstant);
-        }
-        else {
-          //no reading
-          if(rgb) measurements[k] = background;
-          if(depth) measurements[dstart+k] = zmax;
+          memcpy(&rgbImage[k*3],&colors[obj*3],3);
         }
+        Real d = hitDepths[k];
+        if(depth) depthImage[k] = (float)Discretize(d,zresolution,zvarianceLinear*d + zvarianceConstant,noise);
       }
-    }
-    static bool warned = false;
-    if(!warned) {
-      printf("DepthCameraSensor: doing fallback from GLEW... %d rays cast, may be slow\n",k);
-      warned = true;
-    }
-
-    //need to upload the texture for sensor visualization
-    if(color_tex == 0) { 
-      //RGBA8 2D texture, 24 bit depth texture, 256x256
-      glGenTextures(1, &color_tex);
-      if(color_tex != 0) {
-        glBindTexture(GL_TEXTURE_2D, color_tex);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      else {
+        //no reading
+        if(rgb) memcpy(&rgbImage[k*3],background,3);
+        if(depth) depthImage[k] = (float)zmax;
       }
     }
+  }
+  static bool warned = false;
+  if(!warned) {
+    printf("DepthCameraSensor: doing fallback from GLEW... %d rays cast, may be slow\n",k);
+    warned = true;
+  }
+
+  //need to upload the texture for sensor visualization
+  if(color_tex == 0) { 
+    //RGBA8 2D texture, 24 bit depth texture, 256x256
+    glGenTextures(1, &color_tex);
     if(color_tex != 0) {
-      //copy measurements into buffer -- don't forget y flip
-      vector<unsigned int> image(xres*yres);
-      int k=0;
-      for(int j=0;j<yres;j++)
-        for(int i=0;i<xres;i++,k++)
-          image[(yres-j-1)*xres + i] = (unsigned int)measurements[k];
-      //NULL means reserve texture memory, but texels are undefined
-      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, xres, yres, 0, GL_BGRA, GL_UNSIGNED_BYTE, &image[0]);
+      glBindTexture(GL_TEXTURE_2D, color_tex);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     }
   }
+  if(color_tex != 0 && rgb) {
+    //copy measurements into buffer -- don't forget y flip
+    pixels.resize(4*xres*yres);
+    int k=0;
+    for(int j=0;j<yres;j++)
+      for(int i=0;i<xres;i++,k++) {
+        unsigned char* pix = &pixels[4*((yres-j-1)*xres + i)];
+        pix[0] = rgbImage[k*3];
+        pix[1] = rgbImage[k*3+1];
+        pix[2] = rgbImage[k*3+2];
+        pix[3] = 0xff;
+      }
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, xres, yres, 0, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+  }
 }
 
 void CameraSensor::Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
 {
   sim->UpdateModel();
+  PrepareWorldModel(robot,sim);
+  SimulateKinematic(*robot->robot,*sim->world);
+}
+
+void CameraSensor::PrepareWorldModel(ControlledRobotSimulator* robot,WorldSimulation* sim)
+{
   if (link >= 0)  //make sure we get the true simulated link transform
     robot->oderobot->GetLinkTransform(link,robot->robot->links[link].T_World);
-  SimulateKinematic(*robot->robot,*sim->world);
+}
+
+void CameraSensor::SimulateUpdated(ControlledRobotSimulator* robot,WorldSimulation* sim,bool concurrent)
+{
+  //don't start more threads while the scheduler's threads are busy
+  Render(*robot->robot,*sim->world,false,(concurrent ? 1 : numRenderThreads));
+}
+
+void CameraSensor::FinishSimulate(ControlledRobotSimulator* robot,WorldSimulation* sim)
+{
+  FinishRender(*sim->world);
 }
 
 void CameraSensor::Reset()
@@ -2363,13 +2539,63 @@ void CameraSensor::MeasurementNames(vector<string>& names) const
 
 void CameraSensor::GetMeasurements(vector<double>& values) const
 {
-  values = measurements;
+  //colors are packed as 0xAABBGGRR
+  int n = (int)rgbImage.size()/3;
+  values.resize(n + depthImage.size());
+  for(int k=0;k<n;k++) {
+    const unsigned char* pix = &rgbImage[k*3];
+    values[k] = double(0xff000000 | (pix[2] << 16) | (pix[1] << 8) | pix[0]);
+  }
+  for(size_t k=0;k<depthImage.size();k++)
+    values[n+k] = depthImage[k];
 }
 
 void CameraSensor::SetMeasurements(const vector<double>& values)
 {
-  measurements = values;
-  //TODO: copy back into pixel buffers?
+  int n = xres*yres;
+  int k = 0;
+  rgbImage.resize(0);
+  depthImage.resize(0);
+  if(rgb && (int)values.size() >= n) {
+    rgbImage.resize(3*n);
+    for(int i=0;i<n;i++,k++) {
+      unsigned int abgr = (unsigned int)values[k];
+      rgbImage[i*3] = abgr & 0xff;
+      rgbImage[i*3+1] = (abgr >> 8) & 0xff;
+      rgbImage[i*3+2] = (abgr >> 16) & 0xff;
+    }
+  }
+  if(depth && (int)values.size() >= k+n) {
+    depthImage.resize(n);
+    for(int i=0;i<n;i++,k++)
+      depthImage[i] = (float)values[k];
+  }
+}
+
+void CameraSensor::GetMeasurementViews(vector<SensorMeasurementView>& views)
+{
+  views.resize(0);
+  if(!rgbImage.empty()) {
+    views.resize(views.size()+1);
+    SensorMeasurementView& v = views.back();
+    v.name = "rgb";
+    v.type = SensorMeasurementView::UInt8;
+    v.data = &rgbImage[0];
+    v.shape.resize(3);
+    v.shape[0] = yres;
+    v.shape[1] = xres;
+    v.shape[2] = 3;
+  }
+  if(!depthImage.empty()) {
+    views.resize(views.size()+1);
+    SensorMeasurementView& v = views.back();
+    v.name = "depth";
+    v.type = SensorMeasurementView::Float32;
+    v.data = &depthImage[0];
+    v.shape.resize(2);
+    v.shape[0] = yres;
+    v.shape[1] = xres;
+  }
 }
 
 map<string,string> CameraSensor::Settings() const
@@ -2388,6 +2614,7 @@ map<string,string> CameraSensor::Settings() const
   FILL_SENSOR_SETTING(res,zmax);
   FILL_SENSOR_SETTING(res,zvarianceLinear);
   FILL_SENSOR_SETTING(res,zvarianceConstant);
+  FILL_SENSOR_SETTING(res,numRenderThreads);
   return res;
 }
 bool CameraSensor::GetSetting(const string& name,string& str) const
@@ -2405,6 +2632,7 @@ bool CameraSensor::GetSetting(const string& name,string& str) const
   GET_SENSOR_SETTING(zmax);
   GET_SENSOR_SETTING(zvarianceLinear);
   GET_SENSOR_SETTING(zvarianceConstant);
+  GET_SENSOR_SETTING(numRenderThreads);
   return false;
 }
 bool CameraSensor::SetSetting(const string& name,const string& str)
@@ -2422,6 +2650,7 @@ bool CameraSensor::SetSetting(const string& name,const string& str)
   SET_SENSOR_SETTING(zmax);
   SET_SENSOR_SETTING(zvarianceLinear);
   SET_SENSOR_SETTING(zvarianceConstant);
+  SET_SENSOR_SETTING(numRenderThreads);
   return false;
 }
 
@@ -14,6 +14,25 @@ class RobotWorld;
 class ControlledRobotSimulator;
 class WorldSimulation;
 class TiXmlElement;
+class RandomStream;
+
+/** @ingroup Control
+ * @brief A typed view into a sensor's measurement storage, valid until the
+ * sensor is next simulated or its measurements are set.
+ *
+ * Elements are stored contiguously in row-major order according to shape.
+ */
+struct SensorMeasurementView
+{
+  enum { Float64, Float32, UInt8 };
+  int NumElements() const;
+  int ElementSize() const;
+
+  string name;
+  int type;
+  const void* data;
+  vector<int> shape;
+};
 
 /** @ingroup Control
  * @brief A sensor base class.  A SensorBase should allow a Controller to 
@@ -54,6 +73,27 @@ class SensorBase
   virtual void Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim) {}
   ///Updates the sensor for a kinematic world.  Useful for non-simulation debugging.
   virtual void SimulateKinematic(Robot& robot,RobotWorld& world) {}
+  ///Should return true if Simulate reads the world model, as the visual
+  ///sensors do.  For these sensors, SensorScheduler updates the world model
+  ///and its BVH once for all sensors, then calls PrepareWorldModel,
+  ///SimulateUpdated, and FinishSimulate rather than Simulate.
+  virtual bool UsesWorldModel() const { return false; }
+  ///Makes sensor-specific changes to the updated world model, e.g., moving
+  ///the sensor's link to its simulated transform.  Called serially.
+  virtual void PrepareWorldModel(ControlledRobotSimulator* robot,WorldSimulation* sim) {}
+  ///Same as Simulate, but assumes that the world model and its BVH are up
+  ///to date.  If concurrent is true, other sensors are being simulated at
+  ///the same time, so the sensor should not start threads of its own.
+  virtual void SimulateUpdated(ControlledRobotSimulator* robot,WorldSimulation* sim,bool concurrent) { Simulate(robot,sim); }
+  ///Completes SimulateUpdated.  Called serially, in robot and sensor order,
+  ///so this is where a thread safe sensor draws its noise or makes OpenGL
+  ///calls.
+  virtual void FinishSimulate(ControlledRobotSimulator* robot,WorldSimulation* sim) {}
+  ///Should return true if Simulate (or SimulateUpdated, for sensors that
+  ///use the world model) may run concurrently with other sensors, i.e., it
+  ///does not use OpenGL, the random number generator, or other shared state
+  ///besides reading the world model.
+  virtual bool IsThreadSafe() const { return false; }
   ///Advances to the next time step with duration dt elapsed
   virtual void Advance(double dt) {}
   ///Should be overridden if the sensor is stateful to reset to an initial state
@@ -68,6 +108,10 @@ class SensorBase
   ///correctly restore state using ReadState(), or to visualize a physical
   ///robot's sensors.
   virtual void SetMeasurements(const vector<double>& values) { }
+  ///Returns views of the measurements in their native storage, so that
+  ///large measurements (e.g., images) need not be copied into doubles.
+  ///The default copies GetMeasurements into a single Float64 view.
+  virtual void GetMeasurementViews(vector<SensorMeasurementView>& views);
   ///Any other state besides measurements/settings that you might want to store.  Used in ReadState
   virtual void GetInternalState(vector<double>& state) const {  }
   ///Any other state besides measurements/settings that you might want to store.  Used in WriteState
@@ -83,8 +127,18 @@ class SensorBase
   ///using these measurements, using OpenGL calls.
   virtual void DrawGL(const Robot& robot,const vector<double>& measurements) {}
 
+  ///Returns normally distributed noise with variance 1, drawn from noise
+  ///if it is set
+  double NoiseGaussian();
+
   string name;
   double rate;
+  ///If not NULL, the sensor's noise is drawn from this stream rather than
+  ///the global random number generator.  WorldSimulation sets this to its
+  ///sensorNoise stream once it has been seeded.
+  RandomStream* noise;
+  //internal: storage for the default GetMeasurementViews
+  vector<double> viewBuffer;
 };
 
 
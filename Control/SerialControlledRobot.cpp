@@ -1,11 +1,16 @@
 #include "SerialControlledRobot.h"
 #include "JointSensors.h"
 #include <KrisLibrary/utils/AnyCollection.h>
+#include <algorithm>
+
+//number of binary sensor messages with an unknown schema between two
+//schema requests
+static const int kSchemaRequestInterval = 100;
 
 SerialControlledRobot::SerialControlledRobot(const char* _host,double timeout)
-  :host(_host),robotTime(0),timeStep(0),numOverruns(0),stopFlag(false),controllerMutex(NULL)
+  :host(_host),robotTime(0),timeStep(0),numOverruns(0),stopFlag(false),controllerMutex(NULL),binary(false),staleSensorMessages(0)
 {
-  controllerPipe = new SocketPipeWorker(_host,false,timeout);
+  controllerPipe = MakeMessagePipe(_host,false,timeout);
 }
 
 SerialControlledRobot::~SerialControlledRobot()
@@ -25,7 +30,7 @@ bool SerialControlledRobot::Init(Robot* _robot,RobotController* _controller)
 
 bool SerialControlledRobot::Process(double timeout)
 {
-  if(!controllerPipe->initialized) {
+  if(!controllerPipe->IsOpen()) {
     fprintf(stderr,"SerialControlledRobot::Process(): did you forget to call Init?\n");
     return false;
   }
@@ -44,7 +49,7 @@ bool SerialControlledRobot::Process(double timeout)
       if(controllerMutex) controllerMutex->unlock();
       if(iteration % 100 == 0)
 	printf("SerialControlledRobot(): Error getting timestep? Waiting.\n");
-      ThreadSleep(0.01);
+      controllerPipe->WaitForMessage(0.01);
     }
     else {
       if(klamptController) {
@@ -68,7 +73,7 @@ bool SerialControlledRobot::Process(double timeout)
 
 bool SerialControlledRobot::Run()
 {
-  if(!controllerPipe->initialized) {
+  if(!controllerPipe->IsOpen()) {
     fprintf(stderr,"SerialControlledRobot::Run(): did you forget to call Init?\n");
     return false;
   }
@@ -83,7 +88,11 @@ bool SerialControlledRobot::Run()
       //first time, or failed to read -- 
       //read next sensor data again to get timing info
       if(controllerMutex) controllerMutex->unlock();
-      ThreadSleep(0.01);
+      controllerPipe->WaitForMessage(0.01);
+      if(!controllerPipe->IsOpen()) {
+	fprintf(stderr,"SerialControlledRobot::Run(): killed by socket disconnect?\n");
+	return false;
+      }
     }
     else {
       if(klamptController) {
@@ -96,7 +105,7 @@ bool SerialControlledRobot::Run()
       }
       if(controllerMutex) controllerMutex->unlock();
 
-      if(!controllerPipe->initialized) {
+      if(!controllerPipe->IsOpen()) {
 	fprintf(stderr,"SerialControlledRobot::Run(): killed by socket disconnect?\n");
 	return false;
       }
@@ -125,86 +134,163 @@ void SerialControlledRobot::SetMutex(Mutex* mutex)
   controllerMutex = mutex;
 }
 
-void SerialControlledRobot::ReadSensorData(RobotSensors& sensors)
+//adds the sensors that a robot client writes by default
+static void AddDefaultSensors(RobotSensors& sensors,Robot* robot,bool q,bool dq,bool torque)
 {
-  if(controllerPipe && controllerPipe->UnreadCount() > 0) {
-    if(controllerPipe->UnreadCount() > 1) {
-      fprintf(stderr,"SerialControlledRobot: Warning, skipping %d sensor messages\n",controllerPipe->UnreadCount()-1);
-      fprintf(stderr,"  TODO: debug the controller pipe?\n");
-    }
-    string msg = controllerPipe->Newest();
+  if(q) {
+    JointPositionSensor* jp = new JointPositionSensor;
+    jp->name = "q";
+    jp->q.resize(robot->q.n,Zero);
+    sensors.sensors.push_back(jp);
+  }
+  if(dq) {
+    JointVelocitySensor* jv = new JointVelocitySensor;
+    jv->name = "dq";
+    jv->dq.resize(robot->q.n,Zero);
+    sensors.sensors.push_back(jv);
+  }
+  if(torque) {
+    DriverTorqueSensor* ts = new DriverTorqueSensor;
+    ts->name = "torque";
+    ts->t.resize(robot->drivers.size());
+    sensors.sensors.push_back(ts);
+  }
+}
 
-    AnyCollection c;
-    if(!c.read(msg.c_str())) {
-      fprintf(stderr,"SerialControlledRobot: Unable to read parse data from robot client\n");
-      return;
-    }
-    
-    if(sensors.sensors.empty()) {
-      //no sensors defined by the user -- initialize default sensors based on
-      //what's in the sensor message
-      if(c.find("q") != NULL) {
-	JointPositionSensor* jp = new JointPositionSensor;
-	jp->name = "q";
-	jp->q.resize(klamptRobotModel->q.n,Zero);
-	sensors.sensors.push_back(jp);
-      }
-      if(c.find("dq") != NULL) {
-	JointVelocitySensor* jv = new JointVelocitySensor;
-	jv->name = "dq";
-	jv->dq.resize(klamptRobotModel->q.n,Zero);
-	sensors.sensors.push_back(jv);
-      }
-      if(c.find("torque") != NULL) {
-	DriverTorqueSensor* ts = new DriverTorqueSensor;
-	ts->name = "torque";
-	ts->t.resize(klamptRobotModel->drivers.size());
-	sensors.sensors.push_back(ts);
+void SerialControlledRobot::ReadSensorData(RobotSensors& sensors)
+{
+  if(!controllerPipe || controllerPipe->UnreadCount() == 0) return;
+  //schema messages must not be skipped, so the messages are read in order
+  //and only the newest data message is kept.  Only schema messages and the
+  //newest JSON data message are parsed.
+  string msg;
+  int numMessages = 0;
+  while(controllerPipe->UnreadCount() > 0) {
+    string next = controllerPipe->Next();
+    if(!IsSerialBinaryMessage(next) && next.find("schema") != string::npos) {
+      AnyCollection c;
+      if(c.read(next.c_str()) && c.find("schema") != NULL && c.find("names") != NULL) {
+	if(!schema.Read(c))
+	  fprintf(stderr,"SerialControlledRobot: Unable to parse sensor schema\n");
+	schemaSensors.resize(0);
+	staleSensorMessages = 0;
+	continue;
       }
     }
+    msg.swap(next);
+    numMessages++;
+  }
+  if(numMessages == 0) return;
+  if(numMessages > 1) {
+    fprintf(stderr,"SerialControlledRobot: Warning, skipping %d sensor messages\n",numMessages-1);
+    fprintf(stderr,"  TODO: debug the controller pipe?\n");
+  }
+  if(IsSerialBinaryMessage(msg)) {
+    ReadBinarySensorData(sensors,msg);
+    return;
+  }
+  AnyCollection c;
+  if(!c.read(msg.c_str())) {
+    fprintf(stderr,"SerialControlledRobot: Unable to read parse data from robot client\n");
+    return;
+  }
+  binary = false;
+
+  if(sensors.sensors.empty()) {
+    //no sensors defined by the user -- initialize default sensors based on
+    //what's in the sensor message
+    AddDefaultSensors(sensors,klamptRobotModel,c.find("q") != NULL,c.find("dq") != NULL,c.find("torque") != NULL);
+  }
 
-    //read off timing information
-    vector<AnyKeyable> keys;
-    c.enumerate_keys(keys);
-    for(size_t i=0;i<keys.size();i++) {
-      string key;
-      if(LexicalCast(keys[i].value,key)) {
-	if(key == "dt") 
-	  timeStep = c["dt"];
-	else if(key == "t") 
-	  robotTime = c["t"];
-	else if(key == "qcmd" || key=="dqcmd" || key=="torquecmd")  //echo
-	  continue;
+  //read off timing information
+  vector<AnyKeyable> keys;
+  c.enumerate_keys(keys);
+  for(size_t i=0;i<keys.size();i++) {
+    string key;
+    if(LexicalCast(keys[i].value,key)) {
+      if(key == "dt") 
+	timeStep = c["dt"];
+      else if(key == "t") 
+	robotTime = c["t"];
+      else if(key == "qcmd" || key=="dqcmd" || key=="torquecmd")  //echo
+	continue;
+      else {
+	SmartPointer<SensorBase> s = sensors.GetNamedSensor(key);
+	if(!s) {
+	  fprintf(stderr,"SerialControlledRobot::ReadSensorData: warning, sensor %s not given in model\n",key.c_str());
+	}
 	else {
-	  SmartPointer<SensorBase> s = sensors.GetNamedSensor(key);
-	  if(!s) {
-	    fprintf(stderr,"SerialControlledRobot::ReadSensorData: warning, sensor %s not given in model\n",key.c_str());
-	  }
-	  else {
-	    vector<double> values;
-	    bool converted = c[keys[i]].asvector<double>(values);
-	    if(!converted) 
-	      fprintf(stderr,"SerialControlledRobot::ReadSensorData: key %s does not yield a vector\n",key.c_str());
-	    else 
-	      s->SetMeasurements(values);
-	  }
+	  vector<double> values;
+	  bool converted = c[keys[i]].asvector<double>(values);
+	  if(!converted) 
+	    fprintf(stderr,"SerialControlledRobot::ReadSensorData: key %s does not yield a vector\n",key.c_str());
+	  else 
+	    s->SetMeasurements(values);
 	}
       }
-      else {
-	FatalError("SerialControlledRobot::ReadSensorData: Invalid key, element %d...\n",i);
-      }
+    }
+    else {
+      FatalError("SerialControlledRobot::ReadSensorData: Invalid key, element %d...\n",i);
+    }
+  }
+}
+
+void SerialControlledRobot::ReadBinarySensorData(RobotSensors& sensors,const string& msg)
+{
+  int type,id;
+  if(!ReadSerialBinaryMessage(msg,type,id,sensorValues) || type != SerialSensorData) {
+    fprintf(stderr,"SerialControlledRobot: Unable to parse binary sensor message\n");
+    return;
+  }
+  if(id != schema.id || (int)sensorValues.size() != schema.Size()) {
+    //the schema was missed.  Ask for it again, but only once per
+    //kSchemaRequestInterval messages while waiting for the answer
+    if(staleSensorMessages % kSchemaRequestInterval == 0)
+      controllerPipe->Send("{\"getschema\":1}");
+    staleSensorMessages++;
+    return;
+  }
+  staleSensorMessages = 0;
+  binary = true;
+  if(schemaSensors.empty()) {
+    //look up the sensor of each channel once per schema
+    if(sensors.sensors.empty()) {
+      vector<string>::const_iterator b=schema.names.begin(),e=schema.names.end();
+      AddDefaultSensors(sensors,klamptRobotModel,find(b,e,"q")!=e,find(b,e,"dq")!=e,find(b,e,"torque")!=e);
+    }
+    schemaSensors.resize(schema.NumChannels(),NULL);
+    for(int i=0;i<schema.NumChannels();i++) {
+      const string& name = schema.names[i];
+      if(name == "t" || name == "dt" || name == "qcmd" || name == "dqcmd" || name == "torquecmd")
+	continue;
+      schemaSensors[i] = sensors.GetNamedSensor(name);
+      if(!schemaSensors[i])
+	fprintf(stderr,"SerialControlledRobot::ReadSensorData: warning, sensor %s not given in model\n",name.c_str());
+    }
+  }
+  for(int i=0;i<schema.NumChannels();i++) {
+    int offset = schema.offsets[i], size = schema.ChannelSize(i);
+    if(offset < 0 || size < 0 || offset+size > (int)sensorValues.size()) {
+      fprintf(stderr,"SerialControlledRobot: sensor channel %s lies outside the message\n",schema.names[i].c_str());
+      return;
+    }
+    if(size == 0) continue;
+    const double* values = &sensorValues[offset];
+    if(schemaSensors[i]) {
+      channelValues.assign(values,values+size);
+      schemaSensors[i]->SetMeasurements(channelValues);
+    }
+    else if(size == 1) {
+      if(schema.names[i] == "dt") timeStep = values[0];
+      else if(schema.names[i] == "t") robotTime = values[0];
     }
   }
 }
 
 void SerialControlledRobot::WriteCommandData(const RobotMotorCommand& command)
 {
-  if(controllerPipe && controllerPipe->transport->WriteReady()) {
-    AnyCollection c;
-    AnyCollection qcmd,dqcmd,torquecmd;
-    qcmd.resize(klamptRobotModel->links.size());
-    dqcmd.resize(klamptRobotModel->links.size());
-    torquecmd.resize(command.actuators.size());
+  if(controllerPipe && controllerPipe->WriteReady()) {
+    torqueBuffer.resize(command.actuators.size());
     bool anyNonzeroV=false,anyNonzeroTorque = false;
     int mode = ActuatorCommand::OFF;
     for(size_t i=0;i<command.actuators.size();i++) {
@@ -218,43 +304,80 @@ void SerialControlledRobot::WriteCommandData(const RobotMotorCommand& command)
       }
       klamptRobotModel->SetDriverValue(i,command.actuators[i].qdes);
       klamptRobotModel->SetDriverVelocity(i,command.actuators[i].dqdes);
-      torquecmd[(int)i] = command.actuators[i].torque;
+      torqueBuffer[i] = command.actuators[i].torque;
       if(command.actuators[i].dqdes!=0) anyNonzeroV=true;
       if(command.actuators[i].torque!=0) anyNonzeroTorque=true;
       if(mode == ActuatorCommand::LOCKED_VELOCITY) 
 	klamptRobotModel->SetDriverVelocity(i,command.actuators[i].desiredVelocity);
     }
-    if(mode == ActuatorCommand::PID) {
-      for(size_t i=0;i<klamptRobotModel->links.size();i++)
-	qcmd[(int)i] = klamptRobotModel->q[i];
-    }
-    if(anyNonzeroV || mode == ActuatorCommand::LOCKED_VELOCITY) {
-      for(size_t i=0;i<klamptRobotModel->links.size();i++)
-	dqcmd[(int)i] = klamptRobotModel->dq[i];
-    }
 
+    int flags = 0;
     if(mode == ActuatorCommand::OFF) {
       //nothing to send
       return;
     }    
     else if(mode == ActuatorCommand::LOCKED_VELOCITY) {
       //cout<<"Sending locked velocity command"<<endl;
-      c["dqcmd"] = dqcmd;
-      c["tcmd"] = timeStep;
+      flags = SerialDQCmd | SerialTCmd;
     }
     else if(mode == ActuatorCommand::PID) {
       //cout<<"Sending PID command"<<endl;
-      c["qcmd"] = qcmd;
-      if(anyNonzeroV) c["dqcmd"] = dqcmd;
-      if(anyNonzeroTorque) c["torquecmd"] = torquecmd;
+      flags = SerialQCmd;
+      if(anyNonzeroV) flags |= SerialDQCmd;
+      if(anyNonzeroTorque) flags |= SerialTorqueCmd;
     }
     else if(mode == ActuatorCommand::TORQUE) {
       //cout<<"Sending torque command"<<endl;
-      c["torquecmd"] = torquecmd;
+      flags = SerialTorqueCmd;
     }
     else {
       cout<<"SerialControlledRobot: Invalid mode?? "<<mode<<endl;
+      return;
+    }
+
+    const Config& q = klamptRobotModel->q;
+    const Config& dq = klamptRobotModel->dq;
+    if(binary) {
+      //the controller writes binary sensor data, so it accepts binary
+      //commands too
+      commandValues.resize(0);
+      if(flags & SerialQCmd)
+	for(int i=0;i<q.n;i++) commandValues.push_back(q[i]);
+      if(flags & SerialDQCmd)
+	for(int i=0;i<dq.n;i++) commandValues.push_back(dq[i]);
+      if(flags & SerialTorqueCmd)
+	commandValues.insert(commandValues.end(),torqueBuffer.begin(),torqueBuffer.end());
+      if(flags & SerialTCmd)
+	commandValues.push_back(timeStep);
+      WriteSerialBinaryMessage(SerialCommand,flags,commandValues,messageBuffer);
+      controllerPipe->Send(messageBuffer);
+      return;
+    }
+
+    AnyCollection c;
+    if(flags & SerialQCmd) {
+      AnyCollection qcmd;
+      qcmd.resize(q.n);
+      for(int i=0;i<q.n;i++)
+	qcmd[i] = q[i];
+      c["qcmd"] = qcmd;
+    }
+    if(flags & SerialDQCmd) {
+      AnyCollection dqcmd;
+      dqcmd.resize(dq.n);
+      for(int i=0;i<dq.n;i++)
+	dqcmd[i] = dq[i];
+      c["dqcmd"] = dqcmd;
+    }
+    if(flags & SerialTorqueCmd) {
+      AnyCollection torquecmd;
+      torquecmd.resize(torqueBuffer.size());
+      for(size_t i=0;i<torqueBuffer.size();i++)
+	torquecmd[(int)i] = torqueBuffer[i];
+      c["torquecmd"] = torquecmd;
     }
+    if(flags & SerialTCmd)
+      c["tcmd"] = timeStep;
     //write JSON message to socket file
     stringstream ss;
     c.write(ss);
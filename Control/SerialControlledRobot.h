@@ -2,14 +2,19 @@
 #define SERIAL_CONTROLLED_ROBOT_H
 
 #include "ControlledRobot.h"
-#include <KrisLibrary/utils/AsyncIO.h>
+#include "SerialProtocol.h"
+#include "MessagePipe.h"
 
 /** @brief A Klamp't controlled robot that communicates to a robot (either
  * real or virtual) using the Klamp't controller serialization mechanism.
- * Acts as a client connecting to the given host.
+ * Acts as a client connecting to the given host, which is either a socket
+ * address or shm://name for a SharedMemoryPipe.
  *
  * You usually use this if you want to set up a Klamp't C++ controller
  * running as a standalone program to communicate with SimTest.
+ *
+ * If the robot writes binary sensor data (see SerialController's binary
+ * setting), commands are written back in binary as well.
  */
 class SerialControlledRobot : public ControlledRobot
 {
@@ -29,14 +34,24 @@ class SerialControlledRobot : public ControlledRobot
   void SetMutex(Mutex* controllerMutex);
   virtual void ReadSensorData(RobotSensors& sensors);
   virtual void WriteCommandData(const RobotMotorCommand& command);
+  void ReadBinarySensorData(RobotSensors& sensors,const string& msg);
  
   string host;
-  SmartPointer<SocketPipeWorker> controllerPipe;
+  SmartPointer<MessagePipe> controllerPipe;
   Real robotTime;
   Real timeStep;
   int numOverruns;
   bool stopFlag;
   Mutex* controllerMutex;
+
+  //binary protocol state.  binary is true if the last sensor message was
+  //binary.  The buffers are reused between messages.
+  bool binary;
+  SerialSensorSchema schema;
+  vector<SensorBase*> schemaSensors;  ///<the sensor of each schema channel, or NULL
+  int staleSensorMessages;  ///<binary sensor messages received since the schema was missed
+  vector<double> sensorValues,channelValues,commandValues,torqueBuffer;
+  string messageBuffer;
 };
 
 #endif
@@ -2,9 +2,10 @@
 #include <KrisLibrary/utils/threadutils.h>
 #include <KrisLibrary/utils/AnyCollection.h>
 #include <signal.h>
+#include <algorithm>
 
 SerialController::SerialController(Robot& robot,const string& _servAddr,Real _writeRate)
-  :RobotController(robot),servAddr(_servAddr),writeRate(_writeRate),lastWriteTime(0),endVCmdTime(-1)
+  :RobotController(robot),servAddr(_servAddr),writeRate(_writeRate),binary(false),lastWriteTime(0),endVCmdTime(-1),schemaSent(false)
 {
   //HACK: is this where the sigpipe ignore should be?
 #ifndef WIN32
@@ -44,6 +45,75 @@ void SerialController::PackSensorData(AnyCollection& data)
   }
 }
 
+//the channels that precede the sensors in binary sensor messages
+static const char* kCommandChannels[4] = {"t","dt","qcmd","dqcmd"};
+
+bool SerialController::PackSensorData(SerialSensorSchema& layout,vector<double>& values)
+{
+  values.resize(0);
+  channelSizes.resize(0);
+  values.push_back(time);
+  channelSizes.push_back(1);
+  values.push_back(1.0/writeRate);
+  channelSizes.push_back(1);
+
+  bool isPID = true;
+  for(size_t i=0;i<command->actuators.size();i++) {
+    if(command->actuators[i].mode != ActuatorCommand::PID)
+      isPID = false;
+  }
+  //qcmd and dqcmd are always channels, but are empty if not in PID mode
+  if(isPID) {
+    GetCommandedConfig(tempConfig);
+    channelSizes.push_back(tempConfig.n);
+    for(int k=0;k<tempConfig.n;k++) values.push_back(tempConfig(k));
+    GetCommandedVelocity(tempConfig);
+    channelSizes.push_back(tempConfig.n);
+    for(int k=0;k<tempConfig.n;k++) values.push_back(tempConfig(k));
+  }
+  else {
+    channelSizes.push_back(0);
+    channelSizes.push_back(0);
+  }
+
+  for(size_t i=0;i<sensors->sensors.size();i++) {
+    sensors->sensors[i]->GetMeasurements(tempMeasurements);
+    channelSizes.push_back((int)tempMeasurements.size());
+    values.insert(values.end(),tempMeasurements.begin(),tempMeasurements.end());
+  }
+
+  //the names are compared in place, and only copied if the layout changed
+  bool changed = (layout.NumChannels() != (int)channelSizes.size());
+  for(int i=0;i<(int)channelSizes.size() && !changed;i++) {
+    if(layout.ChannelSize(i) != channelSizes[i]) changed = true;
+    else if(i < 4) changed = (layout.names[i] != kCommandChannels[i]);
+    else changed = (layout.names[i] != sensors->sensors[i-4]->name);
+  }
+  if(!changed) return false;
+  layout.Clear();
+  for(int i=0;i<(int)channelSizes.size();i++) {
+    if(i < 4) layout.Add(kCommandChannels[i],channelSizes[i]);
+    else layout.Add(sensors->sensors[i-4]->name,channelSizes[i]);
+  }
+  return true;
+}
+
+void SerialController::WriteBinarySensorData()
+{
+  if(PackSensorData(schema,sensorValues)) {
+    schema.id++;
+    schemaSent = false;
+  }
+  if(!schemaSent) {
+    string msg;
+    schema.Write(msg);
+    controllerPipe->Send(msg);
+    schemaSent = true;
+  }
+  WriteSerialBinaryMessage(SerialSensorData,schema.id,sensorValues,messageBuffer);
+  controllerPipe->Send(messageBuffer);
+}
+
 void SerialController::Update(Real dt)
 {
   RobotController::Update(dt);
@@ -70,17 +140,63 @@ void SerialController::Update(Real dt)
       printf("Warning, next write time %g is less than controller update time %g\n",lastWriteTime+1.0/writeRate,time);
       lastWriteTime = time;
     }
-    AnyCollection sensorData;
-    PackSensorData(sensorData);
-    stringstream ss;
-    ss << sensorData;
-    if(controllerPipe && controllerPipe->transport->WriteReady()) {
-      controllerPipe->Send(ss.str());
+    if(binary) {
+      if(controllerPipe && controllerPipe->WriteReady())
+        WriteBinarySensorData();
+    }
+    else {
+      AnyCollection sensorData;
+      PackSensorData(sensorData);
+      stringstream ss;
+      ss << sensorData;
+      if(controllerPipe && controllerPipe->WriteReady()) {
+        controllerPipe->Send(ss.str());
+      }
     }
   }
   if(controllerPipe && controllerPipe->UnreadCount() > 0) {
-    string scmd = controllerPipe->Newest();
+    //read the messages in order so that no schema request is dropped, and
+    //keep only the newest command
+    string scmd;
+    while(controllerPipe->UnreadCount() > 0) {
+      string msg = controllerPipe->Next();
+      if(msg.empty()) break;
+      if(!IsSerialBinaryMessage(msg) && msg.find("getschema") != string::npos) {
+        AnyCollection c;
+        if(c.read(msg.c_str()) && c.find("getschema") != NULL) {
+          //the client missed the schema of the binary sensor messages
+          schemaSent = false;
+          continue;
+        }
+      }
+      scmd.swap(msg);
+    }
     if(scmd.empty()) return;
+    if(IsSerialBinaryMessage(scmd)) {
+      int type,flags;
+      if(!ReadSerialBinaryMessage(scmd,type,flags,commandValues) || type != SerialCommand) {
+	fprintf(stderr,"SerialController: Unable to parse incoming binary message\n");
+	return;
+      }
+      //split the values into the commands given by flags
+      int n = robot.q.n, nd = (int)robot.drivers.size();
+      int expected = ((flags & SerialQCmd) ? n : 0) + ((flags & SerialDQCmd) ? n : 0) + ((flags & SerialTorqueCmd) ? nd : 0) + ((flags & SerialTCmd) ? 1 : 0);
+      if((int)commandValues.size() != expected) {
+	fprintf(stderr,"SerialController: binary command of wrong size: %d vs %d\n",(int)commandValues.size(),expected);
+	return;
+      }
+      vector<double>::const_iterator v = commandValues.begin();
+      qcmdBuffer.resize(0);
+      dqcmdBuffer.resize(0);
+      torquecmdBuffer.resize(0);
+      Real tcmd = 0;
+      if(flags & SerialQCmd) { qcmdBuffer.assign(v,v+n); v += n; }
+      if(flags & SerialDQCmd) { dqcmdBuffer.assign(v,v+n); v += n; }
+      if(flags & SerialTorqueCmd) { torquecmdBuffer.assign(v,v+nd); v += nd; }
+      if(flags & SerialTCmd) tcmd = *v;
+      ApplyCommand(flags,qcmdBuffer,dqcmdBuffer,torquecmdBuffer,tcmd);
+      return;
+    }
     AnyCollection cmd;
     if(!cmd.read(scmd.c_str())) {
       fprintf(stderr,"SerialController: Unable to parse incoming message \"%s\"\n",scmd.c_str());
@@ -94,91 +210,96 @@ void SerialController::Update(Real dt)
     SmartPointer<AnyCollection> dqcmdptr = cmd.find("dqcmd");
     SmartPointer<AnyCollection> torquecmdptr = cmd.find("torquecmd");
     SmartPointer<AnyCollection> tcmdptr = cmd.find("tcmd");
+    int flags = 0;
+    vector<Real> qcmd,dqcmd,torquecmd;
+    Real tcmd = 0;
     if(qcmdptr) {
-      endVCmdTime = -1;
-      vcmd.clear();
-      vector<Real> qcmd,dqcmd,torquecmd;
+      flags |= SerialQCmd;
       if(!qcmdptr->asvector(qcmd)) {
 	fprintf(stderr,"SerialController: qcmd not of proper type\n");
 	return;
       }
-      if(dqcmdptr) {
-	if(!dqcmdptr->asvector(dqcmd)) {
-	  fprintf(stderr,"SerialController: dqcmd not of proper type\n");
-	  return;
-	}
-      }
-      else
-	dqcmd.resize(qcmd.size(),0);
-      if(torquecmdptr) {
-	if(!torquecmdptr->asvector(torquecmd)) {
-	  fprintf(stderr,"SerialController: torquecmd not of proper type\n");
-	  return;
-	}
-      }
-      if(qcmd.size() != robot.q.n) {
-	fprintf(stderr,"SerialController: position command of wrong size: %d vs %d \n",(int)qcmd.size(),robot.q.n);
-	return;
-      }
-      if(!dqcmd.empty() && (dqcmd.size() != robot.dq.n)) {
-	fprintf(stderr,"SerialController: velocity command of wrong size: %d vs %d \n",(int)dqcmd.size(),robot.q.n);
-	return;
-      }
-      if(!torquecmd.empty() && (torquecmd.size() != robot.drivers.size())) {
-	fprintf(stderr,"SerialController: torque command of wrong size: %d vs %d \n",(int)torquecmd.size(),(int)robot.drivers.size());
-	return;
-      }
-
-      //everything checks out -- now send the command
-      if(torquecmd.empty()) {
-	SetPIDCommand(qcmd,dqcmd);
-      }
-      else
-	SetFeedforwardPIDCommand(qcmd,dqcmd,torquecmd);
     }
-    else if(dqcmdptr) {
-      if(tcmdptr == NULL) {
-	fprintf(stderr,"SerialController: dqcmd not given with tcmd\n");
-	return;
-      }
-      vector<Real> dqcmd;
+    if(dqcmdptr) {
+      flags |= SerialDQCmd;
       if(!dqcmdptr->asvector(dqcmd)) {
 	fprintf(stderr,"SerialController: dqcmd not of proper type\n");
 	return;
       }
-      Real tcmd;
-      if(!tcmdptr->as(tcmd)) {
-	fprintf(stderr,"SerialController: tcmd not of proper type\n");
-	return;
-      }
-      if(dqcmd.size() != robot.dq.n) {
-	fprintf(stderr,"SerialController: velocity command of wrong size: %d vs %d \n",(int)dqcmd.size(),robot.q.n);
-	return;
-      }
-      endVCmdTime = time + tcmd;
-      vcmd = dqcmd;
     }
-    else if(torquecmdptr) {
-      endVCmdTime = -1;
-      vcmd.clear();
-      vector<Real> torquecmd;
+    if(torquecmdptr) {
+      flags |= SerialTorqueCmd;
       if(!torquecmdptr->asvector(torquecmd)) {
 	fprintf(stderr,"SerialController: torquecmd not of proper type\n");
 	return;
       }
-      if(!torquecmd.empty() && (torquecmd.size() != robot.drivers.size())) {
-	fprintf(stderr,"SerialController: torque command of wrong size: %d vs %d \n",(int)torquecmd.size(),(int)robot.drivers.size());
+    }
+    if(tcmdptr) {
+      flags |= SerialTCmd;
+      if(!tcmdptr->as(tcmd)) {
+	fprintf(stderr,"SerialController: tcmd not of proper type\n");
 	return;
       }
-
-      SetTorqueCommand(torquecmd);
     }
-    else {
-      fprintf(stderr,"SerialController: message doesn't contain proper command type (qcmd, dqcmd, or torquecmd)\n");
+    if(!ApplyCommand(flags,qcmd,dqcmd,torquecmd,tcmd) && !(flags & (SerialQCmd|SerialDQCmd|SerialTorqueCmd)))
       cout<<"   Message: "<<scmd<<endl;
-      return;
+  }
+}
+
+bool SerialController::ApplyCommand(int flags,const vector<Real>& qcmd,vector<Real>& dqcmd,const vector<Real>& torquecmd,Real tcmd)
+{
+  if(flags & SerialQCmd) {
+    endVCmdTime = -1;
+    vcmd.clear();
+    if(!(flags & SerialDQCmd))
+      dqcmd.resize(qcmd.size(),0);
+    if(qcmd.size() != robot.q.n) {
+      fprintf(stderr,"SerialController: position command of wrong size: %d vs %d \n",(int)qcmd.size(),robot.q.n);
+      return false;
+    }
+    if(!dqcmd.empty() && (dqcmd.size() != robot.dq.n)) {
+      fprintf(stderr,"SerialController: velocity command of wrong size: %d vs %d \n",(int)dqcmd.size(),robot.q.n);
+      return false;
+    }
+    if(!torquecmd.empty() && (torquecmd.size() != robot.drivers.size())) {
+      fprintf(stderr,"SerialController: torque command of wrong size: %d vs %d \n",(int)torquecmd.size(),(int)robot.drivers.size());
+      return false;
+    }
+
+    //everything checks out -- now send the command
+    if(torquecmd.empty()) {
+      SetPIDCommand(qcmd,dqcmd);
+    }
+    else
+      SetFeedforwardPIDCommand(qcmd,dqcmd,torquecmd);
+  }
+  else if(flags & SerialDQCmd) {
+    if(!(flags & SerialTCmd)) {
+      fprintf(stderr,"SerialController: dqcmd not given with tcmd\n");
+      return false;
     }
+    if(dqcmd.size() != robot.dq.n) {
+      fprintf(stderr,"SerialController: velocity command of wrong size: %d vs %d \n",(int)dqcmd.size(),robot.q.n);
+      return false;
+    }
+    endVCmdTime = time + tcmd;
+    vcmd = dqcmd;
+  }
+  else if(flags & SerialTorqueCmd) {
+    endVCmdTime = -1;
+    vcmd.clear();
+    if(!torquecmd.empty() && (torquecmd.size() != robot.drivers.size())) {
+      fprintf(stderr,"SerialController: torque command of wrong size: %d vs %d \n",(int)torquecmd.size(),(int)robot.drivers.size());
+      return false;
+    }
+
+    SetTorqueCommand(torquecmd);
   }
+  else {
+    fprintf(stderr,"SerialController: message doesn't contain proper command type (qcmd, dqcmd, or torquecmd)\n");
+    return false;
+  }
+  return true;
 }
 
 void SerialController::Reset()
@@ -186,6 +307,7 @@ void SerialController::Reset()
   RobotController::Reset();
   lastWriteTime = 0;
   endVCmdTime = -1;
+  schemaSent = false;
 }
 
 map<string,string> SerialController::Settings() const
@@ -193,6 +315,7 @@ map<string,string> SerialController::Settings() const
   map<string,string> settings;
   FILL_CONTROLLER_SETTING(settings,servAddr);
   FILL_CONTROLLER_SETTING(settings,writeRate);
+  FILL_CONTROLLER_SETTING(settings,binary);
   if(controllerPipe) {
     settings["listening"]="1";
   }
@@ -206,6 +329,7 @@ bool SerialController::GetSetting(const string& name,string& str) const
 {
   READ_CONTROLLER_SETTING(servAddr)
   READ_CONTROLLER_SETTING(writeRate)
+  READ_CONTROLLER_SETTING(binary)
   if(name=="listening") {
     if(controllerPipe)
       str = "1";
@@ -225,6 +349,12 @@ bool SerialController::SetSetting(const string& name,const string& str)
     return true;
   }
   WRITE_CONTROLLER_SETTING(writeRate)  
+  if(name == "binary") {
+    stringstream ss(str);
+    ss >> binary;
+    schemaSent = false;
+    return bool(ss);
+  }
   return false;
 }
 
@@ -235,12 +365,13 @@ bool SerialController::OpenConnection(const string& addr)
     CloseConnection();
     return true;
   }
-  controllerPipe = new SocketPipeWorker(addr.c_str(),true);
+  controllerPipe = MakeMessagePipe(addr,true,0);
   if(!controllerPipe->Start()) {
     cout<<"Controller could not be opened on address "<<addr<<endl;
     return false;
   }
   cout<<"Opened controller on address "<<addr<<endl;
+  schemaSent = false;
   return true;
 }
 
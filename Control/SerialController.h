@@ -2,7 +2,8 @@
 #define SERIAL_CONTROLLER_H
 
 #include "Controller.h"
-#include <KrisLibrary/utils/AsyncIO.h>
+#include "SerialProtocol.h"
+#include "MessagePipe.h"
 
 class AnyCollection;
 
@@ -27,10 +28,19 @@ class AnyCollection;
  * Command data is read opportunistically.  Sensor data is written at a given
  * writeRate (in Hz)
  *
+ * If the binary setting is 1, sensor data is instead written in the binary
+ * framing of SerialProtocol.h.  A JSON schema message listing the channels
+ * is sent before the first binary message and whenever the channels change
+ * size, and again if the client sends {"getschema":1}.  Commands may be
+ * given either in JSON or as binary command messages.
+ *
  * Settings include
- * - servAddr: socket address.  Set to "" for no connection.
+ * - servAddr: socket address, or shm://name to serve over a
+ *   SharedMemoryPipe, which is much faster when the client is on the same
+ *   machine.  Set to "" for no connection.
  * - connected: 1 if connected (can only be gotten), 0 if disconnected
  * - writeRate: rate at which sensor data is written.
+ * - binary: 1 to write binary sensor data, 0 for JSON (default)
  */
 class SerialController : public RobotController
 {
@@ -47,16 +57,34 @@ public:
   bool OpenConnection(const string& servaddr);
   bool CloseConnection();
   void PackSensorData(AnyCollection& data);
+  ///Packs the sensor data into a flat array of values.  layout is only
+  ///rebuilt if the channels changed since the last call, in which case
+  ///true is returned.
+  bool PackSensorData(SerialSensorSchema& layout,vector<double>& values);
+  void WriteBinarySensorData();
+  ///Applies a command whose parts are given by a combination of the
+  ///SerialQCmd... flags.  Returns false if the command is invalid.
+  bool ApplyCommand(int flags,const vector<Real>& qcmd,vector<Real>& dqcmd,const vector<Real>& torquecmd,Real tcmd);
 
   string servAddr;
   Real writeRate;
+  bool binary;
   Real lastWriteTime;
-  SmartPointer<SocketPipeWorker> controllerPipe;
+  SmartPointer<MessagePipe> controllerPipe;
 
   //for fixed-velocity commands, these are an accumulator that processes
   //the linearly increasing configuration
   Config vcmd;
   Real endVCmdTime;
+
+  //binary protocol state.  The buffers are reused between messages.
+  SerialSensorSchema schema;
+  bool schemaSent;
+  vector<int> channelSizes;
+  vector<double> sensorValues,tempMeasurements,commandValues;
+  vector<Real> qcmdBuffer,dqcmdBuffer,torquecmdBuffer;
+  Config tempConfig;
+  string messageBuffer;
 };
 
 
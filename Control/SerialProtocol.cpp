@@ -0,0 +1,98 @@
+#include "SerialProtocol.h"
+#include <KrisLibrary/utils/AnyCollection.h>
+#include <sstream>
+#include <string.h>
+#include <limits.h>
+
+const static char kBinaryMagic[4] = {'K','B','I','N'};
+const static size_t kBinaryHeaderSize = 4+3*sizeof(int);
+
+bool IsSerialBinaryMessage(const string& msg)
+{
+  return msg.length() >= kBinaryHeaderSize && memcmp(msg.data(),kBinaryMagic,4)==0;
+}
+
+void WriteSerialBinaryMessage(int type,int tag,const vector<double>& values,string& msg)
+{
+  int header[3] = {type,tag,(int)values.size()};
+  msg.resize(kBinaryHeaderSize+values.size()*sizeof(double));
+  char* data = &msg[0];
+  memcpy(data,kBinaryMagic,4);
+  memcpy(data+4,header,sizeof(header));
+  if(!values.empty())
+    memcpy(data+kBinaryHeaderSize,&values[0],values.size()*sizeof(double));
+}
+
+bool ReadSerialBinaryMessage(const string& msg,int& type,int& tag,vector<double>& values)
+{
+  if(!IsSerialBinaryMessage(msg)) return false;
+  int header[3];
+  memcpy(header,msg.data()+4,sizeof(header));
+  if(header[2] < 0 || msg.length() != kBinaryHeaderSize+header[2]*sizeof(double)) return false;
+  type = header[0];
+  tag = header[1];
+  values.resize(header[2]);
+  if(!values.empty())
+    memcpy(&values[0],msg.data()+kBinaryHeaderSize,values.size()*sizeof(double));
+  return true;
+}
+
+SerialSensorSchema::SerialSensorSchema()
+  :id(0)
+{
+  offsets.push_back(0);
+}
+
+void SerialSensorSchema::Clear()
+{
+  names.resize(0);
+  offsets.resize(1);
+}
+
+void SerialSensorSchema::Add(const string& name,int size)
+{
+  names.push_back(name);
+  offsets.push_back(offsets.back()+size);
+}
+
+void SerialSensorSchema::Write(string& msg) const
+{
+  AnyCollection c;
+  c["schema"] = id;
+  AnyCollection cnames,csizes;
+  cnames.resize(names.size());
+  csizes.resize(names.size());
+  for(size_t i=0;i<names.size();i++) {
+    cnames[(int)i] = names[i];
+    csizes[(int)i] = ChannelSize((int)i);
+  }
+  c["names"] = cnames;
+  c["sizes"] = csizes;
+  stringstream ss;
+  c.write(ss);
+  msg = ss.str();
+}
+
+bool SerialSensorSchema::Read(AnyCollection& c)
+{
+  SmartPointer<AnyCollection> cid = c.find("schema");
+  SmartPointer<AnyCollection> cnames = c.find("names");
+  SmartPointer<AnyCollection> csizes = c.find("sizes");
+  if(!cid || !cnames || !csizes) return false;
+  int newid;
+  vector<int> sizes;
+  if(!cid->as(newid) || !csizes->asvector(sizes) || cnames->size() != sizes.size()) return false;
+  //validate everything before changing the current schema
+  vector<string> newnames(sizes.size());
+  int total = 0;
+  for(size_t i=0;i<sizes.size();i++) {
+    if(!(*cnames)[(int)i].as(newnames[i])) return false;
+    if(sizes[i] < 0 || sizes[i] > INT_MAX-total) return false;
+    total += sizes[i];
+  }
+  id = newid;
+  Clear();
+  for(size_t i=0;i<sizes.size();i++)
+    Add(newnames[i],sizes[i]);
+  return true;
+}
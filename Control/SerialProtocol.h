@@ -0,0 +1,64 @@
+#ifndef SERIAL_PROTOCOL_H
+#define SERIAL_PROTOCOL_H
+
+#include <vector>
+#include <string>
+using namespace std;
+
+class AnyCollection;
+
+/** @file SerialProtocol.h
+ * @ingroup Control
+ * @brief The optional binary framing used by SerialController and
+ * SerialControlledRobot.
+ *
+ * A binary message is the 4 bytes "KBIN" followed by three 32-bit integers
+ * (type, tag, count) and count doubles, all in host byte order, so both
+ * ends must run on machines of the same endianness.  Since JSON messages
+ * start with '{', the two kinds of messages can share a connection.
+ *
+ * Sensor messages (type SerialSensorData) have the id of a
+ * SerialSensorSchema as their tag.  The schema is sent beforehand as a JSON
+ * message, and lists the name and number of values of each channel.
+ * Command messages (type SerialCommand) have a combination of the
+ * SerialQCmd... flags as their tag, and list the values of qcmd, dqcmd,
+ * torquecmd, and tcmd, in that order, for each flag that is set.
+ */
+
+enum { SerialSensorData=0, SerialCommand=1 };
+enum { SerialQCmd=1, SerialDQCmd=2, SerialTorqueCmd=4, SerialTCmd=8 };
+
+///Returns true if msg is a binary message
+bool IsSerialBinaryMessage(const string& msg);
+///Encodes a binary message into msg, reusing its storage
+void WriteSerialBinaryMessage(int type,int tag,const vector<double>& values,string& msg);
+///Decodes a binary message, reusing the storage of values.  Returns false
+///if msg is not a valid binary message.
+bool ReadSerialBinaryMessage(const string& msg,int& type,int& tag,vector<double>& values);
+
+/** @ingroup Control
+ * @brief The layout of the values of a binary sensor message.  Channel i
+ * holds values [offsets[i],offsets[i+1]).
+ */
+class SerialSensorSchema
+{
+ public:
+  SerialSensorSchema();
+  void Clear();
+  void Add(const string& name,int size);
+  int NumChannels() const { return (int)names.size(); }
+  int Size() const { return offsets.back(); }
+  int ChannelSize(int i) const { return offsets[i+1]-offsets[i]; }
+  ///Writes the JSON message {"schema":id,"names":[...],"sizes":[...]}
+  void Write(string& msg) const;
+  ///Reads the schema from a parsed JSON message.  Returns false, leaving
+  ///the schema unchanged, if c is not a valid schema message, e.g., if a
+  ///size is negative.
+  bool Read(AnyCollection& c);
+
+  int id;
+  vector<string> names;
+  vector<int> offsets;
+};
+
+#endif
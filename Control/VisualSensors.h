@@ -2,6 +2,7 @@
 #define CONTROL_VISUAL_SENSORS_H
 
 #include "Sensor.h"
+#include "Modeling/WorldBVH.h"
 #include <KrisLibrary/camera/viewport.h>
 #include <KrisLibrary/math3d/primitives.h>
 using namespace Math3D;
@@ -28,11 +29,24 @@ class LaserRangeSensor : public SensorBase
   virtual const char* Type() const { return "LaserRangeSensor"; }
   virtual void Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim);
   virtual void SimulateKinematic(Robot& robot,RobotWorld& world);
+  virtual bool UsesWorldModel() const { return true; }
+  virtual void PrepareWorldModel(ControlledRobotSimulator* robot,WorldSimulation* sim);
+  virtual void SimulateUpdated(ControlledRobotSimulator* robot,WorldSimulation* sim,bool concurrent);
+  ///Adds the depth noise to the readings of SimulateUpdated
+  virtual void FinishSimulate(ControlledRobotSimulator* robot,WorldSimulation* sim);
+  virtual bool IsThreadSafe() const { return true; }
+  ///Casts the sweep on the given number of threads, assuming world.bvh is
+  ///up to date.  The readings are noise-free until ProcessReadings is
+  ///called.
+  void Sweep(Robot& robot,RobotWorld& world,int threads);
+  ///Adds depth noise to the readings and clamps them to the depth range
+  void ProcessReadings();
   virtual void Advance(double dt);
   virtual void Reset();
   virtual void MeasurementNames(vector<string>& names) const;
   virtual void GetMeasurements(vector<double>& values) const;
   virtual void SetMeasurements(const vector<double>& values);
+  virtual void GetMeasurementViews(vector<SensorMeasurementView>& views);
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
@@ -56,11 +70,16 @@ class LaserRangeSensor : public SensorBase
   int xSweepType;
   Real ySweepMagnitude,ySweepPeriod,ySweepPhase;
   int ySweepType; 
+  bool ignoreSelf;  ///< if true, the robot's own links are invisible to the sensor (default true)
+  int numThreads;   ///< threads used to cast each sweep (default 1, <= 0 uses all hardware threads)
 
   //simulated depth readings
   vector<double> depthReadings;
   //internal state
   Real last_dt,last_t;
+  vector<Ray3D> rays;
+  vector<WorldBVH::Hit> hits;
+  vector<char> ignoreIDs;
 };
 
 
@@ -76,11 +95,19 @@ class LaserRangeSensor : public SensorBase
  * The format of the measurements list is a list of rgb[i,j] pixels if rgb=true, 
  * then followed by a list of d[i,j] pixels giving depth in meters (or whatever unit
  * you are generally using) if depth=true.  The rgb pixels are given as casts from
- * unsigned integers in the pixel format ABGR to doubles.  The depth pixels are given
- * as floats.
+ * unsigned integers in the pixel format ABGR to doubles, i.e., 0xAABBGGRR, with
+ * alpha always 0xff.  The depth pixels are given as floats.
+ *
+ * Note: earlier versions did not match this format.  OpenGL renders gave
+ * 0xRRGGBBAA and ray cast renders gave 0xAARRGGBB; code that unpacked those
+ * layouts must now read red from the low byte and blue from bits 16-23.
  *
  * The list of measurements proceeds in scan-line order from the upper-left pixel.
  *
+ * Internally the image is stored as 8-bit RGB triples and float depths,
+ * which GetMeasurementViews returns without copying as "rgb" (yres x xres x 3
+ * uint8) and "depth" (yres x xres float32) views.
+ *
  * For optimal performance using the graphics card, you must install the GLEW package
  * on your system.
  */
@@ -92,10 +119,27 @@ class CameraSensor : public SensorBase
   virtual const char* Type() const { return "CameraSensor"; }
   virtual void Simulate(ControlledRobotSimulator* robot,WorldSimulation* sim);
   virtual void SimulateKinematic(Robot& robot,RobotWorld& world);
+  virtual bool UsesWorldModel() const { return true; }
+  virtual void PrepareWorldModel(ControlledRobotSimulator* robot,WorldSimulation* sim);
+  virtual void SimulateUpdated(ControlledRobotSimulator* robot,WorldSimulation* sim,bool concurrent);
+  ///Fills in the images of a ray cast render
+  virtual void FinishSimulate(ControlledRobotSimulator* robot,WorldSimulation* sim);
+  ///Thread safe once the camera has fallen back to ray casting
+  virtual bool IsThreadSafe() const;
+  ///Renders the view, ray casting on the given number of threads if OpenGL
+  ///framebuffers are unavailable.  If refit is false, world.bvh must be up
+  ///to date.  A ray cast render only casts the rays; FinishRender fills in
+  ///the images.
+  void Render(Robot& robot,RobotWorld& world,bool refit,int threads);
+  ///Completes a ray cast render: looks up colors, adds depth noise, and
+  ///updates the texture drawn by DrawGL.  Does nothing after an OpenGL
+  ///render.
+  void FinishRender(RobotWorld& world);
   virtual void Reset();
   virtual void MeasurementNames(vector<string>& names) const;
   virtual void GetMeasurements(vector<double>& values) const;
   virtual void SetMeasurements(const vector<double>& values);
+  virtual void GetMeasurementViews(vector<SensorMeasurementView>& views);
   virtual map<string,string> Settings() const;
   virtual bool GetSetting(const string& name,string& str) const;
   virtual bool SetSetting(const string& name,const string& str);
@@ -112,13 +156,20 @@ class CameraSensor : public SensorBase
   int zresolution;  ///< resolution in z direction
   double zvarianceLinear;  ///< variance in z estimates, linear term
   double zvarianceConstant;  ///< variance in z estimates, constant term
+  int numRenderThreads;  ///< threads used by the ray casting renderer when OpenGL framebuffers are unavailable (default 1, <= 0 uses all hardware threads)
 
   //internal: used for OpenGL rendering / buffers
   bool useGLFramebuffers; 
   unsigned int color_tex,fb,depth_rb;
   vector<unsigned char> pixels;
   vector<float> floats;
-  vector<double> measurements;
+  vector<unsigned char> rgbImage;  ///< yres x xres x 3 RGB bytes, top row first
+  vector<float> depthImage;  ///< yres x xres depths, top row first
+  //internal: the hit world IDs and depths of a ray cast render, waiting
+  //for FinishRender
+  bool castPending;
+  vector<int> hitIDs;
+  vector<Real> hitDepths;
 };
 
 #endif 
@@ -0,0 +1,372 @@
+//64-bit file offsets for fseeko/ftello, so that logs may exceed 2GB
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif
+#include "ColumnLog.h"
+#include <string.h>
+#include <sys/types.h>
+
+const static char kHeaderMagic[4] = {'K','C','O','L'};
+const static char kChunkMagic[4] = {'C','H','N','K'};
+const static int kColumnLogVersion = 1;
+const static unsigned char kZeroCode = 0x88;
+
+typedef unsigned long long uint64;
+
+inline uint64 DoubleBits(double x)
+{
+  uint64 bits;
+  memcpy(&bits,&x,sizeof(double));
+  return bits;
+}
+
+inline double BitsDouble(uint64 bits)
+{
+  double x;
+  memcpy(&x,&bits,sizeof(double));
+  return x;
+}
+
+void EncodeColumn(const double* values,int n,int stride,vector<unsigned char>& out)
+{
+  uint64 prev = 0;
+  for(int i=0;i<n;i++) {
+    uint64 bits = DoubleBits(values[i*stride]);
+    uint64 x = bits ^ prev;
+    prev = bits;
+    if(x == 0) {
+      out.push_back(kZeroCode);
+      continue;
+    }
+    int lz=0,tz=0;
+    while(((x >> (8*(7-lz))) & 0xff) == 0) lz++;
+    while(((x >> (8*tz)) & 0xff) == 0) tz++;
+    out.push_back((unsigned char)(lz*16+tz));
+    for(int b=7-lz;b>=tz;b--)
+      out.push_back((unsigned char)((x >> (8*b)) & 0xff));
+  }
+}
+
+bool DecodeColumn(const unsigned char* data,int length,int n,vector<double>& values)
+{
+  uint64 prev = 0;
+  int pos = 0;
+  for(int i=0;i<n;i++) {
+    if(pos >= length) return false;
+    unsigned char code = data[pos++];
+    uint64 x = 0;
+    if(code != kZeroCode) {
+      int lz = code >> 4, tz = code & 0xf;
+      if(lz+tz >= 8) return false;
+      if(pos + 8-lz-tz > length) return false;
+      for(int b=7-lz;b>=tz;b--)
+        x |= ((uint64)data[pos++]) << (8*b);
+    }
+    prev ^= x;
+    values.push_back(BitsDouble(prev));
+  }
+  return pos == length;
+}
+
+static bool WriteInt(FILE* f,int x) { return fwrite(&x,sizeof(int),1,f)==1; }
+static bool ReadInt(FILE* f,int& x) { return fread(&x,sizeof(int),1,f)==1; }
+
+static bool WriteString(FILE* f,const string& s)
+{
+  if(!WriteInt(f,(int)s.length())) return false;
+  return s.empty() || fwrite(s.data(),1,s.length(),f)==s.length();
+}
+
+static bool ReadString(FILE* f,string& s)
+{
+  int n;
+  if(!ReadInt(f,n) || n < 0) return false;
+  s.resize(n);
+  return n==0 || fread(&s[0],1,n,f)==(size_t)n;
+}
+
+static bool FileSeek(FILE* f,long long pos,int whence=SEEK_SET)
+{
+#ifdef _MSC_VER
+  return _fseeki64(f,pos,whence)==0;
+#else
+  return fseeko(f,(off_t)pos,whence)==0;
+#endif //_MSC_VER
+}
+
+static long long FileTell(FILE* f)
+{
+#ifdef _MSC_VER
+  return _ftelli64(f);
+#else
+  return (long long)ftello(f);
+#endif //_MSC_VER
+}
+
+void* column_log_thread_func(void* ptr)
+{
+  ColumnLogWriter* writer = reinterpret_cast<ColumnLogWriter*>(ptr);
+  ColumnLogWriter::Chunk chunk;
+  while(true) {
+    {
+      ScopedLock lock(writer->mutex);
+      while(writer->queue.empty() && !writer->done)
+        writer->chunkQueued.wait(writer->mutex);
+      //the queue is emptied before quitting
+      if(writer->queue.empty()) break;
+      chunk.numRows = writer->queue.front().numRows;
+      chunk.values.swap(writer->queue.front().values);
+      writer->queue.pop_front();
+      writer->chunkTaken.signal();
+    }
+    writer->WriteChunk(chunk);
+  }
+  return NULL;
+}
+
+ColumnLogWriter::ColumnLogWriter()
+  :file(NULL),numColumns(0),rowsPerChunk(1024),maxQueuedChunks(16),done(false)
+{}
+
+ColumnLogWriter::~ColumnLogWriter()
+{
+  Close();
+}
+
+bool ColumnLogWriter::Open(const char* fn,const vector<string>& columnNames,const string& metadata,int _rowsPerChunk)
+{
+  Close();
+  file = fopen(fn,"wb");
+  if(!file) {
+    fprintf(stderr,"ColumnLogWriter: could not open %s for writing\n",fn);
+    return false;
+  }
+  numColumns = (int)columnNames.size();
+  rowsPerChunk = _rowsPerChunk;
+  bool ok = (fwrite(kHeaderMagic,1,4,file)==4);
+  ok = ok && WriteInt(file,kColumnLogVersion) && WriteInt(file,numColumns);
+  for(size_t i=0;i<columnNames.size() && ok;i++)
+    ok = WriteString(file,columnNames[i]);
+  ok = ok && WriteString(file,metadata);
+  if(!ok) {
+    fprintf(stderr,"ColumnLogWriter: error writing header to %s\n",fn);
+    fclose(file);
+    file = NULL;
+    return false;
+  }
+  fflush(file);
+  current.numRows = 0;
+  current.values.reserve(numColumns*rowsPerChunk);
+  done = false;
+  thread = ThreadStart(column_log_thread_func,this);
+  return true;
+}
+
+void ColumnLogWriter::Append(const vector<double>& row)
+{
+  if(!file) return;
+  if((int)row.size() != numColumns) {
+    fprintf(stderr,"ColumnLogWriter: row has %d values, expected %d\n",(int)row.size(),numColumns);
+    return;
+  }
+  current.values.insert(current.values.end(),row.begin(),row.end());
+  current.numRows++;
+  if(current.numRows >= rowsPerChunk) Flush();
+}
+
+void ColumnLogWriter::Flush()
+{
+  if(!file || current.numRows == 0) return;
+  {
+    ScopedLock lock(mutex);
+    //if the disk cannot keep up, wait rather than let the queue grow
+    while((int)queue.size() >= maxQueuedChunks)
+      chunkTaken.wait(mutex);
+    queue.push_back(Chunk());
+    queue.back().numRows = current.numRows;
+    queue.back().values.swap(current.values);
+    chunkQueued.signal();
+  }
+  current.numRows = 0;
+  current.values.reserve(numColumns*rowsPerChunk);
+}
+
+void ColumnLogWriter::Close()
+{
+  if(!file) return;
+  Flush();
+  {
+    ScopedLock lock(mutex);
+    done = true;
+    chunkQueued.signal();
+  }
+  ThreadJoin(thread);
+  fclose(file);
+  file = NULL;
+}
+
+void ColumnLogWriter::WriteChunk(const Chunk& chunk)
+{
+  bool ok = (fwrite(kChunkMagic,1,4,file)==4) && WriteInt(file,chunk.numRows);
+  for(int j=0;j<numColumns && ok;j++) {
+    buffer.resize(0);
+    EncodeColumn(&chunk.values[j],chunk.numRows,numColumns,buffer);
+    ok = WriteInt(file,(int)buffer.size()) && fwrite(&buffer[0],1,buffer.size(),file)==buffer.size();
+  }
+  if(!ok) fprintf(stderr,"ColumnLogWriter: error writing chunk\n");
+  //so that the log is readable up to here if the program dies
+  fflush(file);
+}
+
+
+
+ColumnLogReader::ColumnLogReader()
+  :file(NULL),numRows(0)
+{}
+
+ColumnLogReader::~ColumnLogReader()
+{
+  Close();
+}
+
+bool ColumnLogReader::Open(const char* fn)
+{
+  Close();
+  file = fopen(fn,"rb");
+  if(!file) {
+    fprintf(stderr,"ColumnLogReader: could not open %s\n",fn);
+    return false;
+  }
+  char magic[4];
+  int version,numColumns;
+  if(fread(magic,1,4,file)!=4 || memcmp(magic,kHeaderMagic,4)!=0) {
+    fprintf(stderr,"ColumnLogReader: %s is not a column log\n",fn);
+    Close();
+    return false;
+  }
+  if(!ReadInt(file,version) || version != kColumnLogVersion || !ReadInt(file,numColumns) || numColumns < 0) {
+    fprintf(stderr,"ColumnLogReader: %s has an invalid header\n",fn);
+    Close();
+    return false;
+  }
+  columnNames.resize(numColumns);
+  for(int i=0;i<numColumns;i++) {
+    if(!ReadString(file,columnNames[i])) {
+      fprintf(stderr,"ColumnLogReader: %s has an invalid header\n",fn);
+      Close();
+      return false;
+    }
+  }
+  if(!ReadString(file,metadata)) {
+    fprintf(stderr,"ColumnLogReader: %s has an invalid header\n",fn);
+    Close();
+    return false;
+  }
+  //find the chunks, stopping at the first incomplete one
+  FileSeek(file,0,SEEK_END);
+  long long fileSize = FileTell(file);
+  long long pos = 4+3*sizeof(int);
+  for(int i=0;i<numColumns;i++) pos += sizeof(int)+columnNames[i].length();
+  pos += metadata.length();
+  vector<int> lengths(numColumns);
+  while(true) {
+    FileSeek(file,pos);
+    int n;
+    if(fread(magic,1,4,file)!=4 || memcmp(magic,kChunkMagic,4)!=0) break;
+    if(!ReadInt(file,n) || n < 0) break;
+    long long start = pos+4+sizeof(int);
+    long long end = start;
+    bool complete = true;
+    for(int j=0;j<numColumns;j++) {
+      if(!ReadInt(file,lengths[j]) || lengths[j] < 0) { complete = false; break; }
+      end += sizeof(int)+lengths[j];
+      if(end > fileSize) { complete = false; break; }
+      FileSeek(file,end);
+    }
+    if(!complete) break;
+    chunkOffsets.push_back(start);
+    chunkSizes.push_back(end-start);
+    chunkRows.push_back(n);
+    for(int j=0;j<numColumns;j++) {
+      columnLengths.push_back(lengths[j]);
+      start += sizeof(int);
+      columnOffsets.push_back(start);
+      start += lengths[j];
+    }
+    numRows += n;
+    pos = end;
+  }
+  if(pos != fileSize)
+    fprintf(stderr,"ColumnLogReader: %s is truncated, read %d rows\n",fn,numRows);
+  return true;
+}
+
+void ColumnLogReader::Close()
+{
+  if(file) fclose(file);
+  file = NULL;
+  columnNames.resize(0);
+  metadata.clear();
+  numRows = 0;
+  chunkOffsets.resize(0);
+  chunkSizes.resize(0);
+  chunkRows.resize(0);
+  columnOffsets.resize(0);
+  columnLengths.resize(0);
+}
+
+int ColumnLogReader::ColumnIndex(const string& name) const
+{
+  for(size_t i=0;i<columnNames.size();i++)
+    if(columnNames[i] == name) return (int)i;
+  return -1;
+}
+
+bool ColumnLogReader::ReadColumn(int column,vector<double>& values)
+{
+  if(!file || column < 0 || column >= NumColumns()) return false;
+  values.resize(0);
+  values.reserve(numRows);
+  vector<unsigned char> buffer;
+  for(size_t i=0;i<chunkOffsets.size();i++) {
+    size_t k = i*NumColumns()+column;
+    int len = columnLengths[k];
+    buffer.resize(len);
+    if(!FileSeek(file,columnOffsets[k])) return false;
+    if(len > 0 && fread(&buffer[0],1,len,file)!=(size_t)len) return false;
+    if(!DecodeColumn(len > 0 ? &buffer[0] : NULL,len,chunkRows[i],values)) {
+      fprintf(stderr,"ColumnLogReader: corrupt data in column %s\n",columnNames[column].c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ColumnLogReader::ReadRows(vector<vector<double> >& rows)
+{
+  if(!file) return false;
+  rows.resize(numRows);
+  for(int i=0;i<numRows;i++) rows[i].resize(NumColumns());
+  //each chunk is read with one call, then its columns are decoded
+  vector<unsigned char> buffer;
+  vector<double> values;
+  int row = 0;
+  for(size_t i=0;i<chunkOffsets.size();i++) {
+    buffer.resize((size_t)chunkSizes[i]);
+    if(!FileSeek(file,chunkOffsets[i])) return false;
+    if(!buffer.empty() && fread(&buffer[0],1,buffer.size(),file)!=buffer.size()) return false;
+    for(int j=0;j<NumColumns();j++) {
+      size_t k = i*NumColumns()+j;
+      int len = columnLengths[k];
+      const unsigned char* data = &buffer[0] + (columnOffsets[k]-chunkOffsets[i]);
+      values.resize(0);
+      if(!DecodeColumn(len > 0 ? data : NULL,len,chunkRows[i],values)) {
+        fprintf(stderr,"ColumnLogReader: corrupt data in column %s\n",columnNames[j].c_str());
+        return false;
+      }
+      for(int r=0;r<chunkRows[i];r++) rows[row+r][j] = values[r];
+    }
+    row += chunkRows[i];
+  }
+  return true;
+}
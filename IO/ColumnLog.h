@@ -0,0 +1,111 @@
+#ifndef IO_COLUMN_LOG_H
+#define IO_COLUMN_LOG_H
+
+#include <KrisLibrary/utils/threadutils.h>
+#include <vector>
+#include <string>
+#include <list>
+#include <stdio.h>
+using namespace std;
+
+/** @file ColumnLog.h
+ * @brief A streaming, compressed, column-oriented log of numeric rows.
+ *
+ * File layout (integers are 32-bit, all values in host byte order):
+ * - header: "KCOL", version, number of columns, then the column names and
+ *   a free-form metadata string, each as a length followed by the bytes.
+ * - any number of chunks: "CHNK", number of rows n, then for each column
+ *   the length of its compressed data followed by the data.
+ *
+ * A column's data in a chunk holds its n values, each XORed with the bits
+ * of the previous value in the column.  Each XORed value is written as a
+ * control byte 16*lz+tz, where lz and tz are its numbers of leading and
+ * trailing zero bytes, followed by the remaining 8-lz-tz bytes
+ * (most significant first).  A zero is written as the single byte 0x88.
+ * Slowly changing signals therefore take a few bytes per value.
+ *
+ * Since chunks are self-contained, a log that was cut off (e.g., by a
+ * crash) can be read up to its last complete chunk.
+ */
+
+/** @ingroup IO
+ * @brief Writes a column log.  Rows are gathered into chunks, which are
+ * compressed and written to disk by a background thread, so Append()
+ * only copies the row.  At most maxQueuedChunks chunks wait to be written;
+ * if the disk falls further behind, Append() waits for it.
+ */
+class ColumnLogWriter
+{
+ public:
+  ColumnLogWriter();
+  ~ColumnLogWriter();
+  bool Open(const char* fn,const vector<string>& columnNames,const string& metadata=string(),int rowsPerChunk=1024);
+  bool IsOpen() const { return file != NULL; }
+  ///Adds a row, which must have one value per column
+  void Append(const vector<double>& row);
+  ///Sends the rows appended so far to the background thread
+  void Flush();
+  ///Flushes, waits for all chunks to be written, and closes the file
+  void Close();
+
+  //used internally
+  struct Chunk
+  {
+    int numRows;
+    vector<double> values;   //row-major
+  };
+  void WriteChunk(const Chunk& chunk);
+
+  FILE* file;
+  int numColumns,rowsPerChunk;
+  int maxQueuedChunks;     //chunks that may wait to be written before Flush blocks
+  Chunk current;
+  Thread thread;
+  Mutex mutex;
+  Condition chunkQueued,chunkTaken;
+  list<Chunk> queue;       //chunks waiting to be written, protected by mutex
+  bool done;               //tells the thread to quit, protected by mutex
+  vector<unsigned char> buffer;
+};
+
+/** @ingroup IO
+ * @brief Reads a column log written by ColumnLogWriter.
+ */
+class ColumnLogReader
+{
+ public:
+  ColumnLogReader();
+  ~ColumnLogReader();
+  ///Reads the header and scans the chunks
+  bool Open(const char* fn);
+  void Close();
+  int NumRows() const { return numRows; }
+  int NumColumns() const { return (int)columnNames.size(); }
+  ///Returns the index of the named column, or -1
+  int ColumnIndex(const string& name) const;
+  ///Reads all values of a column, decompressing only that column
+  bool ReadColumn(int column,vector<double>& values);
+  ///Reads all rows
+  bool ReadRows(vector<vector<double> >& rows);
+
+  FILE* file;
+  vector<string> columnNames;
+  string metadata;
+  int numRows;
+  //file offset of the data following each chunk's row count, the size of
+  //that data, and the chunk's row count
+  vector<long long> chunkOffsets,chunkSizes;
+  vector<int> chunkRows;
+  //file offset and length of the data of each column in each chunk,
+  //indexed by chunk*NumColumns()+column
+  vector<long long> columnOffsets;
+  vector<int> columnLengths;
+};
+
+///Encodes values as described in ColumnLog.h, appending to out
+void EncodeColumn(const double* values,int n,int stride,vector<unsigned char>& out);
+///Decodes n values, appending them to values.  Returns false if the data is
+///corrupt.
+bool DecodeColumn(const unsigned char* data,int length,int n,vector<double>& values);
+
+#endif
@@ -920,10 +920,9 @@ bool ROSPublishSensorMeasurement(const SensorBase* sensor,const Robot& robot,con
     if(frameprefix) 
       frame = string(frameprefix) + "/" + robot.name + "/" + robot.linkNames[camera->link];
     
-    vector<double> measurements;
-    camera->GetMeasurements(measurements);
-    if(measurements.empty()) return false;
-    if(camera->rgb) {
+    //copy straight from the camera's native image buffers
+    if(camera->rgbImage.empty() && camera->depthImage.empty()) return false;
+    if(!camera->rgbImage.empty()) {
       ROSPublisher<sensor_msgs::CameraInfo>* pubinfo = GetPublisher<sensor_msgs::CameraInfo>((string(topic)+"/rgb/camera_info").c_str());
       KlamptToROSCameraInfo(*camera,pubinfo->msg);
       pubinfo->msg.header.frame_id = frame;
@@ -935,35 +934,21 @@ bool ROSPublishSensorMeasurement(const SensorBase* sensor,const Robot& robot,con
       pub->msg.encoding = "rgb8";
       pub->msg.is_bigendian = IsBigEndian();
       pub->msg.step = pub->msg.width*3;
-      pub->msg.data.resize(camera->xres*camera->yres*3);
-      for(int i=0;i<camera->xres*camera->yres;i++) {
-        unsigned int abgr = (unsigned int)measurements[i];
-        unsigned char b = (abgr >> 16) & 0xff;
-        unsigned char g = (abgr >> 8) & 0xff;
-        unsigned char r = (abgr) & 0xff;
-        pub->msg.data[i*3]=r;
-        pub->msg.data[i*3+1]=g;
-        pub->msg.data[i*3+2]=b;
-      }
+      pub->msg.data.assign(camera->rgbImage.begin(),camera->rgbImage.end());
       pub->publish_current();
     }
-    if(camera->depth) {
+    if(!camera->depthImage.empty()) {
       ROSPublisher<sensor_msgs::CameraInfo>* pubinfo = GetPublisher<sensor_msgs::CameraInfo>((string(topic)+"/depth_registered/camera_info").c_str());
       KlamptToROSCameraInfo(*camera,pubinfo->msg);
       pubinfo->publish_current();
-      int ofs = 0;
-      if(camera->rgb) ofs = camera->xres*camera->yres;
       ROSPublisher<sensor_msgs::Image>* pub = GetPublisher<sensor_msgs::Image>((string(topic)+"/depth_registered/image_rect").c_str());
       pub->msg.width = camera->xres;
       pub->msg.height = camera->yres;
       pub->msg.encoding = "32FC1";
       pub->msg.is_bigendian = IsBigEndian();
       pub->msg.step = pub->msg.width*4;
-      pub->msg.data.resize(camera->xres*camera->yres*4);
-      for(int i=0;i<camera->xres*camera->yres;i++) {
-        double d = measurements[ofs+i];
-        *((float*)&pub->msg.data[i*4])=float(d);
-      }
+      pub->msg.data.resize(camera->depthImage.size()*sizeof(float));
+      memcpy(&pub->msg.data[0],&camera->depthImage[0],pub->msg.data.size());
       pub->publish_current();
     }
   }
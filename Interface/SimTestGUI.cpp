@@ -493,12 +493,15 @@ bool SimTestBackend::OnCommand(const string& cmd,const string& args)
   }
   else if(cmd=="log_sim") {
     simLogFile = args;
+    stateLog = NULL;
   }
   else if(cmd=="log_contact_state") {
     contactStateLogFile = args;
+    contactStateLog = NULL;
   }
   else if(cmd=="log_contact_wrenches") {
     contactWrenchLogFile = args;
+    contactWrenchLog = NULL;
   }
   else if(cmd=="log_commanded_path") {
     int robot;
@@ -54,6 +54,8 @@ struct SensorPlot
  * - load_view(file): loads a previously saved view (inherited from GLNavigationProgram)
  * - save_view(file): saves a view to a file (inherited from GLNavigationProgram)
  * - log_sim(file): saves simulation log to a given file, or "" to set no logging.
+ *   Files ending in .klog are written as column logs (see IO/ColumnLog.h), as
+ *   are the contact state and contact wrench logs.
  * - log_commanded_path(robot,file): saves commanded path to a given linear path file, or "" to set no logging.
  * - log_sensed_path(robot,file): saves actual path to a given linear path file, or "" to set no logging.
  * - log_torque_path(robot,file): saves applied torques as a linear path file, or "" to set no logging.
@@ -21,6 +21,12 @@
 #include <iomanip>
 using namespace GLDraw;
 
+static bool IsColumnLogFile(const char* fn)
+{
+  const char* ext = FileExtension(fn);
+  return ext && 0==strcmp(ext,"klog");
+}
+
 typedef LoggingController MyController;
 typedef PolynomialPathController MyMilestoneController;
 
@@ -800,6 +806,16 @@ bool SimGUIBackend::OutputROS(const char* prefix)
 
 void SimGUIBackend::DoLogging(const char* fn)
 {
+  if(IsColumnLogFile(fn)) {
+    if(stateLog.Empty() || stateLogFile != fn) {
+      cout<<"Saving simulation state to "<<fn<<endl;
+      stateLogFile = fn;
+      stateLog = new SimulationStateLogger(sim);
+      if(!stateLog->Open(fn)) return;
+    }
+    stateLog->Log();
+    return;
+  }
   ofstream out(fn,ios::app);
   if(out.tellp()==std::streamoff(0)) {
     cout<<"Saving simulation state to "<<fn<<endl;
@@ -908,11 +924,29 @@ void SimGUIBackend::DoStateLogging_LinearPath(int robot,const char* fn)
 
 void SimGUIBackend::DoContactStateLogging(const char* fn)
 {
-  ofstream out(fn,ios::app);
-  if(out.tellp()==std::streamoff(0)) {
-    cout<<"Saving simulation contact state to "<<fn<<endl;
-    out<<"time,body1,body2,contact"<<endl;
+  bool columnLog = IsColumnLogFile(fn);
+  ofstream out;
+  if(columnLog) {
+    if(contactStateLog.Empty() || contactStateLogFile != fn) {
+      cout<<"Saving simulation contact state to "<<fn<<endl;
+      contactStateLogFile = fn;
+      vector<string> names(4);
+      names[0]="time"; names[1]="body1"; names[2]="body2"; names[3]="contact";
+      contactStateLog = new ColumnLogWriter;
+      if(!contactStateLog->Open(fn,names,SimulationLogMetadata(*world,"contact_state"))) return;
+    }
+    if(!contactStateLog->IsOpen()) return;
   }
+  else {
+    out.open(fn,ios::app);
+    if(out.tellp()==std::streamoff(0)) {
+      cout<<"Saving simulation contact state to "<<fn<<endl;
+      out<<"time,body1,body2,contact"<<endl;
+    }
+  }
+  //each transition is a list of contact values, logged in order
+  vector<int> transitions;
+  vector<double> row(4);
   for(WorldSimulation::ContactFeedbackMap::iterator i=sim.contactFeedback.begin();i!=sim.contactFeedback.end();i++) {
     int aid = sim.ODEToWorldID(i->first.first);
     int bid = sim.ODEToWorldID(i->first.second);
@@ -920,23 +954,32 @@ void SimGUIBackend::DoContactStateLogging(const char* fn)
     bool hadSeparation = sim.HadSeparation(aid,bid);
     bool nowInContact = sim.InContact(aid,bid);
     bool wasInContact = (inContact.count(pair<int,int>(aid,bid)) != 0);
+    transitions.resize(0);
     if(wasInContact && nowInContact) {
       if(hadSeparation) { //must have separated and contacted within the last time step
-	out<<sim.time<<","<<world->GetName(aid)<<","<<world->GetName(bid)<<","<<0<<endl;
-	out<<sim.time<<","<<world->GetName(aid)<<","<<world->GetName(bid)<<","<<1<<endl;
+	transitions.push_back(0);
+	transitions.push_back(1);
       }
     }
     else if(!wasInContact && !nowInContact) {
       if(hadContact) { //must have contacted and separated witihn the last time step
-	out<<sim.time<<","<<world->GetName(aid)<<","<<world->GetName(bid)<<","<<1<<endl;
-	out<<sim.time<<","<<world->GetName(aid)<<","<<world->GetName(bid)<<","<<0<<endl;
+	transitions.push_back(1);
+	transitions.push_back(0);
       }
     }
     else if(wasInContact && !nowInContact) {
-      out<<sim.time<<","<<world->GetName(aid)<<","<<world->GetName(bid)<<","<<0<<endl;
+      transitions.push_back(0);
     }
     else if(!wasInContact && nowInContact) {
-      out<<sim.time<<","<<world->GetName(aid)<<","<<world->GetName(bid)<<","<<1<<endl;
+      transitions.push_back(1);
+    }
+    for(size_t k=0;k<transitions.size();k++) {
+      if(columnLog) {
+	row[0] = sim.time; row[1] = aid; row[2] = bid; row[3] = transitions[k];
+	contactStateLog->Append(row);
+      }
+      else
+	out<<sim.time<<","<<world->GetName(aid)<<","<<world->GetName(bid)<<","<<transitions[k]<<endl;
     }
     if(nowInContact)
       inContact.insert(pair<int,int>(aid,bid));
@@ -947,6 +990,16 @@ void SimGUIBackend::DoContactStateLogging(const char* fn)
 
 void SimGUIBackend::DoContactWrenchLogging(const char* fn)
 {
+  if(IsColumnLogFile(fn)) {
+    if(contactWrenchLog.Empty() || contactWrenchLogFile != fn) {
+      cout<<"Saving simulation contact wrenches to "<<fn<<endl;
+      contactWrenchLogFile = fn;
+      contactWrenchLog = new SimulationContactLogger(sim);
+      if(!contactWrenchLog->Open(fn)) return;
+    }
+    contactWrenchLog->Log();
+    return;
+  }
   ofstream out(fn,ios::app);
   if(out.tellp()==std::streamoff(0)) {
     cout<<"Saving simulation contact wrenches to "<<fn<<endl;
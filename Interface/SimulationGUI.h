@@ -2,7 +2,9 @@
 #define SIMULATION_GUI_H
 
 #include "Simulation/WorldSimulation.h"
+#include "Simulation/SimulationLogger.h"
 #include "WorldGUI.h"
+#include <KrisLibrary/utils/SmartPointer.h>
 #include <set>
 
 /** @brief Generic simulation program.
@@ -43,6 +45,13 @@ public:
 
   ///the contact state on the last DoContactStateLogging call
   set<pair<int,int> > inContact;
+  ///column logs used by the Do*Logging functions for .klog files, and
+  ///the files they write to.  Each is opened on the first call, and opened
+  ///again if the file name changes.
+  SmartPointer<SimulationStateLogger> stateLog;
+  SmartPointer<ColumnLogWriter> contactStateLog;
+  SmartPointer<SimulationContactLogger> contactWrenchLog;
+  string stateLogFile,contactStateLogFile,contactWrenchLogFile;
 
   SimGUIBackend(RobotWorld* world)
     :WorldGUIBackend(world),simulate(0)
@@ -117,7 +126,8 @@ public:
   ///Outputs simulation data to ROS with the given prefix
   bool OutputROS(const char* prefix="klampt");
 
-  ///Logs the state of all objects in the world to the given CSV file
+  ///Logs the state of all objects in the world to the given CSV file, or
+  ///to a column log (see IO/ColumnLog.h) if fn ends in .klog
   void DoLogging(const char* fn="simtest_log.csv");
 
   ///Logs the robot's commands to the given linear path file
@@ -129,10 +139,13 @@ public:
   ///Logs the robot's simulation state to the given linear path file
   void DoStateLogging_LinearPath(int robot,const char* fn="simtest_state_log.path");
 
-  ///Logs contact changes to the given CSV file
+  ///Logs contact changes to the given CSV file, or to a column log with
+  ///the columns time, body1, body2, contact if fn ends in .klog.  In the
+  ///column log, bodies are given by world ID.
   void DoContactStateLogging(const char* fn="simtest_contact_log.csv");
 
-  ///Logs contact wrenches to the given CSV file
+  ///Logs contact wrenches to the given CSV file, or to a column log if fn
+  ///ends in .klog (see SimulationContactLogger)
   void DoContactWrenchLogging(const char* fn="simtest_wrench_log.csv");
 };
 
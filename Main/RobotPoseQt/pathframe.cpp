@@ -90,6 +90,7 @@ void PathFrame::SetDuration()
     else {
       multipath->path.SetDuration(value);
     }
+    multipath->MarkChanged();
     double minTime = multipath->path.sections.front().times.front();
     double maxTime = multipath->path.sections.back().times.back();
     ui->playFrame->UpdatePlayerTimeRange(minTime,maxTime);
@@ -0,0 +1,50 @@
+#ifndef MODELING_ATOMIC_H
+#define MODELING_ATOMIC_H
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif //_MSC_VER
+
+///Declares a thread-local variable of plain old data type (C++98 has no
+///thread_local keyword)
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif //_MSC_VER
+
+///Atomically sets *ptr to value and returns the old value, with a full
+///memory barrier
+inline int AtomicExchange(volatile int* ptr,int value)
+{
+#ifdef _MSC_VER
+  return (int)_InterlockedExchange((volatile long*)ptr,(long)value);
+#else
+  //__sync_lock_test_and_set is only an acquire barrier
+  __sync_synchronize();
+  return __sync_lock_test_and_set(ptr,value);
+#endif //_MSC_VER
+}
+
+///Atomically reads *ptr, with a full memory barrier
+inline int AtomicLoad(volatile int* ptr)
+{
+#ifdef _MSC_VER
+  return (int)_InterlockedOr((volatile long*)ptr,0);
+#else
+  return __sync_fetch_and_add(ptr,0);
+#endif //_MSC_VER
+}
+
+///Atomically adds value to *ptr and returns the old value, with a full
+///memory barrier
+inline int AtomicAdd(volatile int* ptr,int value)
+{
+#ifdef _MSC_VER
+  return (int)_InterlockedExchangeAdd((volatile long*)ptr,(long)value);
+#else
+  return __sync_fetch_and_add(ptr,value);
+#endif //_MSC_VER
+}
+
+#endif
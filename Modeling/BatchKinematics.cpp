@@ -0,0 +1,139 @@
+#include "BatchKinematics.h"
+#include "ParallelFor.h"
+#include <algorithm>
+
+BatchKinematics::BatchKinematics()
+  :numThreads(0),blockSize(64)
+{}
+
+BatchKinematics::BatchKinematics(const RobotKinematics3D& _robot)
+  :numThreads(0),blockSize(64),robot(_robot)
+{}
+
+void BatchKinematics::SetRobot(const RobotKinematics3D& _robot)
+{
+  robot = _robot;
+  threadRobotsCurrent.assign(threadRobots.size(),false);
+}
+
+int BatchKinematics::AddQuery(int link,const Vector3& p)
+{
+  links.push_back(link);
+  points.push_back(p);
+  //rebuild the update order: mark the ancestors of all queried links, then
+  //sort them by depth so that each parent is updated before its children
+  vector<bool> marked(robot.links.size(),false);
+  for(size_t i=0;i<links.size();i++)
+    for(int j=links[i];j>=0 && !marked[j];j=robot.parents[j])
+      marked[j] = true;
+  vector<pair<int,int> > depthLinks;
+  for(size_t i=0;i<marked.size();i++) {
+    if(!marked[i]) continue;
+    int depth=0;
+    for(int j=robot.parents[i];j>=0;j=robot.parents[j]) depth++;
+    depthLinks.push_back(pair<int,int>(depth,(int)i));
+  }
+  sort(depthLinks.begin(),depthLinks.end());
+  updateOrder.resize(depthLinks.size());
+  for(size_t i=0;i<depthLinks.size();i++)
+    updateOrder[i] = depthLinks[i].second;
+  return (int)links.size()-1;
+}
+
+void BatchKinematics::ClearQueries()
+{
+  links.resize(0);
+  points.resize(0);
+  updateOrder.resize(0);
+}
+
+struct BatchKinematicsBody : public ParallelForBody
+{
+  BatchKinematicsBody(BatchKinematics& _batch,const Real* _qs,size_t _N,Real* _out,bool _jacobians)
+    :batch(_batch),qs(_qs),N(_N),out(_out),jacobians(_jacobians)
+  {}
+
+  virtual void Run(int block,int thread)
+  {
+    RobotKinematics3D& robot = (thread == 0 ? batch.robot : batch.threadRobots[thread-1]);
+    Matrix& J = batch.jacobianTemps[thread];
+    size_t n = robot.links.size();
+    size_t nq = batch.links.size();
+    size_t start = size_t(block)*size_t(batch.blockSize);
+    size_t end = Min(start+size_t(batch.blockSize),N);
+    for(size_t i=start;i<end;i++) {
+      robot.q.copy(qs+i*n);
+      for(size_t k=0;k<batch.updateOrder.size();k++)
+        robot.UpdateSelectedFrames(batch.updateOrder[k],batch.updateOrder[k]);
+      if(jacobians) {
+        Real* Ji = out + i*nq*6*n;
+        for(size_t k=0;k<nq;k++) {
+          robot.GetFullJacobian(batch.points[k],batch.links[k],J);
+          for(int r=0;r<6;r++)
+            for(size_t c=0;c<n;c++)
+              *(Ji++) = J(r,(int)c);
+        }
+      }
+      else {
+        Real* Ti = out + i*nq*16;
+        for(size_t k=0;k<nq;k++) {
+          const RigidTransform& T = robot.links[batch.links[k]].T_World;
+          for(int r=0;r<3;r++) {
+            Ti[r*4] = T.R(r,0);
+            Ti[r*4+1] = T.R(r,1);
+            Ti[r*4+2] = T.R(r,2);
+            Ti[r*4+3] = T.t[r];
+          }
+          Ti[12] = Ti[13] = Ti[14] = 0.0;
+          Ti[15] = 1.0;
+          Ti += 16;
+        }
+      }
+    }
+  }
+
+  BatchKinematics& batch;
+  const Real* qs;
+  size_t N;
+  Real* out;
+  bool jacobians;
+};
+
+int BatchKinematics::PrepareThreads(size_t N)
+{
+  size_t numBlocks = (N+blockSize-1)/blockSize;
+  int threads = ResolveNumThreads(numThreads);
+  if(size_t(threads) > numBlocks) threads = (int)Max(numBlocks,size_t(1));
+  if((int)threadRobots.size() < threads-1) {
+    threadRobots.resize(threads-1);
+    threadRobotsCurrent.resize(threads-1,false);
+  }
+  for(int i=0;i+1<threads;i++) {
+    if(!threadRobotsCurrent[i]) {
+      threadRobots[i] = robot;
+      threadRobotsCurrent[i] = true;
+    }
+  }
+  if((int)jacobianTemps.size() < threads) jacobianTemps.resize(threads);
+  return threads;
+}
+
+void BatchKinematics::Run(const Real* qs,size_t N,Real* out,bool jacobians)
+{
+  if(N == 0) return;
+  if(blockSize < 1) blockSize = 1;
+  int threads = PrepareThreads(N);
+  size_t numBlocks = (N+blockSize-1)/blockSize;
+  BatchKinematicsBody body(*this,qs,N,out,jacobians);
+  ParallelFor((int)numBlocks,body,threads);
+}
+
+void BatchKinematics::Transforms(const Real* qs,size_t N,Real* T)
+{
+  Run(qs,N,T,false);
+}
+
+void BatchKinematics::Jacobians(const Real* qs,size_t N,Real* J)
+{
+  Run(qs,N,J,true);
+}
@@ -0,0 +1,76 @@
+#ifndef MODELING_BATCH_KINEMATICS_H
+#define MODELING_BATCH_KINEMATICS_H
+
+#include <KrisLibrary/robotics/RobotKinematics3D.h>
+#include <vector>
+using namespace std;
+
+/** @ingroup Modeling
+ * @brief Evaluates link transforms and Jacobians of a robot at many
+ * configurations at once, using several threads.
+ *
+ * Add the links (and for Jacobians, the local points) of interest with
+ * AddQuery, then call Transforms or Jacobians on a row-major N x n array of
+ * configurations.  Only the queried links and their ancestors are updated
+ * for each configuration, rather than the whole robot.
+ *
+ * Each thread works on its own copy of the kinematic chain, so the robot
+ * passed to the constructor or SetRobot is never modified.  The first
+ * thread uses the robot member, and the other threads' copies are made only
+ * when they are needed.  A BatchKinematics that is kept between calls
+ * reuses its copies, and SetRobot refreshes them by assignment, which does
+ * not allocate for a robot of the same size.
+ *
+ * Configurations are handed out in blocks of blockSize to keep the
+ * per-item overhead small, and no more threads are used than there are
+ * blocks, so small batches run on the calling thread.  Results are written
+ * into per-configuration slots, so they do not depend on the number of
+ * threads.
+ */
+class BatchKinematics
+{
+ public:
+  BatchKinematics();
+  BatchKinematics(const RobotKinematics3D& robot);
+  ///Replaces the kinematic chain.  The queries are kept.
+  void SetRobot(const RobotKinematics3D& robot);
+  ///Adds a query for the given link.  p is the point (in local
+  ///coordinates) whose Jacobian is computed.  Returns the query index.
+  int AddQuery(int link,const Vector3& p=Vector3(0.0));
+  void ClearQueries();
+  int NumQueries() const { return (int)links.size(); }
+  int NumDofs() const { return (int)robot.links.size(); }
+  ///Evaluates the world transforms of the queried links at the N
+  ///configurations in qs (an N x NumDofs() row-major array).  T is filled
+  ///with the N x NumQueries() 4x4 row-major homogeneous matrices.
+  void Transforms(const Real* qs,size_t N,Real* T);
+  ///Evaluates the 6 x NumDofs() Jacobians of the queried points (orientation
+  ///rows on top of position rows, as in RobotKinematics3D::GetFullJacobian)
+  ///at the N configurations in qs.  J is filled with the N x NumQueries()
+  ///row-major matrices.
+  void Jacobians(const Real* qs,size_t N,Real* J);
+
+  //settings
+  int numThreads;           ///< <= 0 uses all hardware threads
+  int blockSize;            ///< number of configurations per work item
+
+  RobotKinematics3D robot;
+  vector<int> links;
+  vector<Vector3> points;
+  ///The queried links and their ancestors, parents first
+  vector<int> updateOrder;
+  ///The copies of the robot used by threads 1,2,..., and whether each is
+  ///up to date with robot
+  vector<RobotKinematics3D> threadRobots;
+  vector<bool> threadRobotsCurrent;
+  ///Temporary Jacobian storage for each thread
+  vector<Matrix> jacobianTemps;
+
+ private:
+  //returns the number of threads to use for N configurations, and makes
+  //sure that each of them has a current robot copy
+  int PrepareThreads(size_t N);
+  void Run(const Real* qs,size_t N,Real* out,bool jacobians);
+};
+
+#endif
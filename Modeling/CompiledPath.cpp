@@ -0,0 +1,177 @@
+#include "CompiledPath.h"
+#include <algorithm>
+
+int TimeCursor::Find(const vector<Real>& times,Real t)
+{
+  int last = (int)times.size()-2;
+  if(last < 0) return 0;
+  if(segment < 0 || segment > last) segment = 0;
+  //check the last segment and the one after it
+  if(times[segment] <= t && t < times[segment+1]) return segment;
+  if(segment+1 <= last && times[segment+1] <= t && t < times[segment+2]) {
+    segment++;
+    return segment;
+  }
+  if(t < times[0]) segment = 0;
+  else if(t >= times[last+1]) segment = last;
+  else segment = Min((int)(upper_bound(times.begin(),times.end(),t)-times.begin())-1,last);
+  return segment;
+}
+
+CompiledPath::CompiledPath()
+  :dim(0)
+{}
+
+void CompiledPath::Clear()
+{
+  dim = 0;
+  times.resize(0);
+  milestones.resize(0);
+  tangents.resize(0);
+  cursor.segment = 0;
+}
+
+void CompiledPath::Compile(const vector<Real>& _times,const vector<Vector>& _milestones)
+{
+  Assert(_times.size() == _milestones.size());
+  Clear();
+  if(_milestones.empty()) return;
+  dim = _milestones[0].n;
+  times = _times;
+  milestones.resize(_milestones.size()*dim);
+  for(size_t i=0;i<_milestones.size();i++) {
+    Assert(_milestones[i].n == dim);
+    _milestones[i].getCopy(&milestones[i*dim]);
+  }
+}
+
+//Appends the param-scaled Hermite tangents of segment c of a MultiPath
+//section, matching the tangents used by MultiPath::Evaluate
+static void AppendSectionTangents(const MultiPath::PathSection& section,int c,Real duration,vector<Real>& tangents)
+{
+  const vector<Vector>& x = section.milestones;
+  int n = x[c].n;
+  size_t start = tangents.size();
+  tangents.resize(start+2*n);
+  Real* m0 = &tangents[start];
+  Real* m1 = m0+n;
+  if(!section.velocities.empty()) {
+    Real scale = (section.times.empty() ? 1.0 : duration);
+    for(int k=0;k<n;k++) {
+      m0[k] = section.velocities[c](k)*scale;
+      m1[k] = section.velocities[c+1](k)*scale;
+    }
+    return;
+  }
+  bool hasPrev = (c > 0), hasNext = (c+2 < (int)x.size());
+  for(int k=0;k<n;k++) {
+    m0[k] = (hasPrev ? 0.5*(x[c+1](k)-x[c-1](k)) : x[c+1](k)-x[c](k));
+    m1[k] = (hasNext ? 0.5*(x[c+2](k)-x[c](k)) : x[c+1](k)-x[c](k));
+  }
+}
+
+bool CompiledPath::Compile(const MultiPath& path,MultiPath::InterpPolicy policy)
+{
+  Clear();
+  if(path.sections.empty() || path.sections[0].milestones.empty()) return false;
+  bool timed = path.HasTiming(0);
+  for(size_t s=0;s<path.sections.size();s++) {
+    if(path.HasTiming(s) != timed) return false;
+    if(path.sections[s].milestones.size() < 2) return false;
+  }
+  dim = path.sections[0].milestones[0].n;
+  int numSections = (int)path.sections.size();
+  for(int s=0;s<numSections;s++) {
+    const MultiPath::PathSection& section = path.sections[s];
+    int m = (int)section.milestones.size();
+    for(int j=0;j<m;j++) {
+      if(section.milestones[j].n != dim) {
+        Clear();
+        return false;
+      }
+      if(timed) times.push_back(section.times[j]);
+      else times.push_back((s + Real(j)/(m-1))/numSections);
+      size_t start = milestones.size();
+      milestones.resize(start+dim);
+      section.milestones[j].getCopy(&milestones[start]);
+    }
+    if(policy == MultiPath::InterpCubic) {
+      //the zero-duration segment joining this section to the previous one
+      if(s > 0) tangents.resize(tangents.size()+2*dim,0.0);
+      size_t first = times.size()-m;
+      for(int c=0;c+1<m;c++)
+        AppendSectionTangents(section,c,times[first+c+1]-times[first+c],tangents);
+    }
+  }
+  return true;
+}
+
+int CompiledPath::Locate(Real t,Real& u)
+{
+  Assert(times.size() >= 2);
+  int i = cursor.Find(times,t);
+  Real h = times[i+1]-times[i];
+  u = (h > 0 ? Clamp((t-times[i])/h,0.0,1.0) : 1.0);
+  return i;
+}
+
+void CompiledPath::Eval(Real t,Real* q)
+{
+  Assert(!times.empty());
+  if(times.size() == 1) {
+    for(int k=0;k<dim;k++) q[k] = milestones[k];
+    return;
+  }
+  Real u;
+  int i = Locate(t,u);
+  const Real* p0 = &milestones[i*dim];
+  const Real* p1 = p0+dim;
+  if(tangents.empty()) {
+    for(int k=0;k<dim;k++) q[k] = p0[k] + u*(p1[k]-p0[k]);
+    return;
+  }
+  const Real* m0 = &tangents[2*i*dim];
+  const Real* m1 = m0+dim;
+  Real u2 = u*u, u3 = u2*u;
+  Real h00 = 2*u3-3*u2+1, h10 = u3-2*u2+u, h01 = -2*u3+3*u2, h11 = u3-u2;
+  for(int k=0;k<dim;k++)
+    q[k] = h00*p0[k] + h10*m0[k] + h01*p1[k] + h11*m1[k];
+}
+
+void CompiledPath::Deriv(Real t,Real* dq)
+{
+  Assert(!times.empty());
+  //constant outside the path, as in MultiPath::Evaluate
+  bool outside = (times.size() == 1 || t < times.front() || t > times.back());
+  int i = (outside ? -1 : cursor.Find(times,t));
+  Real h = (i < 0 ? 0.0 : times[i+1]-times[i]);
+  if(h <= 0) {
+    for(int k=0;k<dim;k++) dq[k] = 0;
+    return;
+  }
+  const Real* p0 = &milestones[i*dim];
+  const Real* p1 = p0+dim;
+  Real u = Clamp((t-times[i])/h,0.0,1.0);
+  if(tangents.empty()) {
+    for(int k=0;k<dim;k++) dq[k] = (p1[k]-p0[k])/h;
+    return;
+  }
+  const Real* m0 = &tangents[2*i*dim];
+  const Real* m1 = m0+dim;
+  Real u2 = u*u;
+  Real d00 = 6*u2-6*u, d10 = 3*u2-4*u+1, d01 = -6*u2+6*u, d11 = 3*u2-2*u;
+  for(int k=0;k<dim;k++)
+    dq[k] = (d00*p0[k] + d10*m0[k] + d01*p1[k] + d11*m1[k])/h;
+}
+
+void CompiledPath::Eval(Real t,Vector& q)
+{
+  if(q.n != dim) q.resize(dim);
+  Eval(t,q.getStart());
+}
+
+void CompiledPath::Deriv(Real t,Vector& dq)
+{
+  if(dq.n != dim) dq.resize(dim);
+  Deriv(t,dq.getStart());
+}
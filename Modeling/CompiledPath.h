@@ -0,0 +1,86 @@
+#ifndef MODELING_COMPILED_PATH_H
+#define MODELING_COMPILED_PATH_H
+
+#include "MultiPath.h"
+#include <vector>
+using namespace std;
+
+/** @ingroup Modeling
+ * @brief Finds the segment of a sorted time array that contains a given
+ * time, remembering the last segment found.
+ *
+ * Streaming playback queries times that increase slowly, so the segment
+ * found last time (or the next one) is checked first.  Other queries fall
+ * back to a binary search, so every lookup is O(log n) in the worst case.
+ */
+class TimeCursor
+{
+ public:
+  TimeCursor() : segment(0) {}
+  ///Returns the index i of the segment [times[i],times[i+1]] containing t,
+  ///clamped to the range [0,times.size()-2].  If t lies on a milestone
+  ///time, the later segment is returned.
+  int Find(const vector<Real>& times,Real t);
+
+  int segment;
+};
+
+/** @ingroup Modeling
+ * @brief A timed path stored in flat contiguous arrays, for fast repeated
+ * evaluation.
+ *
+ * Milestones (and the tangents of cubic paths) are stored row-major in a
+ * single array each, rather than as one Vector per milestone.  Evaluation
+ * finds the segment with a TimeCursor and writes directly into the output,
+ * so Eval/Deriv do not allocate once the output has the right size.
+ *
+ * Interpolation is Cartesian, as in MultiPath::Evaluate without a CSpace.
+ * A compiled MultiPath follows MultiPath::Evaluate: untimed sections are
+ * spread uniformly over [0,1], cubic segments use the milestone
+ * velocities if present and Catmull-Rom tangents otherwise.  Each section
+ * boundary appears as a zero-duration segment.
+ *
+ * PolynomialMotionQueue does not use this: its path is edited by every
+ * Append/Cut command, its dimensions have separate breakpoints, and
+ * Advance already trims the passed segments, so a compiled copy would be
+ * rebuilt more often than it is evaluated.
+ */
+class CompiledPath
+{
+ public:
+  CompiledPath();
+  ///Compiles a piecewise linear path, e.g., a LinearPath
+  void Compile(const vector<Real>& times,const vector<Vector>& milestones);
+  ///Compiles a MultiPath, using linear or cubic interpolation as in
+  ///MultiPath::Evaluate.  Returns false if the path is empty or mixes
+  ///timed and untimed sections.
+  bool Compile(const MultiPath& path,MultiPath::InterpPolicy policy=MultiPath::InterpCubic);
+  void Clear();
+  bool Empty() const { return times.empty(); }
+  int NumMilestones() const { return (int)times.size(); }
+  Real StartTime() const { return times.front(); }
+  Real EndTime() const { return times.back(); }
+  ///Writes the configuration at time t into q, which must have dim
+  ///elements.  Times outside the path are clamped to its ends.
+  void Eval(Real t,Real* q);
+  ///Writes the derivative at time t into dq, which must have dim elements.
+  ///The derivative is zero outside [StartTime(),EndTime()].
+  void Deriv(Real t,Real* dq);
+  ///Returns the index i of the segment containing t and sets u to the
+  ///parameter in [0,1] of t along it.  Requires at least 2 milestones.
+  int Locate(Real t,Real& u);
+  void Eval(Real t,Vector& q);
+  void Deriv(Real t,Vector& dq);
+
+  int dim;
+  vector<Real> times;
+  ///The milestones, NumMilestones() x dim
+  vector<Real> milestones;
+  ///For cubic paths, the start and end tangents of each segment, scaled to
+  ///the segment's [0,1] parameter.  Segment i's start tangent starts at
+  ///2*i*dim and its end tangent at (2*i+1)*dim.  Empty for linear paths.
+  vector<Real> tangents;
+  TimeCursor cursor;
+};
+
+#endif
@@ -31,6 +31,7 @@
 #include "DynamicPath.h"
 #include <KrisLibrary/Timer.h>
 #include "Config.h"
+#include "ParallelFor.h"
 #include <KrisLibrary/math/math.h>
 #include <KrisLibrary/math/infnan.h>
 #include <assert.h>
@@ -782,6 +783,221 @@ int DynamicPath::Shortcut(int numIters,RampFeasibilityChecker& check,RandomNumbe
   return shortcuts;
 }
 
+ShortcutStats::ShortcutStats()
+{
+  Clear();
+}
+
+void ShortcutStats::Clear()
+{
+  numBatches = 0;
+  numCandidates = 0;
+  numFeasible = 0;
+  numShortcuts = 0;
+  numConflicts = 0;
+  checkTime = 0;
+  totalTime = 0;
+}
+
+void ShortcutStats::Print() const
+{
+  printf("Shortcutting: %d candidates in %d batches, %d feasible, %d applied, %d conflicts\n",numCandidates,numBatches,numFeasible,numShortcuts,numConflicts);
+  printf("  %g s checking, %g s total, %g candidates/s\n",checkTime,totalTime,(totalTime > 0 ? numCandidates/totalTime : 0.0));
+}
+
+//a candidate shortcut drawn for ParallelShortcut
+struct ShortcutCandidate
+{
+  Real t1,t2;
+  int i1,i2;
+  Real u1,u2;
+  bool feasible;
+  DynamicPath intermediate;
+};
+
+//Solves for and checks one candidate shortcut per work item
+struct ShortcutCheckBody : public ParallelForBody
+{
+  ShortcutCheckBody(const DynamicPath& _path,vector<ShortcutCandidate>& _candidates,const vector<RampFeasibilityChecker*>& _checks)
+    :path(_path),candidates(_candidates),checks(_checks)
+  {}
+  virtual void Run(int index,int thread)
+  {
+    ShortcutCandidate& c = candidates[index];
+    Vector x0,x1,dx0,dx1;
+    path.ramps[c.i1].Evaluate(c.u1,x0);
+    path.ramps[c.i2].Evaluate(c.u2,x1);
+    path.ramps[c.i1].Derivative(c.u1,dx0);
+    path.ramps[c.i2].Derivative(c.u2,dx1);
+    c.feasible = c.intermediate.SolveMinTime(x0,dx0,x1,dx1);
+    if(!c.feasible) return;
+    for(size_t i=0;i<c.intermediate.ramps.size();i++)
+      if(!checks[thread]->Check(c.intermediate.ramps[i])) {
+        c.feasible = false;
+        return;
+      }
+  }
+
+  const DynamicPath& path;
+  vector<ShortcutCandidate>& candidates;
+  const vector<RampFeasibilityChecker*>& checks;
+};
+
+//Finds the ramp containing time t, given the start times of each ramp
+static int GetRamp(const vector<Real>& rampStartTime,const vector<ParabolicRampND>& ramps,Real t,Real& u)
+{
+  int i = std::upper_bound(rampStartTime.begin(),rampStartTime.end(),t)-rampStartTime.begin()-1;
+  u = t-rampStartTime[i];
+  PARABOLIC_RAMP_ASSERT(u >= 0);
+  PARABOLIC_RAMP_ASSERT(u <= ramps[i].endTime+EpsilonT);
+  u = Min(u,ramps[i].endTime);
+  return i;
+}
+
+//Maps a time on the path a batch was checked against to the path after
+//the batch's shortcuts were applied.  Each shortcut replaced the window
+//[start,end] by a segment that is shift longer; times inside a window are
+//scaled into the segment that replaced it.
+static Real MapTime(Real t,const vector<Real>& start,const vector<Real>& end,const vector<Real>& shift)
+{
+  int inside = -1;
+  for(size_t j=0;j<start.size();j++)
+    if(t > start[j] && t < end[j]) inside = (int)j;
+  Real t0 = (inside >= 0 ? start[inside] : t);
+  Real offset = 0;
+  for(size_t j=0;j<start.size();j++)
+    if(end[j] <= t0) offset += shift[j];
+  if(inside < 0) return t+offset;
+  Real len = end[inside]-start[inside];
+  return t0+offset+(t-t0)*(len+shift[inside])/len;
+}
+
+int DynamicPath::ParallelShortcut(int numIters,const vector<RampFeasibilityChecker*>& checks,RandomNumberGeneratorBase* rng,ShortcutStats* stats)
+{
+  PARABOLIC_RAMP_ASSERT(!checks.empty());
+  Timer timer;
+  int numThreads = (int)checks.size();
+  int shortcuts = 0;
+  vector<Real> rampStartTime(ramps.size()); 
+  Real endTime=0;
+  for(size_t i=0;i<ramps.size();i++) {
+    rampStartTime[i] = endTime;
+    endTime += ramps[i].endTime;
+  }
+  vector<ShortcutCandidate> candidates(numThreads);
+  for(size_t i=0;i<candidates.size();i++) {
+    candidates[i].intermediate.Init(velMax,accMax);
+    if(!xMin.empty()) candidates[i].intermediate.SetJointLimits(xMin,xMax);
+  }
+  //time windows of the shortcuts applied in the current round, in the
+  //timing of the path the round was checked against, and the change in
+  //duration each one caused
+  vector<Real> appliedStart,appliedEnd,appliedShift;
+  vector<int> conflicts;
+  int iters=0;
+  while(iters < numIters) {
+    //draw a batch of candidates from the current path
+    int n=0;
+    while(n < numThreads && iters < numIters) {
+      iters++;
+      ShortcutCandidate& c = candidates[n];
+      c.t1=rng->Rand()*endTime;
+      c.t2=rng->Rand()*endTime;
+      if(c.t1 > c.t2) Swap(c.t1,c.t2);
+      c.i1 = GetRamp(rampStartTime,ramps,c.t1,c.u1);
+      c.i2 = GetRamp(rampStartTime,ramps,c.t2,c.u2);
+      if(c.i1 == c.i2) continue; //same ramp
+      n++;
+    }
+    //check the batch.  Feasible candidates that overlap a shortcut applied
+    //earlier in the round are checked again against the updated path in
+    //another round, until none are left.
+    while(n > 0) {
+      Timer checkTimer;
+      ShortcutCheckBody body(*this,candidates,checks);
+      ParallelFor(n,body,numThreads);
+      if(stats) {
+        stats->numBatches++;
+        stats->numCandidates += n;
+        stats->checkTime += checkTimer.ElapsedTime();
+      }
+
+      //apply the feasible candidates in order
+      appliedStart.resize(0);
+      appliedEnd.resize(0);
+      appliedShift.resize(0);
+      conflicts.resize(0);
+      for(int k=0;k<n;k++) {
+        const ShortcutCandidate& c = candidates[k];
+        if(!c.feasible) continue;
+        if(stats) stats->numFeasible++;
+        //the path outside of the applied windows is unchanged, just shifted
+        //in time
+        bool overlap = false;
+        Real shift = 0;
+        for(size_t j=0;j<appliedStart.size();j++) {
+          if(c.t2 > appliedStart[j] && c.t1 < appliedEnd[j]) { overlap = true; break; }
+          if(c.t1 >= appliedEnd[j]) shift += appliedShift[j];
+        }
+        if(overlap) {
+          if(stats) stats->numConflicts++;
+          conflicts.push_back(k);
+          continue;
+        }
+        Real u1,u2;
+        int i1 = GetRamp(rampStartTime,ramps,c.t1+shift,u1);
+        int i2 = GetRamp(rampStartTime,ramps,c.t2+shift,u2);
+        if(i1 == i2) continue;
+        const vector<ParabolicRampND>& intramps = c.intermediate.ramps;
+        ramps[i1].TrimBack(ramps[i1].endTime-u1);
+        ramps[i1].x1 = intramps.front().x0;
+        ramps[i1].dx1 = intramps.front().dx0;
+        ramps[i2].TrimFront(u2);
+        ramps[i2].x0 = intramps.back().x1;
+        ramps[i2].dx0 = intramps.back().dx1;
+        ramps.erase(ramps.begin()+i1+1,ramps.begin()+i2);
+        ramps.insert(ramps.begin()+i1+1,intramps.begin(),intramps.end());
+        shortcuts++;
+
+        appliedStart.push_back(c.t1);
+        appliedEnd.push_back(c.t2);
+        appliedShift.push_back(c.intermediate.GetTotalTime()-(c.t2-c.t1));
+
+        //revise the timing
+        rampStartTime.resize(ramps.size());
+        endTime=0;
+        for(size_t i=0;i<ramps.size();i++) {
+          rampStartTime[i] = endTime;
+          endTime += ramps[i].endTime;
+        }
+      }
+
+      //move the conflicting candidates to the updated path
+      n = 0;
+      for(size_t k=0;k<conflicts.size();k++) {
+        ShortcutCandidate& c = candidates[n];
+        if(conflicts[k] != n) std::swap(c,candidates[conflicts[k]]);
+        c.t1 = Min(MapTime(c.t1,appliedStart,appliedEnd,appliedShift),endTime);
+        c.t2 = Min(MapTime(c.t2,appliedStart,appliedEnd,appliedShift),endTime);
+        c.i1 = GetRamp(rampStartTime,ramps,c.t1,c.u1);
+        c.i2 = GetRamp(rampStartTime,ramps,c.t2,c.u2);
+        if(c.i1 == c.i2) continue;
+        n++;
+      }
+    }
+  }
+  //check for consistency
+  for(size_t i=0;i+1<ramps.size();i++) {
+    PARABOLIC_RAMP_ASSERT(ramps[i].x1 == ramps[i+1].x0);
+    PARABOLIC_RAMP_ASSERT(ramps[i].dx1 == ramps[i+1].dx0);
+  }
+  if(stats) {
+    stats->numShortcuts += shortcuts;
+    stats->totalTime += timer.ElapsedTime();
+  }
+  return shortcuts;
+}
+
 int DynamicPath::ShortCircuit(RampFeasibilityChecker& check)
 {
   int shortcuts=0;
@@ -102,6 +102,26 @@ class RandomNumberGeneratorBase
 };
 
 
+/** @brief Statistics gathered by DynamicPath::ParallelShortcut().
+ *
+ * ParallelShortcut adds to the counts, so one ShortcutStats may accumulate
+ * several calls.
+ */
+struct ShortcutStats
+{
+  ShortcutStats();
+  void Clear();
+  void Print() const;
+
+  int numBatches;      ///< number of parallel checks of a batch of candidates, including re-checks
+  int numCandidates;   ///< number of candidate shortcuts checked, including re-checks
+  int numFeasible;     ///< number of checks that found a candidate feasible
+  int numShortcuts;    ///< number of shortcuts applied to the path
+  int numConflicts;    ///< feasible candidates re-checked because an earlier shortcut in the same batch overlapped them
+  double checkTime;    ///< wall-clock time spent checking candidates
+  double totalTime;    ///< total wall-clock time
+};
+
 /** @brief A bounded-velocity, bounded-acceleration trajectory consisting
  * of parabolic ramps.
  *
@@ -110,6 +130,15 @@ class RandomNumberGeneratorBase
  *
  * The Shortcut and OnlineShortcut methods can optionally take a
  * custom random number generator (may be useful for multithreading).
+ *
+ * ParallelShortcut checks batches of candidate shortcuts on several threads
+ * at once, using one feasibility checker per thread.  All candidates in a
+ * batch are drawn from the same path, and the feasible ones are then
+ * applied in the order they were drawn.  A candidate that overlaps a
+ * shortcut already applied in the batch has its endpoints moved to the
+ * corresponding times of the updated path, and is checked again.  The
+ * result depends only on the random numbers and the number of checkers,
+ * not on thread timing.  With one checker it is the same as Shortcut.
  */
 class DynamicPath
 {
@@ -140,6 +169,7 @@ class DynamicPath
   bool TryShortcut(Real t1,Real t2,RampFeasibilityChecker& check);
   int Shortcut(int numIters,RampFeasibilityChecker& check);
   int Shortcut(int numIters,RampFeasibilityChecker& check,RandomNumberGeneratorBase* rng);
+  int ParallelShortcut(int numIters,const std::vector<RampFeasibilityChecker*>& checks,RandomNumberGeneratorBase* rng,ShortcutStats* stats=NULL);
   int ShortCircuit(RampFeasibilityChecker& check);
   /// leadTime: the amount of time before this path should be executable
   /// padTime: an approximate bound on the time it takes to check a shortcut
@@ -618,11 +618,14 @@ int MultiPath::TimeToSection(Real time) const
     Assert(!sections[i].times.empty());
   if(time < sections[0].times[0]) return -1;
   if(time >= sections.back().times.back()) return sections.size();
-  for(size_t i=0;i<sections.size();i++) {
-    if(time <= sections[i].times.back()) return(int)i;
+  //binary search for the first section ending at or after time
+  int lo=0,hi=(int)sections.size()-1;
+  while(lo < hi) {
+    int mid = (lo+hi)/2;
+    if(time <= sections[mid].times.back()) hi = mid;
+    else lo = mid+1;
   }
-  AssertNotReached();
-  return 0;
+  return lo;
 }
 
 int MultiPath::Evaluate(Real time,GeneralizedCubicBezierCurve& curve,Real& duration,Real& param,InterpPolicy policy) const
@@ -0,0 +1,146 @@
+#include "ParallelFor.h"
+#include "Atomic.h"
+#include <KrisLibrary/utils/threadutils.h>
+#include <vector>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif //WIN32
+using namespace std;
+
+int NumHardwareThreads()
+{
+#ifdef WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  int n = (int)info.dwNumberOfProcessors;
+#else
+  int n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif //WIN32
+  if(n < 1) return 1;
+  return n;
+}
+
+int ResolveNumThreads(int numThreads)
+{
+  if(numThreads <= 0) return NumHardwareThreads();
+  return numThreads;
+}
+
+struct ParallelForData
+{
+  ParallelForBody* body;
+  int n;
+  volatile int next;
+};
+
+//nonzero while this thread is running items of a ParallelFor call
+static THREAD_LOCAL int gParallelForDepth = 0;
+
+static void ParallelForLoop(ParallelForData* data,int thread)
+{
+  gParallelForDepth++;
+  while(true) {
+    int index = AtomicAdd(&data->next,1);
+    if(index >= data->n) break;
+    data->body->Run(index,thread);
+  }
+  gParallelForDepth--;
+}
+
+/** The persistent worker threads.  Worker i (1-based) takes part in a call
+ * if i < numThreads of that call.  Everything is guarded by mutex.
+ *
+ * The pool is allocated once and never freed: its threads block on wake
+ * until the process exits, and destroying a condition that has waiters is
+ * undefined.
+ */
+struct ParallelForPool
+{
+  ParallelForPool() : job(NULL),jobThreads(0),generation(0),active(0),inUse(false) {}
+
+  Mutex mutex;
+  Condition wake;   //a call was posted
+  Condition done;   //the last worker left the current call
+  Condition idle;   //the pool was released by its caller
+  vector<Thread> threads;
+  ParallelForData* job;
+  int jobThreads;
+  int generation;
+  int active;
+  bool inUse;
+};
+
+static Mutex gParallelForPoolMutex;
+static ParallelForPool* gParallelForPool = NULL;
+
+static void* parallel_for_pool_thread_func(void* ptr)
+{
+  ParallelForPool* pool = gParallelForPool;
+  int thread = (int)(size_t)ptr;
+  int seen = 0;
+  pool->mutex.lock();
+  while(true) {
+    while(pool->generation == seen)
+      pool->wake.wait(pool->mutex);
+    seen = pool->generation;
+    if(thread >= pool->jobThreads) continue;
+    ParallelForData* data = pool->job;
+    pool->mutex.unlock();
+    data->body->BeginThread(thread);
+    ParallelForLoop(data,thread);
+    data->body->EndThread(thread);
+    pool->mutex.lock();
+    pool->active--;
+    if(pool->active == 0) pool->done.signal();
+  }
+  return NULL;
+}
+
+static ParallelForPool* GetParallelForPool()
+{
+  ScopedLock lock(gParallelForPoolMutex);
+  if(!gParallelForPool) gParallelForPool = new ParallelForPool;
+  return gParallelForPool;
+}
+
+void ParallelFor(int n,ParallelForBody& body,int numThreads)
+{
+  if(numThreads > n) numThreads = n;
+  if(numThreads <= 1 || gParallelForDepth > 0) {
+    for(int i=0;i<n;i++)
+      body.Run(i,0);
+    return;
+  }
+  ParallelForData data;
+  data.body = &body;
+  data.n = n;
+  data.next = 0;
+
+  ParallelForPool* pool = GetParallelForPool();
+  pool->mutex.lock();
+  while(pool->inUse)
+    pool->idle.wait(pool->mutex);
+  pool->inUse = true;
+  //threads are numbered from 1, the caller is thread 0
+  while((int)pool->threads.size()+1 < numThreads)
+    pool->threads.push_back(ThreadStart(parallel_for_pool_thread_func,(void*)(pool->threads.size()+1)));
+  pool->job = &data;
+  pool->jobThreads = numThreads;
+  pool->active = numThreads-1;
+  pool->generation++;
+  pool->wake.broadcast();
+  pool->mutex.unlock();
+
+  ParallelForLoop(&data,0);
+
+  pool->mutex.lock();
+  while(pool->active > 0)
+    pool->done.wait(pool->mutex);
+  pool->job = NULL;
+  pool->jobThreads = 0;
+  pool->inUse = false;
+  pool->idle.signal();
+  pool->mutex.unlock();
+}
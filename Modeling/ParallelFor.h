@@ -0,0 +1,55 @@
+#ifndef MODELING_PARALLEL_FOR_H
+#define MODELING_PARALLEL_FOR_H
+
+/** @ingroup Modeling
+ * @brief A unit of work for ParallelFor.  Subclasses implement Run(),
+ * which is called once for each index in [0,n).
+ *
+ * thread is the index of the worker executing the item, in the range
+ * [0,numThreads).  Worker 0 is always the calling thread.  Use it to index
+ * into per-thread scratch buffers so that Run() does not need to lock.
+ *
+ * BeginThread() and EndThread() are called on each worker other than the
+ * caller before its first item of a ParallelFor call and after its last.
+ * Workers are pool threads that outlive the call, so per-thread library
+ * state set up in BeginThread() (e.g., ODE's thread data) is reused by
+ * later calls on the same thread.
+ */
+class ParallelForBody
+{
+ public:
+  virtual ~ParallelForBody() {}
+  virtual void Run(int index,int thread) = 0;
+  virtual void BeginThread(int thread) {}
+  virtual void EndThread(int thread) {}
+};
+
+///Returns the number of hardware threads on this machine (at least 1)
+int NumHardwareThreads();
+
+///Resolves a user thread count setting: values <= 0 mean "use all hardware
+///threads"
+int ResolveNumThreads(int numThreads);
+
+/** @brief Calls body.Run(i,thread) for every i in [0,n) using up to
+ * numThreads threads.
+ *
+ * The calling thread participates as thread 0, and items are handed out
+ * dynamically in increasing index order, so the set of items executed is
+ * the same as a serial loop but the execution order is not.  Callers that
+ * need deterministic output should write results into per-index slots and
+ * merge them afterwards.
+ *
+ * The other workers come from a process-wide pool of threads that is
+ * created on first use and grows to the largest numThreads requested, so
+ * a call costs a wakeup rather than a thread creation.  The pool runs one
+ * call at a time; concurrent calls from other threads wait for it.
+ *
+ * If numThreads <= 1 or n <= 1 the loop is run serially on the calling
+ * thread with no synchronization overhead.  Calls made from inside a
+ * ParallelFor body (on any of its workers) also run serially, rather than
+ * oversubscribing the machine or waiting on the pool they occupy.
+ */
+void ParallelFor(int n,ParallelForBody& body,int numThreads);
+
+#endif
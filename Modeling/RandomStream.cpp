@@ -0,0 +1,48 @@
+#include "RandomStream.h"
+#include <math.h>
+
+RandomStream::RandomStream(unsigned long long seed)
+{
+  Seed(seed);
+}
+
+void RandomStream::Seed(unsigned long long seed)
+{
+  state = seed;
+  hasSpare = false;
+  spare = 0;
+}
+
+unsigned long long RandomStream::RandInt64()
+{
+  state += 0x9E3779B97F4A7C15ULL;
+  unsigned long long z = state;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+double RandomStream::Rand()
+{
+  //top 53 bits
+  return double(RandInt64() >> 11) * (1.0/9007199254740992.0);
+}
+
+double RandomStream::RandGaussian()
+{
+  if(hasSpare) {
+    hasSpare = false;
+    return spare;
+  }
+  //Marsaglia polar method
+  double u,v,s;
+  do {
+    u = 2.0*Rand()-1.0;
+    v = 2.0*Rand()-1.0;
+    s = u*u+v*v;
+  } while(s >= 1.0 || s == 0.0);
+  double scale = sqrt(-2.0*log(s)/s);
+  spare = v*scale;
+  hasSpare = true;
+  return u*scale;
+}
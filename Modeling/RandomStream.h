@@ -0,0 +1,32 @@
+#ifndef MODELING_RANDOM_STREAM_H
+#define MODELING_RANDOM_STREAM_H
+
+/** @ingroup Modeling
+ * @brief A small random number generator (SplitMix64) whose sequence
+ * depends only on its seed.
+ *
+ * Unlike the global generator in KrisLibrary/math/random.h, each stream
+ * owns its state, so planners or simulations running on different threads
+ * can draw reproducible random numbers without affecting one another.  Nearby
+ * seeds (e.g., 0,1,2,...) give unrelated sequences.
+ */
+class RandomStream
+{
+ public:
+  RandomStream(unsigned long long seed=0);
+  void Seed(unsigned long long seed);
+  ///Returns a uniformly distributed 64-bit integer
+  unsigned long long RandInt64();
+  ///Returns a uniformly distributed value in [0,1)
+  double Rand();
+  ///Returns a uniformly distributed value in [a,b)
+  double Rand(double a,double b) { return a + (b-a)*Rand(); }
+  ///Returns a normally distributed value with mean 0 and variance 1
+  double RandGaussian();
+
+  unsigned long long state;
+  bool hasSpare;      ///< RandGaussian generates values in pairs
+  double spare;
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "Resources.h"
+#include "Atomic.h"
 #include <KrisLibrary/utils/stringutils.h>
 #include <KrisLibrary/utils/fileutils.h>
 #include <KrisLibrary/meshing/IO.h>
@@ -541,8 +542,21 @@ bool LinearPathResource::Unpack(vector<ResourcePtr>& res,bool* incomplete)
 
 
 
+//the last version given to a MultiPathResource
+static volatile int gMultiPathVersion = 0;
+
+MultiPathResource::MultiPathResource()
+  :version(AtomicAdd(&gMultiPathVersion,1)+1)
+{}
+
+void MultiPathResource::MarkChanged()
+{
+  version = AtomicAdd(&gMultiPathVersion,1)+1;
+}
+
 bool MultiPathResource::Load(const string& fn)
 {
+  MarkChanged();
   return path.Load(fn);
 }
 
@@ -553,6 +567,7 @@ bool MultiPathResource::Save(const string& fn)
 
 bool MultiPathResource::Load(TiXmlElement* in)
 {
+  MarkChanged();
   return path.Load(in);
 }
 
@@ -692,6 +707,7 @@ bool MultiPathResource::Pack(vector<ResourcePtr>& lib,string* errorMessage)
     if(errorMessage) *errorMessage = "MultiPath may not consist of multiple types of path sections";
     return false;
   }
+  MarkChanged();
   if(!multiPaths.empty()) {
     //concatenate paths
     for(size_t i=0;i<multiPaths.size();i++) {
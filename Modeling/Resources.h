@@ -176,8 +176,15 @@ class MultiPathResource : public CompoundResourceBase
   virtual bool Extract(const char* subtype,vector<ResourcePtr>&);
   virtual bool Pack(vector<ResourcePtr>& subobjects,string* errorMessage=NULL);
   virtual bool Unpack(vector<ResourcePtr>& subobjects,bool* incomplete=NULL);
+  MultiPathResource();
+  ///Call after editing path in place, so that copies made from it (e.g.,
+  ///the compiled path in ViewResource) are refreshed
+  void MarkChanged();
 
   MultiPath path;
+  ///Differs from that of every other MultiPathResource, and changes when
+  ///the path is loaded or packed, or on MarkChanged
+  int version;
 };
 
 /** @brief Resource for an IKGoal.
@@ -0,0 +1,44 @@
+#ifndef MODELING_TRIPLE_BUFFER_H
+#define MODELING_TRIPLE_BUFFER_H
+
+#include "Atomic.h"
+
+/** @ingroup Modeling
+ * @brief A wait-free single-producer, single-consumer handoff of values of
+ * type T.
+ *
+ * The producer fills in Back() and calls Publish().  The consumer calls
+ * Update(), which returns true if a newer value was published since the
+ * last call, and then reads Front().  Neither side ever waits for the
+ * other: if the producer publishes twice before the consumer updates, the
+ * older value is dropped.  Buffers are reused, so values with internal
+ * storage (e.g., vectors) stop allocating once they reach a steady size.
+ */
+template <class T>
+class TripleBuffer
+{
+ public:
+  TripleBuffer() : back(0),middle(1),front(2) {}
+  ///Producer side: the value to be published next
+  T& Back() { return buffers[back]; }
+  ///Producer side: hands Back() to the consumer and gets a new back buffer
+  void Publish() { back = (AtomicExchange(&middle,back|kFresh) & kIndexMask); }
+  ///Consumer side: returns true if there is a new value, in which case it
+  ///is moved into Front()
+  bool Update() {
+    if(!(AtomicLoad(&middle) & kFresh)) return false;
+    front = (AtomicExchange(&middle,front) & kIndexMask);
+    return true;
+  }
+  ///Consumer side: the most recent value obtained by Update()
+  T& Front() { return buffers[front]; }
+
+ private:
+  enum { kIndexMask=3, kFresh=4 };
+  T buffers[3];
+  int back;
+  volatile int middle;   //index of the middle buffer, plus kFresh if it is unread
+  int front;
+};
+
+#endif
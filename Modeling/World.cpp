@@ -7,6 +7,7 @@
 #include "IO/XmlWorld.h"
 
 RobotWorld::RobotWorld()
+  :bvhValid(false)
 {
   background.set(0.4,0.4,1,0);
 }
@@ -291,6 +292,7 @@ int RobotWorld::LoadRobot(const string& fn)
 
 int RobotWorld::AddRobot(const string& name,Robot* robot)
 {
+  InvalidateBVH();
   robots.resize(robots.size()+1);
   robots.back() = robot;
   robotViews.resize(robots.size());
@@ -303,6 +305,7 @@ int RobotWorld::AddRobot(const string& name,Robot* robot)
 
 void RobotWorld::DeleteRobot(const string& name)
 {
+  InvalidateBVH();
   for(size_t i=0;i<robots.size();i++) {
     if(robots[i]->name == name) {
       robots.erase(robots.begin()+i);
@@ -350,6 +353,7 @@ int RobotWorld::LoadTerrain(const string& fn)
 
 int RobotWorld::AddTerrain(const string& name,Terrain* t)
 {
+  InvalidateBVH();
   terrains.resize(terrains.size()+1);
   terrains.back() = t;
   if(t) t->name = name;
@@ -358,6 +362,7 @@ int RobotWorld::AddTerrain(const string& name,Terrain* t)
 
 void RobotWorld::DeleteTerrain(const string& name)
 {
+  InvalidateBVH();
   for(size_t i=0;i<terrains.size();i++) {
     if(terrains[i]->name == name) {
       terrains.erase(terrains.begin()+i);
@@ -395,6 +400,7 @@ int RobotWorld::LoadRigidObject(const string& fn)
 
 int RobotWorld::AddRigidObject(const string& name,RigidObject* t)
 {
+  InvalidateBVH();
   if(t) t->name = name;
   rigidObjects.resize(rigidObjects.size()+1);
   rigidObjects.back() = t;
@@ -403,6 +409,7 @@ int RobotWorld::AddRigidObject(const string& name,RigidObject* t)
 
 void RobotWorld::DeleteRigidObject(const string& name)
 {
+  InvalidateBVH();
   for(size_t i=0;i<rigidObjects.size();i++) {
     if(rigidObjects[i]->name == name) {
       rigidObjects.erase(rigidObjects.begin()+i);
@@ -420,121 +427,43 @@ RigidObject* RobotWorld::GetRigidObject(const string& name)
 
 
 
+void RobotWorld::UpdateBVH()
+{
+  if(bvhValid) bvh.Refit(*this);
+  else bvh.Build(*this);
+  bvhValid = true;
+}
+
 int RobotWorld::RayCast(const Ray3D& r,Vector3& worldpt)
 {
-  for(size_t j=0;j<robots.size();j++) 
-    robots[j]->InitCollisions();
-  for(size_t j=0;j<rigidObjects.size();j++) 
-    rigidObjects[j]->InitCollisions();
-  for(size_t j=0;j<terrains.size();j++) 
-    terrains[j]->InitCollisions();
-  int closestBody = -1;
-  Real closestDist = Inf;
-  Vector3 closestPoint;
-  for(size_t j=0;j<robots.size();j++) {
-    Robot* robot = robots[j];
-    robot->UpdateGeometry();
-    for(size_t i=0;i<robot->links.size();i++) {
-      if(robot->IsGeometryEmpty(i)) continue;
-      Real dist;
-      if(robot->geometry[i]->RayCast(r,&dist)) {
-        if(dist < closestDist) {
-          closestDist = dist;
-          closestPoint = r.source + dist*r.direction;
-          closestBody = RobotLinkID(j,i);
-        }
-      }
-    }
-  }
-  for(size_t j=0;j<rigidObjects.size();j++) {
-    RigidObject* obj = rigidObjects[j];
-    obj->geometry->SetTransform(obj->T);
-    Real dist;
-    if(obj->geometry->RayCast(r,&dist)) {
-      if(dist < closestDist) {
-        closestDist = dist;
-        closestPoint = r.source+dist*r.direction;
-        closestBody = RigidObjectID(j);
-      }
-    }
-  }
-  for(size_t j=0;j<terrains.size();j++) {
-    Terrain* ter = terrains[j];
-    Real dist;
-    if(ter->geometry->RayCast(r,&dist)) {
-      if(dist < closestDist) {
-        closestDist = dist;
-        closestPoint = r.source+dist*r.direction;
-        closestBody = TerrainID(j);
-      }
-    }
-  }
-  worldpt = closestPoint;
-  return closestBody;
+  UpdateBVH();
+  return bvh.RayCast(r,worldpt);
 }
 
 Robot* RobotWorld::RayCastRobot(const Ray3D& r,int& body,Vector3& localpt)
 {
-  //doing it this way rather than dynamic initialization gives better 
-  //debug printing info
-  for(size_t j=0;j<robots.size();j++) {
-    robots[j]->InitCollisions();
-  }
-
-  Robot* closestRobot=NULL;
-  Real closestDist = Inf;
-  Vector3 closestPoint;
-  int closestBody = -1;
-  Vector3 worldpt;
-  for(size_t j=0;j<robots.size();j++) {
-    Robot* robot = robots[j];
-    robot->UpdateGeometry();
-    for(size_t i=0;i<robot->links.size();i++) {
-      if(robot->IsGeometryEmpty(i)) continue;
-      Real dist;
-      if(robot->geometry[i]->RayCast(r,&dist)) {
-	if(dist < closestDist) {
-	  closestDist = dist;
-	  closestPoint = r.source + dist*r.direction;
-	  closestBody = i;
-	  closestRobot = robots[j];
-	}
-      }
-    }
+  UpdateBVH();
+  WorldBVH::Hit hit;
+  if(!bvh.RayCast(r,hit,WorldBVH::RobotLinks,false)) {
+    body = -1;
+    return NULL;
   }
-  if(closestRobot)
-    closestRobot->links[closestBody].T_World.mulInverse(closestPoint,localpt);
-  body = closestBody;
-  return closestRobot;
+  const WorldBVH::Item& item = bvh.items[hit.item];
+  Robot* robot = robots[item.index];
+  robot->links[item.link].T_World.mulInverse(hit.point,localpt);
+  body = item.link;
+  return robot;
 }
 
 RigidObject* RobotWorld::RayCastObject(const Ray3D& r,Vector3& localpt)
 {
-  //doing it this way rather than dynamic initialization gives better 
-  //debug printing info
-  for(size_t j=0;j<rigidObjects.size();j++) {
-    rigidObjects[j]->InitCollisions();
-  }
-
-  RigidObject* closest=NULL;
-  Real closestDist = Inf;
-  Vector3 closestPoint;
-  Vector3 worldpt;
-  for(size_t j=0;j<rigidObjects.size();j++) {
-    RigidObject* obj = rigidObjects[j];
-    obj->geometry->SetTransform(obj->T);
-    Real dist;
-    if(obj->geometry->RayCast(r,&dist)) {
-      if(dist < closestDist) {
-	closestDist = dist;
-	closestPoint = r.source+dist*r.direction;
-	closest = rigidObjects[j];
-      }
-    }
-  }
-  if(closest)
-    closest->T.mulInverse(closestPoint,localpt);
-  return closest;
+  UpdateBVH();
+  WorldBVH::Hit hit;
+  if(!bvh.RayCast(r,hit,WorldBVH::RigidObjects,false)) 
+    return NULL;
+  RigidObject* obj = rigidObjects[bvh.items[hit.item].index];
+  obj->T.mulInverse(hit.point,localpt);
+  return obj;
 }
 
 void CopyWorld(const RobotWorld& a,RobotWorld& b)
@@ -542,6 +471,7 @@ void CopyWorld(const RobotWorld& a,RobotWorld& b)
   b.camera=a.camera;
   b.viewport=a.viewport;
   b.lights=a.lights;
+  b.InvalidateBVH();
 
   b.robots.resize(a.robots.size());
   b.robotViews.resize(a.robots.size());
@@ -4,6 +4,7 @@
 #include "Robot.h"
 #include "Terrain.h"
 #include "RigidObject.h"
+#include "WorldBVH.h"
 #include "View/ViewRobot.h"
 #include <KrisLibrary/camera/camera.h>
 #include <KrisLibrary/camera/viewport.h>
@@ -66,7 +67,9 @@ class RobotWorld
   void DeleteRigidObject(const string& name);
   RigidObject* GetRigidObject(const string& name);
 
-  ///Returns the ID of the entity the ray hits, or -1 if nothing was hit
+  ///Returns the ID of the entity the ray hits, or -1 if nothing was hit.
+  ///The ray direction need not be normalized.  The RayCast functions call
+  ///UpdateBVH() first, so they see the current transforms.
   int RayCast(const Ray3D& r,Vector3& worldpt);
   Robot* RayCastRobot(const Ray3D& r,int& body,Vector3& localpt);
   RigidObject* RayCastObject(const Ray3D& r,Vector3& localpt);
@@ -89,6 +92,19 @@ class RobotWorld
   vector<SmartPointer<RigidObject> > rigidObjects;
 
   vector<ViewRobot> robotViews;
+
+  ///Marks bvh for a full rebuild.  Moving robots and objects needs no
+  ///call; call this after editing a geometry in place.  The Add, Load, and
+  ///Delete functions call it automatically.
+  void InvalidateBVH() { bvhValid = false; }
+  ///Rebuilds bvh if it has been invalidated, otherwise refits it to the
+  ///current transforms, which only touches the items that moved
+  void UpdateBVH();
+
+  ///Ray casting acceleration structure.  Call UpdateBVH() before using it
+  ///directly.
+  WorldBVH bvh;
+  bool bvhValid;
 };
 
 void CopyWorld(const RobotWorld& a,RobotWorld& b);
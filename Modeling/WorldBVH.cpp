@@ -0,0 +1,369 @@
+#include "WorldBVH.h"
+#include "World.h"
+#include "ParallelFor.h"
+#include <KrisLibrary/geometry/CollisionMesh.h>
+#include <algorithm>
+using namespace std;
+
+//the maximum depth of the hierarchy, reached only with ~2^64 items since
+//nodes are split at the median
+const static int kMaxStackSize = 128;
+
+//clips the ray parameter range [tmin,tmax] to the box.  invdir holds the
+//inverse of each direction component, or 0 if the component is zero
+static bool ClipRay(const AABB3D& bb,const Ray3D& r,const Vector3& invdir,Real& tmin,Real& tmax)
+{
+  for(int k=0;k<3;k++) {
+    if(r.direction[k] == 0) {
+      if(r.source[k] < bb.bmin[k] || r.source[k] > bb.bmax[k]) return false;
+      continue;
+    }
+    Real t1 = (bb.bmin[k]-r.source[k])*invdir[k];
+    Real t2 = (bb.bmax[k]-r.source[k])*invdir[k];
+    if(t1 > t2) swap(t1,t2);
+    if(t1 > tmin) tmin = t1;
+    if(t2 < tmax) tmax = t2;
+    if(tmin > tmax) return false;
+  }
+  return true;
+}
+
+struct ItemCenterLess
+{
+  ItemCenterLess(const vector<WorldBVH::Item>& _items,int _axis) : items(_items),axis(_axis) {}
+  bool operator () (int a,int b) const {
+    return items[a].bb.bmin[axis]+items[a].bb.bmax[axis] < items[b].bb.bmin[axis]+items[b].bb.bmax[axis];
+  }
+  const vector<WorldBVH::Item>& items;
+  int axis;
+};
+
+WorldBVH::WorldBVH()
+{}
+
+//Returns the transform that the item's geometry should have, or NULL for
+//terrains, which do not move
+static const RigidTransform* ItemTransform(RobotWorld& world,const WorldBVH::Item& item)
+{
+  if(item.type == WorldBVH::RobotLinks) return &world.robots[item.index]->links[item.link].T_World;
+  if(item.type == WorldBVH::RigidObjects) return &world.rigidObjects[item.index]->T;
+  return NULL;
+}
+
+static bool SameTransform(const RigidTransform& a,const RigidTransform& b)
+{
+  for(int i=0;i<3;i++) {
+    if(a.t[i] != b.t[i]) return false;
+    for(int j=0;j<3;j++)
+      if(a.R(i,j) != b.R(i,j)) return false;
+  }
+  return true;
+}
+
+void WorldBVH::GatherItems(RobotWorld& world,vector<Item>& items)
+{
+  items.resize(0);
+  Item item;
+  for(size_t j=0;j<world.robots.size();j++) {
+    Robot* robot = world.robots[j];
+    robot->InitCollisions();
+    for(size_t i=0;i<robot->links.size();i++) {
+      if(robot->IsGeometryEmpty(i)) continue;
+      item.id = world.RobotLinkID(j,i);
+      item.type = RobotLinks;
+      item.index = (int)j;
+      item.link = (int)i;
+      item.geometry = &*robot->geometry[i];
+      items.push_back(item);
+    }
+  }
+  for(size_t j=0;j<world.rigidObjects.size();j++) {
+    RigidObject* obj = world.rigidObjects[j];
+    obj->InitCollisions();
+    item.id = world.RigidObjectID(j);
+    item.type = RigidObjects;
+    item.index = (int)j;
+    item.link = -1;
+    item.geometry = &*obj->geometry;
+    items.push_back(item);
+  }
+  for(size_t j=0;j<world.terrains.size();j++) {
+    Terrain* ter = world.terrains[j];
+    ter->InitCollisions();
+    item.id = world.TerrainID(j);
+    item.type = Terrains;
+    item.index = (int)j;
+    item.link = -1;
+    item.geometry = &*ter->geometry;
+    items.push_back(item);
+  }
+  for(size_t i=0;i<items.size();i++) {
+    const RigidTransform* T = ItemTransform(world,items[i]);
+    if(T) {
+      items[i].T = *T;
+      items[i].geometry->SetTransform(*T);
+    }
+    else
+      items[i].T.setIdentity();
+    items[i].bb = items[i].geometry->GetAABB();
+  }
+}
+
+void WorldBVH::Build(RobotWorld& world)
+{
+  GatherItems(world,items);
+  nodes.resize(0);
+  itemNodes.resize(items.size());
+  if(items.empty()) return;
+  vector<int> order(items.size());
+  for(size_t i=0;i<order.size();i++) order[i] = (int)i;
+  nodes.reserve(2*items.size());
+  BuildNode(order,0,(int)order.size());
+  nodes[0].parent = -1;
+}
+
+bool WorldBVH::SameItems(RobotWorld& world) const
+{
+  size_t k = 0;
+  for(size_t j=0;j<world.robots.size();j++) {
+    Robot* robot = world.robots[j];
+    for(size_t i=0;i<robot->links.size();i++) {
+      if(robot->IsGeometryEmpty(i)) continue;
+      if(k >= items.size() || items[k].id != world.RobotLinkID(j,i) || items[k].geometry != &*robot->geometry[i]) return false;
+      k++;
+    }
+  }
+  for(size_t j=0;j<world.rigidObjects.size();j++) {
+    if(k >= items.size() || items[k].id != world.RigidObjectID(j) || items[k].geometry != &*world.rigidObjects[j]->geometry) return false;
+    k++;
+  }
+  for(size_t j=0;j<world.terrains.size();j++) {
+    if(k >= items.size() || items[k].id != world.TerrainID(j) || items[k].geometry != &*world.terrains[j]->geometry) return false;
+    k++;
+  }
+  return k == items.size();
+}
+
+void WorldBVH::Refit(RobotWorld& world)
+{
+  if(nodes.empty() || !SameItems(world)) {
+    Build(world);
+    return;
+  }
+  //only the boxes of moved items and their ancestors are recomputed
+  dirty.resize(nodes.size());
+  fill(dirty.begin(),dirty.end(),0);
+  bool changed = false;
+  for(size_t i=0;i<items.size();i++) {
+    Item& item = items[i];
+    const RigidTransform* T = ItemTransform(world,item);
+    if(!T) continue;
+    //the geometry's transform may have been changed by another user
+    item.geometry->SetTransform(*T);
+    if(SameTransform(*T,item.T)) continue;
+    item.T = *T;
+    item.bb = item.geometry->GetAABB();
+    int node = itemNodes[i];
+    nodes[node].bb = item.bb;
+    for(node = nodes[node].parent;node >= 0 && !dirty[node];node = nodes[node].parent)
+      dirty[node] = 1;
+    changed = true;
+  }
+  if(!changed) return;
+  //children are always stored after their parents
+  for(int i=(int)nodes.size()-1;i>=0;i--) {
+    if(!dirty[i]) continue;
+    Node& node = nodes[i];
+    node.bb = nodes[node.left].bb;
+    node.bb.setUnion(nodes[node.right].bb);
+  }
+}
+
+int WorldBVH::BuildNode(vector<int>& order,int start,int end)
+{
+  int index = (int)nodes.size();
+  nodes.resize(nodes.size()+1);
+  AABB3D bb,centers;
+  bb.minimize();
+  centers.minimize();
+  for(int i=start;i<end;i++) {
+    const AABB3D& ibb = items[order[i]].bb;
+    bb.setUnion(ibb);
+    centers.expand(0.5*(ibb.bmin+ibb.bmax));
+  }
+  nodes[index].bb = bb;
+  if(end-start == 1) {
+    nodes[index].types = items[order[start]].type;
+    nodes[index].left = nodes[index].right = -1;
+    nodes[index].item = order[start];
+    itemNodes[order[start]] = index;
+    return index;
+  }
+  //split at the median center along the widest axis
+  Vector3 size = centers.bmax-centers.bmin;
+  int axis = 0;
+  if(size.y > size[axis]) axis = 1;
+  if(size.z > size[axis]) axis = 2;
+  int mid = (start+end)/2;
+  nth_element(order.begin()+start,order.begin()+mid,order.begin()+end,ItemCenterLess(items,axis));
+  int left = BuildNode(order,start,mid);
+  int right = BuildNode(order,mid,end);
+  //nodes may have been reallocated
+  nodes[index].types = (nodes[left].types | nodes[right].types);
+  nodes[index].left = left;
+  nodes[index].right = right;
+  nodes[index].item = -1;
+  nodes[left].parent = nodes[right].parent = index;
+  return index;
+}
+
+int WorldBVH::RayCast(const Ray3D& r,Vector3& worldpt) const
+{
+  Hit hit;
+  if(!RayCast(r,hit,All,false)) return -1;
+  worldpt = hit.point;
+  return items[hit.item].id;
+}
+
+bool WorldBVH::RayCast(const Ray3D& ray,Hit& hit,int types,bool computeNormal,const vector<char>* ignoreIDs) const
+{
+  hit.item = -1;
+  hit.distance = Inf;
+  if(nodes.empty() || !(nodes[0].types & types)) return false;
+  //geometry ray casts return distances, so the hit point and the box
+  //clipping need a unit direction
+  Ray3D r;
+  r.source = ray.source;
+  r.direction = ray.direction;
+  Real len = r.direction.norm();
+  if(len == 0) return false;
+  r.direction /= len;
+  Vector3 invdir;
+  for(int k=0;k<3;k++)
+    invdir[k] = (r.direction[k] == 0 ? 0 : 1.0/r.direction[k]);
+  int stack[kMaxStackSize];
+  int n = 0;
+  stack[n++] = 0;
+  while(n > 0) {
+    const Node& node = nodes[stack[--n]];
+    Real tmin=0,tmax=hit.distance;
+    if(!ClipRay(node.bb,r,invdir,tmin,tmax)) continue;
+    if(node.item >= 0) {
+      if(ignoreIDs && (*ignoreIDs)[items[node.item].id]) continue;
+      Real dist;
+      if(items[node.item].geometry->RayCast(r,&dist) && dist < hit.distance) {
+        hit.distance = dist;
+        hit.item = node.item;
+      }
+      continue;
+    }
+    //visit the nearer child first so that the farther one is more likely
+    //to be pruned
+    const Node& left = nodes[node.left];
+    const Node& right = nodes[node.right];
+    Real tl0=0,tl1=hit.distance,tr0=0,tr1=hit.distance;
+    bool hitl = (left.types & types) && ClipRay(left.bb,r,invdir,tl0,tl1);
+    bool hitr = (right.types & types) && ClipRay(right.bb,r,invdir,tr0,tr1);
+    if(hitl && hitr) {
+      if(tl0 <= tr0) { stack[n++] = node.right; stack[n++] = node.left; }
+      else { stack[n++] = node.left; stack[n++] = node.right; }
+    }
+    else if(hitl) stack[n++] = node.left;
+    else if(hitr) stack[n++] = node.right;
+  }
+  if(hit.item < 0) return false;
+  hit.point = r.source + hit.distance*r.direction;
+  if(computeNormal) {
+    hit.normal = -r.direction;
+    Geometry::AnyCollisionGeometry3D* geom = items[hit.item].geometry;
+    if(geom->type == Geometry::AnyGeometry3D::TriangleMesh) {
+      const Geometry::CollisionMesh& mesh = geom->TriangleMeshCollisionData();
+      Vector3 pt;
+      int tri = Geometry::RayCast(mesh,r,pt);
+      if(tri >= 0) {
+        Triangle3D t;
+        mesh.GetTriangle(tri,t);
+        hit.normal = mesh.currentTransform.R*t.normal();
+      }
+    }
+  }
+  return true;
+}
+
+//rays are handed out to the threads in blocks to reduce scheduling overhead
+const static int kRaysPerItem = 64;
+
+//Casts one block of rays per work item
+struct WorldBVHRayCastBody : public ParallelForBody
+{
+  WorldBVHRayCastBody(const WorldBVH& _bvh,const vector<Ray3D>& _rays,vector<WorldBVH::Hit>& _hits,int _types,bool _computeNormal,const vector<char>* _ignoreIDs)
+    :bvh(_bvh),rays(_rays),hits(_hits),types(_types),computeNormal(_computeNormal),ignoreIDs(_ignoreIDs)
+  {}
+  virtual void Run(int index,int thread)
+  {
+    int end = Min((index+1)*kRaysPerItem,(int)rays.size());
+    for(int i=index*kRaysPerItem;i<end;i++)
+      bvh.RayCast(rays[i],hits[i],types,computeNormal,ignoreIDs);
+  }
+
+  const WorldBVH& bvh;
+  const vector<Ray3D>& rays;
+  vector<WorldBVH::Hit>& hits;
+  int types;
+  bool computeNormal;
+  const vector<char>* ignoreIDs;
+};
+
+void WorldBVH::RayCast(const vector<Ray3D>& rays,vector<Hit>& hits,int types,bool computeNormal,const vector<char>* ignoreIDs,int numThreads) const
+{
+  hits.resize(rays.size());
+  WorldBVHRayCastBody body(*this,rays,hits,types,computeNormal,ignoreIDs);
+  int n = ((int)rays.size()+kRaysPerItem-1)/kRaysPerItem;
+  ParallelFor(n,body,ResolveNumThreads(numThreads));
+}
+
+//returns true if the boxes are within distance margin of each other along
+//every axis
+static bool BoxesOverlap(const AABB3D& a,const AABB3D& b,Real margin)
+{
+  for(int k=0;k<3;k++)
+    if(a.bmin[k] > b.bmax[k]+margin || b.bmin[k] > a.bmax[k]+margin) return false;
+  return true;
+}
+
+void WorldBVH::OverlappingPairs(Real margin,vector<pair<int,int> >& pairs) const
+{
+  pairs.resize(0);
+  if(nodes.empty()) return;
+  vector<pair<int,int> > stack;
+  stack.push_back(pair<int,int>(0,0));
+  while(!stack.empty()) {
+    int a = stack.back().first, b = stack.back().second;
+    stack.pop_back();
+    const Node& na = nodes[a];
+    const Node& nb = nodes[b];
+    if(a == b) {
+      //pairs within a subtree
+      if(na.item >= 0) continue;
+      stack.push_back(pair<int,int>(na.left,na.left));
+      stack.push_back(pair<int,int>(na.right,na.right));
+      stack.push_back(pair<int,int>(na.left,na.right));
+      continue;
+    }
+    if(!BoxesOverlap(na.bb,nb.bb,margin)) continue;
+    if(na.item >= 0 && nb.item >= 0) {
+      if(na.item < nb.item) pairs.push_back(pair<int,int>(na.item,nb.item));
+      else pairs.push_back(pair<int,int>(nb.item,na.item));
+    }
+    else if(nb.item >= 0 || (na.item < 0 && (na.bb.bmax-na.bb.bmin).normSquared() > (nb.bb.bmax-nb.bb.bmin).normSquared())) {
+      //descend into the larger node
+      stack.push_back(pair<int,int>(na.left,b));
+      stack.push_back(pair<int,int>(na.right,b));
+    }
+    else {
+      stack.push_back(pair<int,int>(a,nb.left));
+      stack.push_back(pair<int,int>(a,nb.right));
+    }
+  }
+  sort(pairs.begin(),pairs.end());
+}
@@ -0,0 +1,95 @@
+#ifndef MODELING_WORLD_BVH_H
+#define MODELING_WORLD_BVH_H
+
+#include <KrisLibrary/geometry/AnyGeometry.h>
+#include <KrisLibrary/math3d/AABB3D.h>
+#include <KrisLibrary/math3d/Ray3D.h>
+#include <vector>
+using namespace std;
+using namespace Math3D;
+
+class RobotWorld;
+
+/** @ingroup Modeling
+ * @brief A bounding volume hierarchy over all the geometries in a
+ * RobotWorld (robot links, rigid objects, and terrains), used to speed up
+ * ray casting.
+ *
+ * Build() updates the world's geometry transforms and constructs the
+ * hierarchy.  Refit() is cheaper: it keeps the tree structure, and only
+ * recomputes the boxes of the robot links and rigid objects whose
+ * transforms changed since the last Build/Refit, plus their ancestors.  It
+ * falls back to Build() if geometries were added, removed, or replaced.
+ * Refit() cannot see geometry that was edited in place, so call Build()
+ * after such edits.  Once built, the RayCast functions may be called from
+ * several threads at once.
+ */
+class WorldBVH
+{
+ public:
+  ///Flags selecting which kinds of geometries a ray cast considers
+  enum { Terrains=1, RobotLinks=2, RigidObjects=4, All=7 };
+
+  struct Item
+  {
+    int id;     ///< the world ID of the geometry
+    int type;   ///< one of Terrains, RobotLinks, or RigidObjects
+    int index;  ///< the index of the terrain, robot, or rigid object
+    int link;   ///< the robot link, or -1
+    Geometry::AnyCollisionGeometry3D* geometry;
+    RigidTransform T;   ///< the geometry's transform when bb was computed
+    AABB3D bb;
+  };
+  struct Node
+  {
+    AABB3D bb;
+    int types;        ///< union of the types of the items below this node
+    int left,right;   ///< child nodes, or -1 for a leaf
+    int parent;       ///< parent node, or -1 for the root
+    int item;         ///< index of the item for a leaf, -1 otherwise
+  };
+  ///The result of a ray cast
+  struct Hit
+  {
+    int item;         ///< index into items, or -1 if nothing was hit
+    Real distance;
+    Vector3 point;    ///< hit point in world coordinates
+    ///Outward surface normal at the hit point, in world coordinates.  For
+    ///triangle meshes this is the normal of the triangle hit; for other
+    ///geometry types it is the reversed ray direction.
+    Vector3 normal;
+  };
+
+  WorldBVH();
+  void Build(RobotWorld& world);
+  void Refit(RobotWorld& world);
+  ///Returns the world ID of the first geometry hit by r, or -1 if nothing
+  ///was hit.  Same as RobotWorld::RayCast.
+  int RayCast(const Ray3D& r,Vector3& worldpt) const;
+  ///Casts a ray against the geometries of the given types.  Returns true
+  ///if something was hit.  r's direction need not be normalized; the hit
+  ///distance is measured in world units along the normalized direction.  The normal is only filled out if computeNormal
+  ///is true.  If ignoreIDs is given, geometries whose world ID has
+  ///ignoreIDs[id] != 0 are skipped.
+  bool RayCast(const Ray3D& r,Hit& hit,int types=All,bool computeNormal=true,const vector<char>* ignoreIDs=NULL) const;
+  ///Casts a batch of rays using up to numThreads threads (<= 0 uses all
+  ///hardware threads).  hits[i] is the result for rays[i].
+  void RayCast(const vector<Ray3D>& rays,vector<Hit>& hits,int types=All,bool computeNormal=true,const vector<char>* ignoreIDs=NULL,int numThreads=1) const;
+
+  ///Returns all pairs of items (i,j), i<j, whose bounding boxes are within
+  ///distance margin of each other along every axis, in sorted order
+  void OverlappingPairs(Real margin,vector<pair<int,int> >& pairs) const;
+
+  //used internally
+  void GatherItems(RobotWorld& world,vector<Item>& items);
+  bool SameItems(RobotWorld& world) const;
+  int BuildNode(vector<int>& order,int start,int end);
+
+  vector<Item> items;
+  vector<Node> nodes;
+  vector<int> itemNodes;  ///< the leaf node of each item
+  vector<char> dirty;     ///< Refit() scratch space
+
+};
+
+#endif
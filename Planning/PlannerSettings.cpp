@@ -1,4 +1,6 @@
 #include "PlannerSettings.h"
+#include "Modeling/Atomic.h"
+#include <algorithm>
 using namespace Meshing;
 using namespace Geometry;
 
@@ -10,6 +12,7 @@ WorldPlannerSettings::WorldPlannerSettings()
 
 void WorldPlannerSettings::InitializeDefault(RobotWorld& world)
 {
+  broadphase.Clear();
   int n=world.NumIDs();
   collisionEnabled.resize(n,n,true);
   for(int i=0;i<n;i++)
@@ -85,6 +88,7 @@ void WorldPlannerSettings::InitializeDefault(RobotWorld& world)
     robotSettings[i].worldBounds = bounds;
     robotSettings[i].contactEpsilon = 0.001;
     robotSettings[i].contactIKMaxIters = 50;
+    robotSettings[i].numEdgeCheckThreads = 1;
   }
 }
 
@@ -233,96 +237,170 @@ void GetGeometries(RobotWorld& world,const vector<int>& ids,vector<Geometry::Any
   }
 }
 
-pair<int,int> WorldPlannerSettings::CheckCollision(RobotWorld& world,const vector<int>& ids,Real tol)
+CollisionBroadphase::CollisionBroadphase()
+  :nearlySorted(true),inUse(0)
+{}
+
+CollisionBroadphase::CollisionBroadphase(const CollisionBroadphase& rhs)
+  :nearlySorted(true),inUse(0)
+{}
+
+const CollisionBroadphase& CollisionBroadphase::operator = (const CollisionBroadphase& rhs)
 {
-  //first, get all the geometries
-  vector<Geometry::AnyCollisionGeometry3D*> geoms;
-  vector<int> activeids;
-  GetGeometries(world,ids,geoms,activeids);
+  Clear();
+  return *this;
+}
 
-  Vector3 d(tol*0.5); //adjustment
-  vector<AABB3D> bbs(geoms.size());
-  for(size_t i=0;i<geoms.size();i++) {
-    bbs[i]=geoms[i]->GetAABB();
-    bbs[i].bmin -= d;
-    bbs[i].bmax += d;
+void CollisionBroadphase::Clear()
+{
+  items.resize(0);
+  order.resize(0);
+  nearlySorted = true;
+}
+
+void CollisionBroadphase::Update(int numIDs,const vector<Geometry::AnyCollisionGeometry3D*>& geoms,const vector<int>& ids)
+{
+  if((int)items.size() != numIDs) {
+    //the world changed, start over
+    Clear();
+    items.resize(numIDs);
+    for(size_t i=0;i<items.size();i++) {
+      items[i].geometry = NULL;
+      items[i].mask = 0;
+    }
   }
+  for(size_t i=0;i<ids.size();i++) {
+    Item& item = items[ids[i]];
+    RigidTransform T = geoms[i]->GetTransform();
+    if(item.geometry != geoms[i]) {
+      if(item.geometry == NULL) {
+        order.push_back(ids[i]);
+        nearlySorted = false;
+      }
+      item.geometry = geoms[i];
+    }
+    else if(item.T.isEqual(T)) continue;
+    item.T = T;
+    item.bb = geoms[i]->GetAABB();
+  }
+}
 
-  for(size_t i=0;i<activeids.size();i++) {
-    for(size_t j=i+1;j<activeids.size();j++) {
-      if(collisionEnabled(activeids[i],activeids[j]) || collisionEnabled(activeids[i],activeids[i])) {
-        if(bbs[i].intersects(bbs[j])) {
-          if(::CheckCollision(geoms[i],geoms[j],tol))
-            return pair<int,int>(activeids[i],activeids[j]);
-        }
+struct BroadphaseItemLess
+{
+  BroadphaseItemLess(const vector<CollisionBroadphase::Item>& _items) : items(_items) {}
+  bool operator () (int a,int b) const { return items[a].bb.bmin.x < items[b].bb.bmin.x; }
+  const vector<CollisionBroadphase::Item>& items;
+};
+
+void CollisionBroadphase::Sort()
+{
+  if(!nearlySorted) {
+    sort(order.begin(),order.end(),BroadphaseItemLess(items));
+    nearlySorted = true;
+    return;
+  }
+  for(size_t i=1;i<order.size();i++) {
+    int id = order[i];
+    Real x = items[id].bb.bmin.x;
+    size_t j = i;
+    while(j > 0 && items[order[j-1]].bb.bmin.x > x) {
+      order[j] = order[j-1];
+      j--;
+    }
+    order[j] = id;
+  }
+}
+
+CollisionBroadphase& WorldPlannerSettings::AcquireBroadphase(CollisionBroadphase* bp,CollisionBroadphase& temp)
+{
+  if(bp == NULL) bp = &broadphase;
+  if(AtomicExchange(&bp->inUse,1) == 0) return *bp;
+  return temp;
+}
+
+void WorldPlannerSettings::ReleaseBroadphase(CollisionBroadphase& used)
+{
+  AtomicExchange(&used.inUse,0);
+}
+
+pair<int,int> WorldPlannerSettings::SweepCollisions(CollisionBroadphase& broadphase,Real tol)
+{
+  broadphase.Sort();
+  const vector<int>& order = broadphase.order;
+  for(size_t i=0;i<order.size();i++) {
+    const CollisionBroadphase::Item& a = broadphase.items[order[i]];
+    if(!a.mask) continue;
+    Real xmax = a.bb.bmax.x + tol;
+    for(size_t j=i+1;j<order.size();j++) {
+      const CollisionBroadphase::Item& b = broadphase.items[order[j]];
+      if(b.bb.bmin.x > xmax) break;
+      //one must be in set 1 and the other in set 2
+      bool ab = ((a.mask & 1) && (b.mask & 2));
+      bool ba = ((b.mask & 1) && (a.mask & 2));
+      if(!ab && !ba) continue;
+      if(b.bb.bmin.y > a.bb.bmax.y + tol || a.bb.bmin.y > b.bb.bmax.y + tol) continue;
+      if(b.bb.bmin.z > a.bb.bmax.z + tol || a.bb.bmin.z > b.bb.bmax.z + tol) continue;
+      int id1 = (ab ? order[i] : order[j]);
+      int id2 = (ab ? order[j] : order[i]);
+      if(collisionEnabled(id1,id2) || collisionEnabled(id2,id1)) {
+        if(::CheckCollision(a.geometry,b.geometry,tol))
+          return pair<int,int>(id1,id2);
       }
     }
   }
   return pair<int,int>(-1,-1);
 }
 
-pair<int,int> WorldPlannerSettings::CheckCollision(RobotWorld& world,const vector<int>& ids1,const vector<int>& ids2,Real tol)
+pair<int,int> WorldPlannerSettings::CheckCollision(RobotWorld& world,const vector<int>& ids,Real tol,CollisionBroadphase* broadphase)
+{
+  //first, get all the geometries
+  vector<Geometry::AnyCollisionGeometry3D*> geoms;
+  vector<int> activeids;
+  GetGeometries(world,ids,geoms,activeids);
+  return CheckCollision(world.NumIDs(),geoms,activeids,tol,broadphase);
+}
+
+pair<int,int> WorldPlannerSettings::CheckCollision(int numIDs,const vector<Geometry::AnyCollisionGeometry3D*>& geoms,const vector<int>& ids,Real tol,CollisionBroadphase* broadphase)
+{
+  CollisionBroadphase temp;
+  CollisionBroadphase& bp = AcquireBroadphase(broadphase,temp);
+  bp.Update(numIDs,geoms,ids);
+  for(size_t i=0;i<ids.size();i++)
+    bp.items[ids[i]].mask = 3;
+  pair<int,int> res = SweepCollisions(bp,tol);
+  for(size_t i=0;i<ids.size();i++)
+    bp.items[ids[i]].mask = 0;
+  ReleaseBroadphase(bp);
+  return res;
+}
+
+pair<int,int> WorldPlannerSettings::CheckCollision(RobotWorld& world,const vector<int>& ids1,const vector<int>& ids2,Real tol,CollisionBroadphase* broadphase)
 {
   //first, get all the geometries
   vector<Geometry::AnyCollisionGeometry3D*> geoms1,geoms2;
   vector<int> activeids1,activeids2;
   GetGeometries(world,ids1,geoms1,activeids1);
   GetGeometries(world,ids2,geoms2,activeids2);
+  return CheckCollision(world.NumIDs(),geoms1,activeids1,geoms2,activeids2,tol,broadphase);
+}
 
-  Vector3 d(tol*0.5); //adjustment
-  vector<AABB3D> bbs1(geoms1.size()),bbs2(geoms2.size());
-  for(size_t i=0;i<geoms1.size();i++) {
-    bbs1[i]=geoms1[i]->GetAABB();
-    bbs1[i].bmin -= d;
-    bbs1[i].bmax += d;
-  }
-  for(size_t i=0;i<geoms2.size();i++) {
-    bbs2[i]=geoms2[i]->GetAABB();
-    bbs2[i].bmin -= d;
-    bbs2[i].bmax += d;
-  }
-
-  //quick reject: anything in set2 that doesn't intersect entire set1 bb can be erased from consideration
-  AABB3D bb;
-  bb.minimize();
-  for(size_t i=0;i<bbs1.size();i++)
-    bb.setUnion(bbs1[i]);
-  for(size_t i=0;i<bbs2.size();i++)
-    if(!bbs2[i].intersects(bb)) { //erase
-      activeids2[i] = activeids2.back();
-      geoms2[i] = geoms2.back();
-      bbs2[i] = bbs2.back();
-      activeids2.resize(activeids2.size()-1);
-      geoms2.resize(geoms2.size()-1);
-      bbs2.resize(bbs2.size()-1);
-      i--;
-    }
-  bb.minimize();
-  for(size_t i=0;i<bbs2.size();i++)
-    bb.setUnion(bbs2[i]);
-  for(size_t i=0;i<bbs1.size();i++)
-    if(!bbs1[i].intersects(bb)) { //erase
-      activeids1[i] = activeids1.back();
-      geoms1[i] = geoms1.back();
-      bbs1[i] = bbs1.back();
-      activeids1.resize(activeids1.size()-1);
-      geoms1.resize(geoms1.size()-1);
-      bbs1.resize(bbs1.size()-1);
-      i--;
-    }
-  
-
-  for(size_t i=0;i<activeids1.size();i++) {
-    for(size_t j=0;j<activeids2.size();j++) {
-      if(collisionEnabled(activeids1[i],activeids2[j]) || collisionEnabled(activeids2[j],activeids1[i])) {
-        if(bbs1[i].intersects(bbs2[j])) {
-          if(::CheckCollision(geoms1[i],geoms2[j],tol))
-            return pair<int,int>(activeids1[i],activeids2[j]);
-        }
-      }
-    }
-  }
-  return pair<int,int>(-1,-1);
+pair<int,int> WorldPlannerSettings::CheckCollision(int numIDs,const vector<Geometry::AnyCollisionGeometry3D*>& geoms1,const vector<int>& ids1,const vector<Geometry::AnyCollisionGeometry3D*>& geoms2,const vector<int>& ids2,Real tol,CollisionBroadphase* broadphase)
+{
+  CollisionBroadphase temp;
+  CollisionBroadphase& bp = AcquireBroadphase(broadphase,temp);
+  bp.Update(numIDs,geoms1,ids1);
+  bp.Update(numIDs,geoms2,ids2);
+  for(size_t i=0;i<ids1.size();i++)
+    bp.items[ids1[i]].mask |= 1;
+  for(size_t i=0;i<ids2.size();i++)
+    bp.items[ids2[i]].mask |= 2;
+  pair<int,int> res = SweepCollisions(bp,tol);
+  for(size_t i=0;i<ids1.size();i++)
+    bp.items[ids1[i]].mask = 0;
+  for(size_t i=0;i<ids2.size();i++)
+    bp.items[ids2[i]].mask = 0;
+  ReleaseBroadphase(bp);
+  return res;
 }
 
 bool WorldPlannerSettings::CheckCollision(RobotWorld& world,AnyCollisionGeometry3D* geom,int id,Real tol)
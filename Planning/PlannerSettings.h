@@ -13,6 +13,7 @@ struct RobotPlannerSettings
   AABB3D worldBounds;      ///<base position sampling range for free-floating robots
   Real contactEpsilon;     ///<convergence threshold for contact solving
   int contactIKMaxIters;   ///<max iters for contact solving
+  int numEdgeCheckThreads; ///<threads used for edge checks, <= 0 uses all hardware threads
   PropertyMap properties;  ///<other properties
 };
 
@@ -31,12 +32,65 @@ struct TerrainPlannerSettings
   PropertyMap properties;  ///<other properties
 };
 
+/** @brief A persistent sweep-and-prune broadphase over the geometries of a
+ * RobotWorld, used by WorldPlannerSettings::CheckCollision.
+ *
+ * Items are indexed by world ID and remember the geometry transform at which
+ * their bounding box was computed, so Update() only recomputes the boxes of
+ * geometries that have moved.  The sweep order along the x axis is kept
+ * between calls and repaired by insertion sort, which takes nearly linear
+ * time when geometries move only slightly between queries, as they do in
+ * feasibility and edge checks.
+ *
+ * Update() notices geometries that were added, removed, or replaced, but
+ * not geometries that were edited in place; call Clear() after such edits.
+ *
+ * Not safe to use from several threads at once.  Copies start out empty
+ * and not in use, so each copy of a planning space gets its own broadphase.
+ */
+struct CollisionBroadphase
+{
+  struct Item
+  {
+    Geometry::AnyCollisionGeometry3D* geometry;
+    RigidTransform T;  ///<geometry transform at which bb was computed
+    AABB3D bb;
+    int mask;          ///<membership in the current query sets
+  };
+
+  CollisionBroadphase();
+  CollisionBroadphase(const CollisionBroadphase& rhs);
+  ///Clears this broadphase rather than copying rhs
+  const CollisionBroadphase& operator = (const CollisionBroadphase& rhs);
+  void Clear();
+  ///Makes sure the bounding boxes of the given geometries, with the given
+  ///world IDs, are up to date.  numIDs is world.NumIDs().
+  void Update(int numIDs,const vector<Geometry::AnyCollisionGeometry3D*>& geoms,const vector<int>& ids);
+  ///Restores the sweep order after Update()
+  void Sort();
+
+  vector<Item> items;  ///<indexed by world ID
+  vector<int> order;   ///<IDs of items with geometry, sorted by bb.bmin.x
+  ///False if items were added since the last Sort(), in which case order
+  ///is fully re-sorted rather than repaired
+  bool nearlySorted;
+  ///Set while a CheckCollision call is using this broadphase
+  volatile int inUse;
+};
+
 /** @brief A structure containing settings that should be used for collision
  * detection, contact solving, etc.  Also performs modified collision
  * checking with enabled/disabled collision checking between different objects.
  * 
  * Make sure to call world.UpdateGeometry() before using the CheckCollision and
  * DistanceLowerBound routines.
+ *
+ * The set versions of CheckCollision use a persistent broadphase, so they are
+ * cheapest when called repeatedly as the world moves.  Callers that check
+ * from several threads, such as copies of a planning space, should pass
+ * their own broadphase.  Otherwise the settings' broadphase is used, and a
+ * call that finds it in use by another thread builds a temporary one for
+ * that query instead.
  */
 struct WorldPlannerSettings
 {
@@ -60,12 +114,19 @@ struct WorldPlannerSettings
   ///tol indicates an extra collision margin on top of the
   ///custom collision margins.  Returns (-1,-1) if no collisions are
   ///found, or the pair of ids of the first colliding objects.
-  pair<int,int> CheckCollision(RobotWorld& world,const vector<int>& ids,Real tol=0);
+  ///If broadphase is given, it is used instead of the settings' own.
+  pair<int,int> CheckCollision(RobotWorld& world,const vector<int>& ids,Real tol=0,CollisionBroadphase* broadphase=NULL);
   ///Checks collisions between all objects in set 1 against those of set 2.
   ///tol indicates an extra collision margin on top of the
   ///custom collision margins. Returns (-1,-1) if no collisions are
   ///found, or the pair of ids of the first colliding objects.
-  pair<int,int> CheckCollision(RobotWorld& world,const vector<int>& ids1,const vector<int>& ids2,Real tol=0);
+  ///If broadphase is given, it is used instead of the settings' own.
+  pair<int,int> CheckCollision(RobotWorld& world,const vector<int>& ids1,const vector<int>& ids2,Real tol=0,CollisionBroadphase* broadphase=NULL);
+  ///Same as the set versions above, but the geometries of each set are
+  ///given along with their world IDs, which need not be the world's own
+  ///geometries.  numIDs is world.NumIDs().
+  pair<int,int> CheckCollision(int numIDs,const vector<Geometry::AnyCollisionGeometry3D*>& geoms,const vector<int>& ids,Real tol=0,CollisionBroadphase* broadphase=NULL);
+  pair<int,int> CheckCollision(int numIDs,const vector<Geometry::AnyCollisionGeometry3D*>& geoms1,const vector<int>& ids1,const vector<Geometry::AnyCollisionGeometry3D*>& geoms2,const vector<int>& ids2,Real tol=0,CollisionBroadphase* broadphase=NULL);
 
   ///Returns a distance, with the possibility of early termination if the
   ///closest object is farther than the given bound. eps is a distance error
@@ -99,10 +160,24 @@ struct WorldPlannerSettings
 				 vector<int>& checkedIDs,
 				 vector<Geometry::AnyCollisionQuery>& queries);
 
+  ///Used internally by CheckCollision: sweeps the broadphase items whose
+  ///masks are set, and narrowphase-checks overlapping enabled pairs.
+  pair<int,int> SweepCollisions(CollisionBroadphase& broadphase,Real tol);
+  ///Used internally by CheckCollision: returns bp, or the persistent
+  ///broadphase if bp is NULL, unless another thread is using it, in which
+  ///case temp is returned.  Pass the result to ReleaseBroadphase when done.
+  CollisionBroadphase& AcquireBroadphase(CollisionBroadphase* bp,CollisionBroadphase& temp);
+  void ReleaseBroadphase(CollisionBroadphase& used);
+
   Array2D<bool> collisionEnabled;    //indexed by world ID #
   vector<RobotPlannerSettings> robotSettings;
   vector<ObjectPlannerSettings> objectSettings;
   vector<TerrainPlannerSettings> terrainSettings;
+  CollisionBroadphase broadphase;
 };
 
+///Gets the non-empty geometries of the given world IDs, expanding robot IDs
+///into their links, and appends them and their IDs to geoms and activeids
+void GetGeometries(RobotWorld& world,const vector<int>& ids,vector<Geometry::AnyCollisionGeometry3D*>& geoms,vector<int>& activeids);
+
 #endif
@@ -7,6 +7,7 @@
 #include <KrisLibrary/math/differentiation.h>
 #include <KrisLibrary/optimization/Minimization.h>
 #include <string.h>
+#include <algorithm>
 #include <typeinfo>
 
 
@@ -357,10 +358,23 @@ struct RealTimePlannerData
   Real startPlanTime;       //(out) time of planning
   bool planning;           //(out) currently planning
 
-  bool pathRefresh;         //(in/out) whether to refresh the path
-  Real tcut;                //(out) the path cut time, relative to startPlanTime
-  ParabolicRamp::DynamicPath path;  //(out) the path to splice in 
-  bool pathRefreshSuccess;  //(in) whether the execution thread read in the path successfully
+
+  //path updates are passed between the threads without locking the mutex
+  struct PathUpdate
+  {
+    int id;                   //sequence number of the update, starting at 1
+    Real startPlanTime;       //time of planning
+    Real tcut;                //the path cut time, relative to startPlanTime
+    ParabolicRamp::DynamicPath path;  //the path to splice in
+  };
+  TripleBuffer<PathUpdate> updates;  //(out) the most recent path update
+  int lastUpdateID;         //id of the last update published by the planner
+  bool pendingUpdate;       //execution thread only: updates.Front() has not been sent
+  //the planner waits on sendDone for the execution thread to read its update
+  Mutex sendMutex;
+  Condition sendDone;
+  int sendResult;           //(in) 2*id of the last update read by the execution thread, plus 1 if it was sent successfully
+  bool stopSending;         //(in) set by Stop() to release a waiting planner
 };
 
 /** @brief For use with a multithreaded RealTimePlannerBase
@@ -379,28 +393,21 @@ RealTimePlannerDataSender::RealTimePlannerDataSender(RealTimePlannerData* _data)
 
 bool RealTimePlannerDataSender::Send(Real tplanstart,Real tcut,const ParabolicRamp::DynamicPath& path)
 {
-  {
-    ScopedLock lock(data->mutex);
-    Assert(data->startPlanTime == tplanstart);
-    data->pathRefresh = true;
-    data->tcut = tcut;
-    data->path = path;
-  }  
-  int iters=0;
-  while(true) {
-    ThreadSleep(0.001);
-    {
-      ScopedLock lock(data->mutex);
-      if(!data->pathRefresh) {  //this signals that the calling thread picked up the data
-	bool res = data->pathRefreshSuccess;
-	return res; //unlocks mutex
-      }
-    }//unlocks mutex
-    iters ++ ;
-    if(iters % 1000 == 0) {
-      fprintf(stderr,"Data sender is waiting for a long time... Did you forget to call RealTimePlanningThread.SendUpdate()?\n");
-    }
-  }
+  RealTimePlannerData::PathUpdate& update = data->updates.Back();
+  int id = ++data->lastUpdateID;
+  update.id = id;
+  update.startPlanTime = tplanstart;
+  update.tcut = tcut;
+  update.path = path;
+  data->updates.Publish();
+  //only the planning thread waits for the execution thread to pick up the
+  //data, since the planner needs to know whether the send succeeded
+  ScopedLock lock(data->sendMutex);
+  while(data->sendResult/2 != id) {
+    if(data->stopSending) return false;
+    data->sendDone.wait(data->sendMutex);
+  }
+  return (data->sendResult%2 == 1);
 }  
 
 void* planner_thread_func(void * ptr)
@@ -438,7 +445,6 @@ void* planner_thread_func(void * ptr)
 	ThreadSleep(0.1);
 	continue;
       }
-      assert(data->pathRefresh == false);
       if(data->resetStartConfig == true) {
 	printf("Planning thread: resetting start configuration\n");
 	data->planner->SetConstantPath(data->startConfig);
@@ -489,7 +495,10 @@ RealTimePlanningThread::RealTimePlanningThread()
   data->resetStartConfig = false;
   data->planner = NULL;
   data->planning = false;
-  data->pathRefresh = false;
+  data->lastUpdateID = 0;
+  data->pendingUpdate = false;
+  data->sendResult = 0;
+  data->stopSending = false;
 }
 
 RealTimePlanningThread::~RealTimePlanningThread()
@@ -621,7 +630,13 @@ bool RealTimePlanningThread::Start()
   data->active = true;
   data->pause = false;
   data->globalTime = 0;
-  data->pathRefresh = false;
+  //drop any update left over from a previous run.  The planning thread
+  //is not running, so both ends of the buffer may be touched here
+  data->updates.Update();
+  data->lastUpdateID = 0;
+  data->pendingUpdate = false;
+  data->sendResult = 0;
+  data->stopSending = false;
   printf("Creating planning thread\n");
   thread = ThreadStart(planner_thread_func,data);
   return true;
@@ -675,51 +690,65 @@ void RealTimePlanningThread::Stop()
     planner->StopPlanning();
     data->active = false;
   }
+  //release the planner if it is waiting for an update to be picked up
+  {
+    ScopedLock lock(data->sendMutex);
+    data->stopSending = true;
+    data->sendDone.broadcast();
+  }
   ThreadJoin(thread);
 }
 
 bool RealTimePlanningThread::HasUpdate()
 {
   RealTimePlannerData* data = reinterpret_cast<RealTimePlannerData*>(internal);
-  return data->pathRefresh;
+  if(data->updates.Update())
+    data->pendingUpdate = true;
+  return data->pendingUpdate;
 }
 
 bool RealTimePlanningThread::SendUpdate(MotionQueueInterface* robotInterface)
 {
   RealTimePlannerData* data = reinterpret_cast<RealTimePlannerData*>(internal);
   //see if the planning thread has a plan update
-  if(!data->pathRefresh) {
+  if(!HasUpdate()) {
     data->globalTime = robotInterface->GetCurTime();
     return false;
   }
 
   //if so, mark that it's refreshed and send the path
-  ScopedLock lock(data->mutex);
+  RealTimePlannerData::PathUpdate& update = data->updates.Front();
+  data->pendingUpdate = false;
   printf("Exec thread: SendUpdate: Refreshing path...\n");
-  data->pathRefresh = false;
-  MotionQueueInterface::MotionResult res = robotInterface->SendPathImmediate(data->startPlanTime+data->tcut,data->path);
+  MotionQueueInterface::MotionResult res = robotInterface->SendPathImmediate(update.startPlanTime+update.tcut,update.path);
   Real t=robotInterface->GetCurTime();
-  if(res == MotionQueueInterface::Success) {
-    data->pathRefreshSuccess = true;
-    printf("Exec thread: Plan+send successful, split %g, delay %g\n",data->tcut,t - data->startPlanTime);
-    data->globalTime = robotInterface->GetCurTime();
-    return true;
+  bool success = (res == MotionQueueInterface::Success);
+  if(success) {
+    sendDelays.Add(t - update.startPlanTime);
+    printf("Exec thread: Plan+send successful, split %g, delay %g\n",update.tcut,t - update.startPlanTime);
   }
   else {
-    data->pathRefreshSuccess = false;
-    printf("Exec thread: Plan+send overrun, split %g, delay %g\n",data->tcut,t - data->startPlanTime);
-    data->globalTime = robotInterface->GetCurTime();
-    return false;
+    overrunDelays.Add(t - update.startPlanTime);
+    printf("Exec thread: Plan+send overrun, split %g, delay %g\n",update.tcut,t - update.startPlanTime);
+  }
+  data->globalTime = robotInterface->GetCurTime();
+  //this signals that the path was picked up
+  {
+    ScopedLock lock(data->sendMutex);
+    data->sendResult = update.id*2+(success?1:0);
+    data->sendDone.signal();
   }
+  return success;
 }
 
 Real RealTimePlanningThread::ObjectiveValue()
 {
   RealTimePlannerData* data = reinterpret_cast<RealTimePlannerData*>(internal);
+  if(!HasUpdate()) return Inf;
   ScopedLock lock(data->mutex);
-  if(!data->pathRefresh) return Inf;
   if(!data->objective) return 0;
-  return data->objective->PathCost(data->path,data->startPlanTime+data->tcut);
+  const RealTimePlannerData::PathUpdate& update = data->updates.Front();
+  return data->objective->PathCost(update.path,update.startPlanTime+update.tcut);
 }
 
 
@@ -727,6 +756,43 @@ Real RealTimePlanningThread::ObjectiveValue()
 
 
 
+LatencyHistogram::LatencyHistogram(Real _binWidth,int numBins)
+  :binWidth(_binWidth),counts(numBins,0)
+{}
+
+void LatencyHistogram::Clear()
+{
+  fill(counts.begin(),counts.end(),0);
+  stats.clear();
+}
+
+void LatencyHistogram::Add(Real value)
+{
+  int bin = (int)Floor(value/binWidth);
+  if(bin < 0) bin = 0;
+  if(bin >= (int)counts.size()) bin = (int)counts.size()-1;
+  counts[bin]++;
+  stats.collect(value);
+}
+
+void LatencyHistogram::Print(FILE* f) const
+{
+  if(stats.number() == 0) {
+    fprintf(f,"  no samples\n");
+    return;
+  }
+  fprintf(f,"  %d samples, mean %g, min %g, max %g\n",(int)stats.number(),stats.mean(),stats.minimum(),stats.maximum());
+  for(size_t i=0;i<counts.size();i++) {
+    if(counts[i] == 0) continue;
+    if(i+1 == counts.size())
+      fprintf(f,"  >= %g: %d\n",binWidth*i,counts[i]);
+    else
+      fprintf(f,"  [%g,%g): %d\n",binWidth*i,binWidth*(i+1),counts[i]);
+  }
+}
+
+
+
 DynamicMotionPlannerBase::DynamicMotionPlannerBase()
   :robot(NULL),settings(NULL),cspace(NULL),tstart(0)
 {
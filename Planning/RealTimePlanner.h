@@ -6,6 +6,7 @@
 #include "PlannerObjective.h"
 #include "RampCSpace.h"
 #include "Modeling/DynamicPath.h"
+#include "Modeling/TripleBuffer.h"
 #include <KrisLibrary/utils/StatCollector.h>
 #include <KrisLibrary/utils/threadutils.h>
 #include <KrisLibrary/Timer.h>
@@ -254,10 +255,35 @@ public:
   StatCollector planFailTimeStats,planSuccessTimeStats,planTimeoutTimeStats;
 };
 
+/** @brief A histogram of latencies with fixed-width bins.  The last bin
+ * also counts all values past the end of the range.
+ */
+class LatencyHistogram
+{
+ public:
+  LatencyHistogram(Real binWidth=0.01,int numBins=50);
+  void Clear();
+  void Add(Real value);
+  void Print(FILE* f=stdout) const;
+
+  Real binWidth;
+  vector<int> counts;
+  StatCollector stats;
+};
+
 /** @brief An interface to a planning thread.
  * 
  * All methods are thread-safe and meant to be called by the execution
- * thread.
+ * thread.  Path updates are handed from the planning thread through a
+ * TripleBuffer, so HasUpdate() and SendUpdate() never wait on the planner.
+ * The planner sleeps until SendUpdate() reports whether its update was
+ * sent, or until Stop() is called.  Start() discards any update left over
+ * from a previous run.
+ *
+ * sendDelays and overrunDelays record the time from the start of each
+ * planning cycle to the send of its path, for successful and failed sends
+ * respectively.  They are updated by SendUpdate() and should only be read
+ * from the execution thread.
  *
  * Example code is as follows:
  *
@@ -329,6 +355,7 @@ class RealTimePlanningThread
   void* internal;
   SmartPointer<RealTimePlanner> planner;
   Thread thread;
+  LatencyHistogram sendDelays,overrunDelays;
 };
 
 #endif
@@ -1,5 +1,7 @@
 #include "RobotCSpace.h"
 #include "Modeling/Interpolate.h"
+#include "Modeling/ParallelFor.h"
+#include "Modeling/Atomic.h"
 #include <KrisLibrary/math/angle.h>
 #include <KrisLibrary/math/random.h>
 #include <KrisLibrary/math3d/rotation.h>
@@ -11,32 +13,71 @@
 #include <KrisLibrary/planning/CSetHelpers.h>
 #include <KrisLibrary/planning/CSpaceHelpers.h>
 #include <KrisLibrary/Timer.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <boost/functional.hpp>
 #include <sstream>
 
-Real RandLaplacian()
+//The sampling helpers below draw from rng if it is given, and otherwise
+//from the global generator
+
+static Real StreamRand(RandomStream* rng,Real a,Real b)
+{
+  if(rng) return rng->Rand(a,b);
+  return Rand(a,b);
+}
+
+//a uniformly distributed rotation
+static void StreamRandRotation(RandomStream* rng,QuaternionRotation& q)
 {
-  Real v = Rand();
+  if(!rng) {
+    RandRotation(q);
+    return;
+  }
+  Real u1=rng->Rand(),u2=rng->Rand(0,TwoPi),u3=rng->Rand(0,TwoPi);
+  Real a=Sqrt(1.0-u1),b=Sqrt(u1);
+  q.w = a*Sin(u2);
+  q.x = a*Cos(u2);
+  q.y = b*Sin(u3);
+  q.z = b*Cos(u3);
+}
+
+//a uniformly distributed point on the sphere of radius r
+static void StreamSampleSphere(RandomStream* rng,Real r,Vector3& v)
+{
+  if(!rng) {
+    SampleSphere(r,v);
+    return;
+  }
+  do {
+    v.set(rng->RandGaussian(),rng->RandGaussian(),rng->RandGaussian());
+  } while(v.normSquared() == 0);
+  v *= r/v.norm();
+}
+
+Real RandLaplacian(RandomStream* rng=NULL)
+{
+  Real v = (rng ? rng->Rand() : Rand());
   if(v==0) v = Epsilon;
   return -Log(v);
 }
 
-Real RandTwoSidedLaplacian()
+Real RandTwoSidedLaplacian(RandomStream* rng=NULL)
 {
-  if(RandBool(0.5)) return RandLaplacian();
-  else return -RandLaplacian();
+  bool positive = (rng ? rng->Rand() < 0.5 : RandBool(0.5));
+  if(positive) return RandLaplacian(rng);
+  else return -RandLaplacian(rng);
 }
 
-Real SafeRand(Real a,Real b)
+Real SafeRand(Real a,Real b,RandomStream* rng=NULL)
 {
-  if(IsInf(a) && IsInf(b)) return RandTwoSidedLaplacian();
-  else if(IsInf(a)) return b-RandLaplacian();
-  else if(IsInf(b)) return a+RandLaplacian();
-  else return Rand(a,b);
+  if(IsInf(a) && IsInf(b)) return RandTwoSidedLaplacian(rng);
+  else if(IsInf(a)) return b-RandLaplacian(rng);
+  else if(IsInf(b)) return a+RandLaplacian(rng);
+  else return StreamRand(rng,a,b);
 }
 
 RobotCSpace::RobotCSpace(Robot& _robot)
-  :robot(_robot),norm(2.0)
+  :robot(_robot),norm(2.0),rng(NULL)
 {
   floatingRotationWeight=1;
   floatingRotationRadiusScale=1;
@@ -50,7 +91,8 @@ RobotCSpace::RobotCSpace(Robot& _robot)
 RobotCSpace::RobotCSpace(const RobotCSpace& space)
 :robot(space.robot),norm(space.norm),
 jointWeights(space.jointWeights),floatingRotationWeight(space.floatingRotationWeight),
-jointRadiusScale(space.jointRadiusScale),floatingRotationRadiusScale(space.floatingRotationRadiusScale)
+jointRadiusScale(space.jointRadiusScale),floatingRotationRadiusScale(space.floatingRotationRadiusScale),
+rng(space.rng)
 {
   CopyConstraints(&space);
 }
@@ -73,10 +115,10 @@ void RobotCSpace::Sample(Config& q)
     case RobotJoint::Weld:
       break;
     case RobotJoint::Normal:
-      robot.q(link) = Rand(robot.qMin(link),robot.qMax(link));
+      robot.q(link) = StreamRand(rng,robot.qMin(link),robot.qMax(link));
       break;
     case RobotJoint::Spin:
-      robot.q(link) = Rand(0,TwoPi);
+      robot.q(link) = StreamRand(rng,0,TwoPi);
       break;
     case RobotJoint::FloatingPlanar:
       {
@@ -84,20 +126,20 @@ void RobotCSpace::Sample(Config& q)
       assert(p>=0);
       int pp = robot.parents[p];
       assert(pp>=0);
-      robot.q(link) = Rand(0,TwoPi);
-      robot.q(p) = SafeRand(robot.qMin(p),robot.qMax(p));
-      robot.q(pp) = SafeRand(robot.qMin(pp),robot.qMax(pp));
+      robot.q(link) = StreamRand(rng,0,TwoPi);
+      robot.q(p) = SafeRand(robot.qMin(p),robot.qMax(p),rng);
+      robot.q(pp) = SafeRand(robot.qMin(pp),robot.qMax(pp),rng);
       break;
       }
     case RobotJoint::Floating:
     case RobotJoint::BallAndSocket:
       {
 	RigidTransform T;
-  T.t.x = RandTwoSidedLaplacian();
-  T.t.y = RandTwoSidedLaplacian();
-  T.t.z = RandTwoSidedLaplacian();
+  T.t.x = RandTwoSidedLaplacian(rng);
+  T.t.y = RandTwoSidedLaplacian(rng);
+  T.t.z = RandTwoSidedLaplacian(rng);
 	QuaternionRotation qr;
-	RandRotation(qr);
+	StreamRandRotation(rng,qr);
 	qr.getMatrix(T.R);
 	robot.SetJointByTransform(i,robot.joints[i].linkIndex,T);
       }
@@ -108,7 +150,7 @@ void RobotCSpace::Sample(Config& q)
   }
   for(size_t i=0;i<robot.drivers.size();i++) {
     if(robot.drivers[i].type != RobotJointDriver::Normal) {
-      Real val = Rand(robot.drivers[i].qmin,robot.drivers[i].qmax);
+      Real val = StreamRand(rng,robot.drivers[i].qmin,robot.drivers[i].qmax);
       robot.SetDriverValue(i,val);
     }
   }
@@ -131,21 +173,21 @@ void RobotCSpace::SampleNeighborhood(const Config& c,Real r,Config& q)
     case RobotJoint::Weld:
       break;
     case RobotJoint::Normal:
-      robot.q(link) += Rand(-ri,ri);
+      robot.q(link) += StreamRand(rng,-ri,ri);
       break;
     case RobotJoint::Spin:
-      robot.q(link) += Rand(-ri,ri);
+      robot.q(link) += StreamRand(rng,-ri,ri);
       break;
     case RobotJoint::Floating:
     case RobotJoint::BallAndSocket:
       {
 	RigidTransform T = robot.links[link].T_World;
-	T.t.x += Rand(-ri,ri);
-	T.t.y += Rand(-ri,ri);
-	T.t.z += Rand(-ri,ri);
+	T.t.x += StreamRand(rng,-ri,ri);
+	T.t.y += StreamRand(rng,-ri,ri);
+	T.t.z += StreamRand(rng,-ri,ri);
 	AngleAxisRotation aa;
-	SampleSphere(1.0,aa.axis);
-	aa.angle = Rand(-ri/floatingRotationRadiusScale,ri/floatingRotationRadiusScale);
+	StreamSampleSphere(rng,1.0,aa.axis);
+	aa.angle = StreamRand(rng,-ri/floatingRotationRadiusScale,ri/floatingRotationRadiusScale);
 	Matrix3 Rperturb;
 	aa.getMatrix(Rperturb);
 	T.R = Rperturb*T.R;
@@ -161,7 +203,7 @@ void RobotCSpace::SampleNeighborhood(const Config& c,Real r,Config& q)
       Real val = robot.GetDriverValue(i);
       Real scale = 1.0;
       //TODO: figure out the proper scale factor
-      robot.SetDriverValue(i,val + Rand(-r,r));
+      robot.SetDriverValue(i,val + StreamRand(rng,-r,r));
     }
   }
   q = robot.q;
@@ -567,7 +609,22 @@ SingleRobotCSpace::SingleRobotCSpace(const SingleRobotCSpace& space)
   Init();
 }
 
-bool SingleRobotCSpace::CheckJointLimits(const Config& x)
+//copies the kinematics, joints, and drivers of src but not its geometry
+static Robot* CopyRobotKinematics(const Robot& src)
+{
+  Robot* robot = new Robot;
+  static_cast<RobotDynamics3D&>(*robot) = src;
+  robot->name = src.name;
+  robot->accMax = src.accMax;
+  robot->joints = src.joints;
+  robot->drivers = src.drivers;
+  robot->linkNames = src.linkNames;
+  robot->driverNames = src.driverNames;
+  return robot;
+}
+
+//changes the configuration of robot to x
+static bool InJointLimits(Robot& robot,const Config& x)
 {
   robot.UpdateConfig(x);
   for(size_t i=0;i<robot.joints.size();i++) {
@@ -589,6 +646,11 @@ bool SingleRobotCSpace::CheckJointLimits(const Config& x)
   return true;
 }
 
+bool SingleRobotCSpace::CheckJointLimits(const Config& x)
+{
+  return InJointLimits(robot,x);
+}
+
 bool SingleRobotCSpace::UpdateGeometry(const Config& x)
 {
   robot.UpdateConfig(x);
@@ -627,6 +689,7 @@ public:
 
 void SingleRobotCSpace::Init()
 {
+  broadphase.Clear();
   if(!constraintsDirty) return;
   constraints.resize(0);
   constraintNames.resize(0);
@@ -710,26 +773,47 @@ void SingleRobotCSpace::Init()
     settings->collisionEnabled(ignoreCollisions[i].first,ignoreCollisions[i].second) = oldCheckCollisions[i];
     settings->collisionEnabled(ignoreCollisions[i].second,ignoreCollisions[i].first) = oldCheckCollisions[i];
   }
+  threadData.clear();
   constraintsDirty = false;
 }
 
+void SingleRobotCSpace::InitThreadData(int numThreads)
+{
+  for(size_t i=0;i<threadData.size();i++)
+    if(!threadData[i]->IsCurrent())
+      threadData[i] = new SingleRobotCSpaceThreadData(this);
+  while((int)threadData.size() < numThreads)
+    threadData.push_back(new SingleRobotCSpaceThreadData(this));
+}
+
 void SingleRobotCSpace::Sample(Config& x)
 {
   RobotCSpace::Sample(x);
+  SampleFloatingBases(x);
+  ApplyFixedDofs(x);
+}
+
+void SingleRobotCSpace::SampleFloatingBases(Config& x,RandomStream* _rng)
+{
+  if(!_rng) _rng = rng;
   const AABB3D& bb=settings->robotSettings[index].worldBounds;
   for(size_t i=0;i<robot.joints.size();i++) {
     if(robot.joints[i].type == RobotJoint::Floating) {
       //generate a floating base position
       Vector3 p;
-      p.x = Rand(bb.bmin.x,bb.bmax.x);
-      p.y = Rand(bb.bmin.y,bb.bmax.y);
-      p.z = Rand(bb.bmin.z,bb.bmax.z);
+      p.x = StreamRand(_rng,bb.bmin.x,bb.bmax.x);
+      p.y = StreamRand(_rng,bb.bmin.y,bb.bmax.y);
+      p.z = StreamRand(_rng,bb.bmin.z,bb.bmax.z);
       vector<int> indices;
       robot.GetJointIndices(i,indices);
       for(size_t k=0;k<3;k++)
 	x(indices[k]) = p[k];
     }
   }
+}
+
+void SingleRobotCSpace::ApplyFixedDofs(Config& x) const
+{
   for(size_t j=0;j<fixedDofs.size();j++)
     x(fixedDofs[j]) = fixedValues[j];
 }
@@ -738,8 +822,7 @@ void SingleRobotCSpace::Sample(Config& x)
 void SingleRobotCSpace::SampleNeighborhood(const Config& c,Real r,Config& x)
 {
   RobotCSpace::SampleNeighborhood(c,r,x);
-  for(size_t j=0;j<fixedDofs.size();j++)
-    x(fixedDofs[j]) = fixedValues[j];
+  ApplyFixedDofs(x);
 }
 
 
@@ -768,13 +851,13 @@ bool SingleRobotCSpace::CheckCollisionFree(const Config& x)
       idothers.push_back(world.RobotID(i));
   }
   //environment collision check
-  pair<int,int> res = settings->CheckCollision(world,idrobot,idothers);
+  pair<int,int> res = settings->CheckCollision(world,idrobot,idothers,0,&broadphase);
   if(res.first >= 0) {
     //printf("Collision found: %s (%d) - %s (%d)\n",world.GetName(res.first).c_str(),res.first,world.GetName(res.second).c_str(),res.second);
     return false;
   }
   //self collision check
-  res = settings->CheckCollision(world,idrobot);
+  res = settings->CheckCollision(world,idrobot,0,&broadphase);
   if(res.first >= 0) {
     //printf("Self-collision found: %s %s\n",world.GetName(res.first).c_str(),world.GetName(res.second).c_str());
     return false;
@@ -794,6 +877,9 @@ EdgePlanner* SingleRobotCSpace::PathChecker(const Config& a,const Config& b,int
 
 EdgePlanner* SingleRobotCSpace::PathChecker(const Config& a,const Config& b)
 {
+  int numThreads = ResolveNumThreads(settings->robotSettings[index].numEdgeCheckThreads);
+  if(numThreads > 1)
+    return new ParallelEdgeChecker(this,a,b,settings->robotSettings[index].collisionEpsilon,numThreads);
   return new EpsilonEdgeChecker(this,a,b,settings->robotSettings[index].collisionEpsilon);
   //uncomment this if you need an explicit edge planner
   //return new ExplicitEdgePlanner(this,a,b);
@@ -801,6 +887,196 @@ EdgePlanner* SingleRobotCSpace::PathChecker(const Config& a,const Config& b)
 
 
 
+SingleRobotCSpaceThreadData::SingleRobotCSpaceThreadData(SingleRobotCSpace* _space)
+  :space(_space),robot(_space->robot)
+{
+  Robot& src = space->robot;
+  geometry.resize(src.links.size());
+  source.resize(src.links.size(),NULL);
+  for(size_t i=0;i<src.links.size();i++) {
+    if(src.IsGeometryEmpty(i)) continue;
+    source[i] = &*src.geometry[i];
+    geometry[i] = new Geometry::AnyCollisionGeometry3D(*src.geometry[i]);
+    linkGeoms.push_back(&*geometry[i]);
+    linkIDs.push_back(space->world.RobotLinkID(space->index,i));
+  }
+}
+
+bool SingleRobotCSpaceThreadData::IsCurrent() const
+{
+  Robot& src = space->robot;
+  if(src.links.size() != source.size()) return false;
+  for(size_t i=0;i<source.size();i++) {
+    Geometry::AnyCollisionGeometry3D* g = (src.IsGeometryEmpty(i) ? NULL : &*src.geometry[i]);
+    if(g != source[i]) return false;
+  }
+  return true;
+}
+
+void SingleRobotCSpaceThreadData::GetOtherGeometries(vector<Geometry::AnyCollisionGeometry3D*>& geoms,vector<int>& ids) const
+{
+  //the same geometries that SingleRobotCSpace::CheckCollisionFree checks
+  RobotWorld& world = space->world;
+  vector<int> idothers;
+  for(size_t i=0;i<world.terrains.size();i++)
+    idothers.push_back(world.TerrainID(i));
+  for(size_t i=0;i<world.rigidObjects.size();i++)
+    idothers.push_back(world.RigidObjectID(i));
+  for(size_t i=0;i<world.robots.size();i++) {
+    if((int)i != space->index)
+      idothers.push_back(world.RobotID(i));
+  }
+  geoms.resize(0);
+  ids.resize(0);
+  GetGeometries(world,idothers,geoms,ids);
+}
+
+bool SingleRobotCSpaceThreadData::CheckCollisionFree(const Config& x,const vector<Geometry::AnyCollisionGeometry3D*>& otherGeoms,const vector<int>& otherIDs)
+{
+  robot.UpdateConfig(x);
+  for(size_t i=0;i<geometry.size();i++)
+    if(!geometry[i].Empty()) geometry[i]->SetTransform(robot.links[i].T_World);
+  int numIDs = space->world.NumIDs();
+  WorldPlannerSettings* settings = space->settings;
+  if(settings->CheckCollision(numIDs,linkGeoms,linkIDs,otherGeoms,otherIDs,0,&broadphase).first >= 0) return false;
+  if(settings->CheckCollision(numIDs,linkGeoms,linkIDs,0,&broadphase).first >= 0) return false;
+  return true;
+}
+
+//a batch should have at least this many points per thread
+const static int kEdgePointsPerThread = 4;
+
+//Checks one point of a batch per work item, skipping the rest once a
+//collision has been found
+struct EdgeCheckBody : public ParallelForBody
+{
+  EdgeCheckBody(SingleRobotCSpace* _space,const vector<Config>& _points,const vector<Geometry::AnyCollisionGeometry3D*>& _otherGeoms,const vector<int>& _otherIDs)
+    :space(_space),points(_points),otherGeoms(_otherGeoms),otherIDs(_otherIDs),collision(0)
+  {}
+  virtual void Run(int index,int thread)
+  {
+    if(AtomicLoad(&collision)) return;
+    if(!space->threadData[thread]->CheckCollisionFree(points[index],otherGeoms,otherIDs))
+      AtomicExchange(&collision,1);
+  }
+
+  SingleRobotCSpace* space;
+  const vector<Config>& points;
+  const vector<Geometry::AnyCollisionGeometry3D*>& otherGeoms;
+  const vector<int>& otherIDs;
+  volatile int collision;
+};
+
+ParallelEdgeChecker::ParallelEdgeChecker(SingleRobotCSpace* _space,const Config& _a,const Config& _b,Real _epsilon,int _numThreads)
+  :space(_space),a(_a),b(_b),epsilon(_epsilon),numThreads(_numThreads)
+{}
+
+bool ParallelEdgeChecker::IsVisible()
+{
+  space->InitThreadData(numThreads);
+  vector<Geometry::AnyCollisionGeometry3D*> otherGeoms;
+  vector<int> otherIDs;
+  space->threadData[0]->GetOtherGeometries(otherGeoms,otherIDs);
+  //same points as EpsilonEdgeChecker: bisect until the spacing is below
+  //epsilon, checking the midpoints of each level
+  Real spacing = space->Distance(a,b);
+  int segs = 1;
+  vector<Config> points;
+  while(spacing > epsilon) {
+    points.resize(0);
+    while(spacing > epsilon && (int)points.size() < kEdgePointsPerThread*numThreads) {
+      segs *= 2;
+      spacing *= 0.5;
+      for(int k=1;k<segs;k+=2) {
+        points.resize(points.size()+1);
+        space->Interpolate(a,b,Real(k)/Real(segs),points.back());
+      }
+    }
+    //joint limits are cheap but use the shared robot
+    for(size_t i=0;i<points.size();i++)
+      if(!space->CheckJointLimits(points[i])) return false;
+    EdgeCheckBody body(space,points,otherGeoms,otherIDs);
+    ParallelFor((int)points.size(),body,numThreads);
+    if(body.collision) return false;
+  }
+  return true;
+}
+
+void ParallelEdgeChecker::Eval(Real u,Config& x) const
+{
+  space->Interpolate(a,b,u,x);
+}
+
+Real ParallelEdgeChecker::Length() const
+{
+  return space->Distance(a,b);
+}
+
+EdgePlanner* ParallelEdgeChecker::Copy() const
+{
+  return new ParallelEdgeChecker(space,a,b,epsilon,numThreads);
+}
+
+EdgePlanner* ParallelEdgeChecker::ReverseCopy() const
+{
+  return new ParallelEdgeChecker(space,b,a,epsilon,numThreads);
+}
+
+ThreadLocalRobotCSpace::ThreadLocalRobotCSpace(SingleRobotCSpace* _base,unsigned long long seed)
+  :RobotCSpace(*CopyRobotKinematics(_base->robot)),base(_base),data(_base),random(seed)
+{
+  rng = &random;
+  norm = base->norm;
+  jointWeights = base->jointWeights;
+  floatingRotationWeight = base->floatingRotationWeight;
+  jointRadiusScale = base->jointRadiusScale;
+  floatingRotationRadiusScale = base->floatingRotationRadiusScale;
+  //the joint limit constraints added by RobotCSpace are checked directly
+  constraints.resize(0);
+  constraintNames.resize(0);
+  data.GetOtherGeometries(otherGeoms,otherIDs);
+}
+
+void ThreadLocalRobotCSpace::Refresh()
+{
+  if(!data.IsCurrent()) data = SingleRobotCSpaceThreadData(base);
+  data.GetOtherGeometries(otherGeoms,otherIDs);
+}
+
+ThreadLocalRobotCSpace::~ThreadLocalRobotCSpace()
+{
+  delete &robot;
+}
+
+void ThreadLocalRobotCSpace::Sample(Config& x)
+{
+  RobotCSpace::Sample(x);
+  base->SampleFloatingBases(x,&random);
+  base->ApplyFixedDofs(x);
+}
+
+void ThreadLocalRobotCSpace::SampleNeighborhood(const Config& c,Real r,Config& x)
+{
+  RobotCSpace::SampleNeighborhood(c,r,x);
+  base->ApplyFixedDofs(x);
+}
+
+bool ThreadLocalRobotCSpace::IsFeasible(const Config& x)
+{
+  if(!InJointLimits(robot,x)) return false;
+  return data.CheckCollisionFree(x,otherGeoms,otherIDs);
+}
+
+EdgePlanner* ThreadLocalRobotCSpace::PathChecker(const Config& a,const Config& b)
+{
+  return new EpsilonEdgeChecker(this,a,b,base->settings->robotSettings[base->index].collisionEpsilon);
+}
+
+void ThreadLocalRobotCSpace::Properties(PropertyMap& map)
+{
+  base->Properties(map);
+}
+
 /*
 vector<pair<int,int> > linkIndices;
 vector<vector<Geometry::CollisionMeshQueryEnhanced> > linkCollisions;
@@ -3,9 +3,11 @@
 
 #include "Modeling/World.h"
 #include "Modeling/GeneralizedRobot.h"
+#include "Modeling/RandomStream.h"
 #include "PlannerSettings.h"
 #include <KrisLibrary/planning/CSpaceHelpers.h>
 #include <KrisLibrary/planning/RigidBodyCSpace.h>
+#include <KrisLibrary/planning/EdgePlanner.h>
 #include <KrisLibrary/utils/ArrayMapping.h>
 #include <KrisLibrary/utils/SmartPointer.h>
 
@@ -25,6 +27,9 @@
  * The 'XRadiusScale' members should be filled out if SampleNeigborhood
  * should use a different metric for sampling.
  *
+ * Sampling draws from KrisLibrary's global random number generator unless
+ * rng is set.
+ *
  * This class implements the proper geodesic for different robot
  * joint types (e.g. floating joints.)
  */
@@ -54,6 +59,8 @@ public:
   Real floatingRotationWeight;
   vector<Real> jointRadiusScale;
   Real floatingRotationRadiusScale;
+  ///optional: if set, Sample and SampleNeighborhood draw from this stream
+  RandomStream* rng;
 };
 
 
@@ -87,6 +94,8 @@ public:
 
 
 
+class SingleRobotCSpaceThreadData;
+
 /** @ingroup Planning
  * @brief A cspace consisting of a single robot configuration in a
  * RobotWorld.  Feasibility constraints are joint and collision constraints.
@@ -96,7 +105,10 @@ public:
  * Allows fixing dofs and ignoring collisions between certain object pairs using the
  * FixDof() / IgnoreCollisions() functions. 
  * IMPORTANT: After you call FixDof / IgnoreCollisions, you must call Init to reset the
- * constraints.
+ * constraints.  Also call Init after editing a geometry in the world in place.
+ *
+ * If the robot's numEdgeCheckThreads setting is not 1, PathChecker returns a
+ * ParallelEdgeChecker.
  */
 class SingleRobotCSpace : public RobotCSpace
 {
@@ -124,6 +136,15 @@ class SingleRobotCSpace : public RobotCSpace
   bool UpdateGeometry(const Config& x);
   bool CheckJointLimits(const Config& x);
   bool CheckCollisionFree(const Config& x);
+  ///Sets the position of floating bases in x to a random point in the
+  ///robot's worldBounds, drawn from rng if given, otherwise from this
+  ///space's rng
+  void SampleFloatingBases(Config& x,RandomStream* rng=NULL);
+  ///Sets the fixed dofs of x to their values
+  void ApplyFixedDofs(Config& x) const;
+  ///Makes sure threadData has at least numThreads entries, and replaces
+  ///those made before the robot's geometries were replaced
+  void InitThreadData(int numThreads);
 
   RobotWorld& world;
   int index;
@@ -131,6 +152,12 @@ class SingleRobotCSpace : public RobotCSpace
 
   vector<pair<int,int> > collisionPairs;
   vector<Geometry::AnyCollisionQuery> collisionQueries;
+  ///Used by CheckCollisionFree.  Each copy of the space has its own, so
+  ///copies may check from different threads.  Cleared by Init().
+  CollisionBroadphase broadphase;
+  ///Per-thread robot and geometry copies used by ParallelEdgeChecker.
+  ///Cleared by Init().
+  vector<SmartPointer<SingleRobotCSpaceThreadData> > threadData;
 
   vector<int> fixedDofs;
   vector<Real> fixedValues;
@@ -138,6 +165,109 @@ class SingleRobotCSpace : public RobotCSpace
   bool constraintsDirty;
 };
 
+/** @ingroup Planning
+ * @brief Private copies of a SingleRobotCSpace's robot kinematics and link
+ * geometries, so that a worker thread can check collisions without
+ * touching the shared RobotWorld.
+ *
+ * Only the robot's own links are copied.  The other geometries in the
+ * world are shared, and must not move during a check.  Collisions are
+ * checked with the space's settings, as in SingleRobotCSpace::IsFeasible,
+ * using a broadphase private to this thread.
+ */
+class SingleRobotCSpaceThreadData
+{
+ public:
+  SingleRobotCSpaceThreadData(SingleRobotCSpace* space);
+  ///Returns false if the robot's link geometries were replaced since this
+  ///was created
+  bool IsCurrent() const;
+  ///Gets the geometries of the world other than the robot, with their
+  ///world IDs, for use in CheckCollisionFree
+  void GetOtherGeometries(vector<Geometry::AnyCollisionGeometry3D*>& geoms,vector<int>& ids) const;
+  ///Checks collisions of the robot at x with itself and with the other
+  ///geometries.  Joint limits are not checked.
+  bool CheckCollisionFree(const Config& x,const vector<Geometry::AnyCollisionGeometry3D*>& otherGeoms,const vector<int>& otherIDs);
+
+  SingleRobotCSpace* space;
+  RobotKinematics3D robot;
+  vector<SmartPointer<Geometry::AnyCollisionGeometry3D> > geometry;  ///<per link, empty if the link has no geometry
+  vector<Geometry::AnyCollisionGeometry3D*> source;  ///<per link, the robot geometry that was copied
+  //the non-empty link geometries and their world IDs
+  vector<Geometry::AnyCollisionGeometry3D*> linkGeoms;
+  vector<int> linkIDs;
+  CollisionBroadphase broadphase;
+};
+
+/** @ingroup Planning
+ * @brief An edge checker for SingleRobotCSpace that checks the same
+ * bisection points as EpsilonEdgeChecker using several threads.
+ *
+ * Consecutive bisection levels are gathered into batches large enough to
+ * keep all threads busy, and the remaining points of a batch are skipped as
+ * soon as one thread finds a collision.  Collisions are checked using
+ * space->threadData, so nothing else in the world may move while
+ * IsVisible() runs.
+ */
+class ParallelEdgeChecker : public EdgePlanner
+{
+public:
+  ParallelEdgeChecker(SingleRobotCSpace* space,const Config& a,const Config& b,Real epsilon,int numThreads);
+  virtual ~ParallelEdgeChecker() {}
+  virtual bool IsVisible();
+  virtual void Eval(Real u,Config& x) const;
+  virtual Real Length() const;
+  virtual const Config& Start() const { return a; }
+  virtual const Config& End() const { return b; }
+  virtual CSpace* Space() const { return space; }
+  virtual EdgePlanner* Copy() const;
+  virtual EdgePlanner* ReverseCopy() const;
+
+  SingleRobotCSpace* space;
+  Config a,b;
+  Real epsilon;
+  int numThreads;
+};
+
+/** @ingroup Planning
+ * @brief A private view of a SingleRobotCSpace for a planner that runs in
+ * its own thread.
+ *
+ * Sampling and interpolation use a kinematic copy of the robot, and
+ * feasibility is checked with its own SingleRobotCSpaceThreadData, so
+ * several of these may be used by different threads at once.  The base
+ * space's settings and fixed dofs are used, but its constraints are not
+ * copied; feasibility is only available through IsFeasible and
+ * PathChecker.  The base space must not be modified, and nothing in the
+ * world may move, while this space is in use.  Call Refresh() after
+ * adding, removing, or replacing geometries in the world.
+ *
+ * Each space samples from its own RandomStream, seeded in the constructor,
+ * so planners on different spaces do not share sampler state.  Note that
+ * the planners in KrisLibrary may also draw from its global generator for
+ * their own bookkeeping (e.g., picking a tree to extend), and those draws
+ * are not synchronized.
+ */
+class ThreadLocalRobotCSpace : public RobotCSpace
+{
+ public:
+  ThreadLocalRobotCSpace(SingleRobotCSpace* base,unsigned long long seed=0);
+  virtual ~ThreadLocalRobotCSpace();
+  virtual void Sample(Config& x);
+  virtual void SampleNeighborhood(const Config& c,Real r,Config& x);
+  virtual bool IsFeasible(const Config& x);
+  virtual EdgePlanner* PathChecker(const Config& a,const Config& b);
+  virtual void Properties(PropertyMap& map);
+  ///Updates the geometries checked against to the current world
+  void Refresh();
+
+  SingleRobotCSpace* base;
+  SingleRobotCSpaceThreadData data;
+  vector<Geometry::AnyCollisionGeometry3D*> otherGeoms;
+  vector<int> otherIDs;
+  RandomStream random;
+};
+
 /** @ingroup Planning
  * @brief A configuration space for a rigid object, treated like a robot.
  *
@@ -0,0 +1,121 @@
+"""Reads the column logs (.klog files) written by the C++ ColumnLogWriter,
+e.g., by SimTest when given a log file name ending in .klog.
+
+Example::
+
+    log = ColumnLog('simtest_log.klog')
+    t = log.column('time')
+    q0 = log.column(log.columns[4])
+
+See IO/ColumnLog.h for a description of the file format.
+"""
+import struct
+import json
+
+_HEADER_MAGIC = 'KCOL'
+_CHUNK_MAGIC = 'CHNK'
+_VERSION = 1
+_ZERO_CODE = 0x88
+
+def decodeColumn(data,n):
+    """Decodes n values from the compressed column data (a str)"""
+    values = []
+    prev = 0
+    pos = 0
+    for i in xrange(n):
+        code = ord(data[pos])
+        pos += 1
+        if code != _ZERO_CODE:
+            lz,tz = code >> 4, code & 0xf
+            x = 0
+            for b in xrange(7-lz,tz-1,-1):
+                x |= ord(data[pos]) << (8*b)
+                pos += 1
+            prev ^= x
+        values.append(prev)
+    if pos != len(data):
+        raise IOError("Corrupt column data")
+    return list(struct.unpack('<%dd'%n,struct.pack('<%dQ'%n,*values)))
+
+class ColumnLog:
+    """Attributes:
+        - columns: the list of column names
+        - metadata: the metadata string.  For simulation logs, this is JSON,
+          and the parsed object is given in 'info'.
+        - info: the parsed metadata, or None if it's not JSON
+        - numRows: the number of complete rows in the file
+    """
+    def __init__(self,fn):
+        self.fn = fn
+        with open(fn,'rb') as f:
+            if f.read(4) != _HEADER_MAGIC:
+                raise IOError(fn+" is not a column log")
+            version,ncols = struct.unpack('=ii',f.read(8))
+            if version != _VERSION:
+                raise IOError("Unsupported column log version %d"%(version,))
+            self.columns = [self._readString(f) for i in xrange(ncols)]
+            self.metadata = self._readString(f)
+            try:
+                self.info = json.loads(self.metadata)
+            except ValueError:
+                self.info = None
+            #find the complete chunks
+            self._chunks = []
+            self.numRows = 0
+            while True:
+                if f.read(4) != _CHUNK_MAGIC:
+                    break
+                s = f.read(4)
+                if len(s) < 4: break
+                n = struct.unpack('=i',s)[0]
+                start = f.tell()
+                complete = True
+                for j in xrange(ncols):
+                    s = f.read(4)
+                    if len(s) < 4:
+                        complete = False
+                        break
+                    length = struct.unpack('=i',s)[0]
+                    if len(f.read(length)) < length:
+                        complete = False
+                        break
+                if not complete:
+                    break
+                self._chunks.append((start,n))
+                self.numRows += n
+
+    def _readString(self,f):
+        n = struct.unpack('=i',f.read(4))[0]
+        s = f.read(n)
+        if len(s) != n:
+            raise IOError("Truncated column log header")
+        return s
+
+    def columnIndex(self,name):
+        return self.columns.index(name)
+
+    def column(self,col):
+        """Returns the values of a column, given by name or index"""
+        if not isinstance(col,int):
+            col = self.columnIndex(col)
+        values = []
+        with open(self.fn,'rb') as f:
+            for (start,n) in self._chunks:
+                f.seek(start)
+                for j in xrange(col):
+                    length = struct.unpack('=i',f.read(4))[0]
+                    f.seek(length,1)
+                length = struct.unpack('=i',f.read(4))[0]
+                values += decodeColumn(f.read(length),n)
+        return values
+
+    def rows(self):
+        """Returns all rows as a list of lists"""
+        cols = [self.column(j) for j in xrange(len(self.columns))]
+        return [list(r) for r in zip(*cols)]
+
+    def names(self):
+        """For simulation logs, returns the list of world entity names indexed
+        by ID, which are used in the body1 and body2 columns of contact logs."""
+        if self.info is None: return None
+        return self.info.get('names',None)
@@ -158,7 +158,8 @@ class WorldCollider:
     Attributes:
       - geomList: a list of (object,geom) pairs for all objects in the world
       - mask: a list of sets, indicating which items are activated for
-        collision detection for each object in the world.
+        collision detection for each object in the world.  It may be edited
+        directly.
       - terrains: contains the geomList indices of each terrain in the world.
       - rigidObjects: contains the geomList indices of each object in
         the world
@@ -275,6 +276,19 @@ class WorldCollider:
                         self.mask[r[i]].add(r[j])
                         self.mask[r[j]].add(r[i])
                         
+        #the native query engine.  Its mask starts empty and is synced to
+        #self.mask before each query, so edits of self.mask are respected
+        self.native = None
+        try:
+            self.native = WorldCollisionQuery(world)
+        except NameError:
+            pass
+        self.idToGeomIndex = dict((o.getID(),i) for i,(o,g) in enumerate(self.geomList))
+        if self.native is not None:
+            for (o,g) in self.geomList:
+                self.native.enable(o.getID(),False)
+            self._nativeMask = [set() for m in self.mask]
+
         for i in ignore:
             self.ignoreCollision(i)
                 
@@ -380,10 +394,60 @@ class WorldCollider:
         satisfy filter1 will be collided against objects that satisfy
         filter2.  (Note: in this case there is no checking of duplicates,
         i.e., the sets should be disjoint to avoid duplicating work)."""
+        if self.native is not None:
+            for pair in self._nativeQuery(0,filter1,filter2):
+                yield pair
+            return
         for (g0,g1) in self.collisionTests(filter1,filter2):
             if g0[1].collides(g1[1]):
                 yield (g0[0],g1[0])
 
+    def withinDistance(self,tol,filter1=None,filter2=None):
+        """Returns an iterator over the pairs of objects within distance tol,
+        optionally satisfying the filter(s).  The filters are interpreted as
+        in collisions()."""
+        if self.native is not None:
+            for pair in self._nativeQuery(tol,filter1,filter2):
+                yield pair
+            return
+        for (g0,g1) in self.collisionTests(filter1,filter2):
+            if g0[1].withinDistance(g1[1],tol):
+                yield (g0[0],g1[0])
+
+    def _syncNativeMask(self):
+        """Copies the changes made to self.mask since the last query into the
+        native engine.  The native mask is symmetric: the pair i,j is
+        enabled if j is in mask[i] or i is in mask[j]."""
+        if self._nativeMask == self.mask:
+            return
+        changed = set()
+        for i,(new,old) in enumerate(zip(self.mask,self._nativeMask)):
+            if new == old: continue
+            for j in new.symmetric_difference(old):
+                changed.add((min(i,j),max(i,j)))
+        for (i,j) in changed:
+            enabled = (j in self.mask[i]) or (i in self.mask[j])
+            self.native.enablePair(self.geomList[i][0].getID(),self.geomList[j][0].getID(),enabled)
+        self._nativeMask = [set(m) for m in self.mask]
+
+    def _nativeQuery(self,tol,filter1,filter2):
+        """Runs a whole query in the native engine and returns the list of
+        (object,object) pairs"""
+        self._syncNativeMask()
+        if filter1 is None:
+            if tol > 0: a,b = self.native.withinDistance(tol)
+            else: a,b = self.native.collisions()
+        else:
+            ids1 = [o.getID() for (o,g) in self.geomList if filter1(o)]
+            ids2 = []
+            if filter2 is not None:
+                ids2 = [o.getID() for (o,g) in self.geomList if filter2(o)]
+                if len(ids2) == 0: return []
+            if len(ids1) == 0: return []
+            if tol > 0: a,b = self.native.withinDistanceBetween(ids1,ids2,tol)
+            else: a,b = self.native.collisionsBetween(ids1,ids2)
+        return [(self.geomList[self.idToGeomIndex[i]][0],self.geomList[self.idToGeomIndex[j]][0]) for (i,j) in zip(a,b)]
+
     def robotSelfCollisions(self,robot=None):
         """Given robot, tests all self collisions.  If robot is None, all
         robots are tested.  If robots is an index or a RobotModel object
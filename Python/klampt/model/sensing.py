@@ -104,12 +104,36 @@ def camera_to_images(camera,image_format='numpy',color_format='channels'):
 	h = int(camera.getSetting('yres'))
 	has_rgb = int(camera.getSetting('rgb'))
 	has_depth = int(camera.getSetting('depth'))
-	measurements = camera.getMeasurements()
 	if image_format == 'numpy':
 		if not _try_numpy_import():
 			image_format = 'native'
 	rgb = None
 	depth = None
+	if image_format == 'numpy' and hasattr(camera,'getMeasurementArray'):
+		#read the camera's native image buffers rather than the measurement list
+		arrays = camera.measurementArrayNames()
+		if has_rgb and 'rgb' in arrays:
+			channels = camera.getMeasurementArray('rgb')
+			if color_format == 'bgr':
+				rgb = np.bitwise_or(np.bitwise_or(channels[:,:,0].astype(np.uint32),
+										np.left_shift(channels[:,:,1].astype(np.uint32),8)),
+										np.left_shift(channels[:,:,2].astype(np.uint32),16))
+			elif color_format == 'rgb':
+				rgb = np.bitwise_or(np.bitwise_or(np.left_shift(channels[:,:,0].astype(np.uint32),16),
+										np.left_shift(channels[:,:,1].astype(np.uint32),8)),
+										channels[:,:,2].astype(np.uint32))
+			else:
+				rgb = channels.copy()
+		if has_depth and 'depth' in arrays:
+			depth = camera.getMeasurementArray('depth').astype(float)
+		if has_rgb and has_depth:
+			return rgb,depth
+		elif has_rgb:
+			return rgb
+		elif has_depth:
+			return depth
+		return None
+	measurements = camera.getMeasurements()
 	if has_rgb:
 		if image_format == 'numpy':
 			abgr = np.array(measurements[0:w*h]).reshape(h,w).astype(np.uint32)
@@ -327,6 +327,14 @@ class MotionPlan:
         """Performs a given number of iterations of planning."""
         self.planner.planMore(iterations)
 
+    def planMoreParallel(self,iterations,numThreads=0):
+        """Runs numThreads independent copies of this plan for up to the
+        given number of iterations each, stopping when one finds a path.
+        The space must be a NativeRobotCSpace without additional Python
+        feasibility tests, and the endpoints must be configurations.
+        numThreads <= 0 uses all hardware threads."""
+        self.planner.planMoreParallel(iterations,numThreads)
+
     def getPath(self,milestone1=None,milestone2=None):
         """Returns the path between the two milestones.  If no
         arguments are provided, this returns the path between the
@@ -1,4 +1,5 @@
 from cspace import CSpace
+import motionplanning
 from .. import robotsim
 from ..model import collide
 from cspaceutils import EmbeddedCSpace
@@ -118,6 +119,59 @@ class RobotCSpace(CSpace):
         for q in path[1:]:
             controller.appendMilestoneLinear(q)
 
+
+class NativeRobotCSpace(CSpace):
+    """A robot cspace whose joint limit, collision, and edge checks are done
+    in C++, without calling back into Python.  This is much faster than
+    RobotCSpace for planning in a WorldModel.
+
+    Extra constraints may be added with addFeasibilityTest; these are called
+    in Python after the native checks.  Sampling, distance, and interpolation
+    also use the native robot versions unless sample, distance, or
+    interpolate are overloaded in a subclass.
+
+    The world must not be modified while planning.
+    """
+    def __init__(self,world,robotIndex):
+        CSpace.__init__(self)
+        self.world = world
+        self.robot = world.robot(robotIndex)
+        self.robotIndex = robotIndex
+        self.setBounds(zip(*self.robot.getJointLimits()))
+
+    def setup(self,reinit = False):
+        if self.cspace is not None:
+            if not reinit:
+                print "NativeRobotCSpace.setup(): Performance warning, called twice, destroying previous CSpaceInterface object"
+            self.cspace.destroy()
+        self.cspace = motionplanning.CSpaceInterface()
+        self.cspace.setRobot(self.world.getNativePointer(),self.robotIndex)
+        if self.feasibilityTests is not None:
+            for n,f in zip(self.feasibilityTestNames,self.feasibilityTests):
+                self.cspace.addFeasibilityTest(n,f)
+        if hasattr(self,'visible'):
+            self.cspace.setVisibility(getattr(self,'visible'))
+        else:
+            self.cspace.setVisibilityEpsilon(self.eps)
+        #the native versions are used unless a subclass overloads these
+        cls = self.__class__
+        if cls.sample.__func__ is not CSpace.sample.__func__:
+            self.cspace.setSampler(self.sample)
+        if cls.sampleneighborhood.__func__ is not CSpace.sampleneighborhood.__func__:
+            self.cspace.setNeighborhoodSampler(self.sampleneighborhood)
+        if hasattr(self,'distance'):
+            self.cspace.setDistance(self.distance)
+        if hasattr(self,'interpolate'):
+            self.cspace.setInterpolate(self.interpolate)
+        for (k,v) in self.properties.iteritems():
+            if isinstance(v,(list,tuple)):
+                self.cspace.setProperty(k," ".join([str(item) for item in v]))
+            else:
+                self.cspace.setProperty(k,str(v))
+
+    def feasible(self,x):
+        return self.cspace.isFeasible(x)
+
                   
 class RobotSubsetCSpace(EmbeddedCSpace):
     """A basic robot cspace that allows collision free motion of a *subset*
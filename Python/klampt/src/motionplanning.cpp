@@ -1,4 +1,7 @@
 #include "motionplanning.h"
+#include "Planning/RobotCSpace.h"
+#include "Modeling/ParallelFor.h"
+#include "Modeling/Atomic.h"
 #include <KrisLibrary/planning/AnyMotionPlanner.h>
 #include <KrisLibrary/planning/CSpaceHelpers.h>
 #include <KrisLibrary/planning/EdgePlannerHelpers.h>
@@ -7,6 +10,7 @@
 #include <KrisLibrary/math/random.h>
 #include <KrisLibrary/graph/IO.h>
 #include <KrisLibrary/Timer.h>
+#include <KrisLibrary/utils/threadutils.h>
 #include <Python.h>
 #include <iostream>
 #include <fstream>
@@ -26,14 +30,15 @@ void UpdateStats(AdaptiveCSpace::PredicateStats& s,double testcost,bool testtrue
 class PyCSpace;
 class PyEdgePlanner;
 
-/** A CSpace that calls python routines for its functionality */
+/** A CSpace that calls python routines for its functionality, optionally
+ * on top of a native robot cspace */
 class PyCSpace : public CSpace
 {
 public:
   PyCSpace()
     :sample(NULL),sampleNeighborhood(NULL),
      distance(NULL),interpolate(NULL),edgeResolution(0.001),cacheq(NULL),cacheq2(NULL),cachex(NULL),cachex2(NULL),
-     visibleDistance(0),notVisibleDistance(0)
+     visibleDistance(0),notVisibleDistance(0),worldCapsule(NULL)
   {
     feasibleStats.cost = 0;
     feasibleStats.probability = 0.5;
@@ -52,6 +57,7 @@ public:
     Py_XDECREF(interpolate);
     Py_XDECREF(cachex);
     Py_XDECREF(cachex2);
+    Py_XDECREF(worldCapsule);
   }
 
   PyObject* UpdateTempConfig(const Config& q) {
@@ -98,10 +104,36 @@ public:
       Py_XINCREF(visibleTests[i]);
     Py_XINCREF(distance);
     Py_XINCREF(interpolate);
+    robotSettings = rhs.robotSettings;
+    robotSpace = rhs.robotSpace;
+    robotLocal = NULL;
+    if(robotSpace) robotLocal = new ThreadLocalRobotCSpace(robotSpace);
+    Py_XINCREF(rhs.worldCapsule);
+    Py_XDECREF(worldCapsule);
+    worldCapsule = rhs.worldCapsule;
+  }
+
+  ///Checks the native robot constraints with the GIL released.  The check
+  ///uses robotLocal's private copy of the robot, so the shared world is
+  ///only read.
+  bool IsRobotFeasible(const Config& q) {
+    if(!robotSpace) return true;
+    robotLocal->Refresh();
+    bool res;
+    Py_BEGIN_ALLOW_THREADS
+    robotLock.lock();
+    res = robotLocal->IsFeasible(q);
+    robotLock.unlock();
+    Py_END_ALLOW_THREADS
+    return res;
   }
 
   virtual void Sample(Config& x) {
     if(!sample) {
+      if(robotSpace) {
+        robotSpace->Sample(x);
+        return;
+      }
       throw PyException("Python sample method not defined");
     }
     PyObject* result = PyObject_CallFunctionObjArgs(sample,NULL);
@@ -124,7 +156,8 @@ public:
   virtual void SampleNeighborhood(const Config& c,double r,Config& x)
   {
     if(!sampleNeighborhood) {
-      CSpace::SampleNeighborhood(c,r,x);
+      if(robotSpace) robotSpace->SampleNeighborhood(c,r,x);
+      else CSpace::SampleNeighborhood(c,r,x);
     }
     else {
       PyObject* pyc=UpdateTempConfig(c);
@@ -152,7 +185,7 @@ public:
 
   virtual bool IsFeasible(const Config& q) {
     Timer timer;
-    bool res = CSpace::IsFeasible(q);
+    bool res = IsRobotFeasible(q) && CSpace::IsFeasible(q);
     UpdateStats(feasibleStats,timer.ElapsedTime(),res);
     return res;
   }
@@ -185,6 +218,7 @@ public:
   virtual double Distance(const Config& x, const Config& y)
   {
     if(!distance) {
+      if(robotSpace) return robotSpace->Distance(x,y);
       return CSpace::Distance(x,y);
     }
     else {
@@ -211,7 +245,8 @@ public:
   virtual void Interpolate(const Config& x,const Config& y,double u,Config& out)
   {
     if(!interpolate) {
-      CSpace::Interpolate(x,y,u,out);
+      if(robotSpace) robotSpace->Interpolate(x,y,u,out);
+      else CSpace::Interpolate(x,y,u,out);
     }
     else {
       PyObject* pyx = UpdateTempConfig(x);
@@ -238,6 +273,12 @@ public:
 
   virtual void Properties(PropertyMap& props) const
   {
+    if(robotSpace && !distance && !interpolate) {
+      robotSpace->Properties(props);
+      for(PropertyMap::const_iterator i=properties.begin();i!=properties.end();i++)
+        props[i->first] = i->second;
+      return;
+    }
     props = properties;
     if(!distance) {
       props.set("euclidean",1);
@@ -259,6 +300,16 @@ public:
   PyObject *cachex,*cachex2;
   AdaptiveCSpace::PredicateStats feasibleStats,visibleStats;
   double visibleDistance,notVisibleDistance;
+
+  //set by CSpaceInterface::setRobot.  Native checks run on robotLocal
+  //while holding robotLock, which keeps Python threads that share this
+  //space from using robotLocal at once.  worldCapsule keeps the world
+  //alive.
+  SmartPointer<WorldPlannerSettings> robotSettings;
+  SmartPointer<SingleRobotCSpace> robotSpace;
+  SmartPointer<ThreadLocalRobotCSpace> robotLocal;
+  Mutex robotLock;
+  PyObject* worldCapsule;
 };
 
 
@@ -394,8 +445,65 @@ public:
 };
 
 
+/** Checks an edge of a native robot cspace, then any edge checkers for the
+ * Python constraints */
+class PyRobotEdgePlanner : public EdgePlanner
+{
+public:
+  PyCSpace* space;
+  SmartPointer<EdgePlanner> robotChecker;
+  vector<SmartPointer<EdgePlanner> > pyCheckers;
+
+  PyRobotEdgePlanner(PyCSpace* _space,SmartPointer<EdgePlanner> _robotChecker)
+    :space(_space),robotChecker(_robotChecker)
+  {}
+  virtual ~PyRobotEdgePlanner() {}
+  virtual bool IsVisible() {
+    //robotChecker checks on space->robotLocal, see PyCSpace::IsRobotFeasible
+    space->robotLocal->Refresh();
+    bool res;
+    Py_BEGIN_ALLOW_THREADS
+    space->robotLock.lock();
+    res = robotChecker->IsVisible();
+    space->robotLock.unlock();
+    Py_END_ALLOW_THREADS
+    if(!res) return false;
+    for(size_t i=0;i<pyCheckers.size();i++)
+      if(!pyCheckers[i]->IsVisible()) return false;
+    return true;
+  }
+  virtual Real Length() const { return robotChecker->Length(); }
+  virtual void Eval(double u,Config& x) const { robotChecker->Eval(u,x); }
+  virtual const Config& Start() const { return robotChecker->Start(); }
+  virtual const Config& End() const { return robotChecker->End(); }
+  virtual CSpace* Space() const { return space; }
+  virtual EdgePlanner* Copy() const {
+    PyRobotEdgePlanner* e = new PyRobotEdgePlanner(space,robotChecker->Copy());
+    for(size_t i=0;i<pyCheckers.size();i++)
+      e->pyCheckers.push_back(pyCheckers[i]->Copy());
+    return e;
+  }
+  virtual EdgePlanner* ReverseCopy() const {
+    PyRobotEdgePlanner* e = new PyRobotEdgePlanner(space,robotChecker->ReverseCopy());
+    for(size_t i=0;i<pyCheckers.size();i++)
+      e->pyCheckers.push_back(pyCheckers[i]->ReverseCopy());
+    return e;
+  }
+};
+
+
 EdgePlanner* PyCSpace::PathChecker(const Config& a,const Config& b)
 {
+  if(robotSpace) {
+    PyRobotEdgePlanner* e = new PyRobotEdgePlanner(this,robotLocal->PathChecker(a,b));
+    if(!visibleTests.empty())
+      e->pyCheckers.push_back(new PyEdgePlanner(this,a,b));
+    else {
+      for(size_t i=0;i<constraints.size();i++)
+        e->pyCheckers.push_back(MakeSingleConstraintBisectionPlanner(this,a,b,i,edgeResolution));
+    }
+    return new PyUpdateEdgePlanner(this,e);
+  }
   if(visibleTests.empty()) {
     return new PyUpdateEdgePlanner(this,new BisectionEpsilonEdgePlanner(this,a,b,edgeResolution)); 
   }
@@ -533,6 +641,20 @@ static vector<SmartPointer<PyCSpace> > spaces;
 static vector<SmartPointer<AdaptiveCSpace> > adaptiveSpaces;
 static vector<SmartPointer<MotionPlannerInterface> > plans;
 static vector<SmartPointer<PyGoalSet> > goalSets;
+
+/** Independent copies of a point-to-point plan that are run by
+ * PlannerInterface::planMoreParallel, each on a ThreadLocalRobotCSpace of
+ * the space's native robot cspace, which samples from its own random
+ * stream.  solved is the index of the first planner to find a path, or -1.
+ */
+struct ParallelPlanData
+{
+  Config start,goal;
+  vector<SmartPointer<ThreadLocalRobotCSpace> > spaces;
+  vector<SmartPointer<MotionPlannerInterface> > planners;
+  volatile int solved;
+};
+static vector<SmartPointer<ParallelPlanData> > parallelPlans;
 static MotionPlannerFactory factory;
 static list<int> spacesDeleteList;
 static list<int> plansDeleteList;
@@ -661,6 +783,8 @@ void CSpaceInterface::setVisibilityEpsilon(double eps)
     Py_XDECREF(spaces[index]->visibleTests[i]);
   spaces[index]->visibleTests.resize(0);
   spaces[index]->edgeResolution = eps;
+  if(spaces[index]->robotSpace)
+    spaces[index]->robotSettings->robotSettings[spaces[index]->robotSpace->index].collisionEpsilon = eps;
 }
 
 void CSpaceInterface::setSampler(PyObject* pySamp)
@@ -706,6 +830,33 @@ void CSpaceInterface::setProperty(const char* key,const char* value)
   spaces[index]->properties[key] = value;
 }
 
+void CSpaceInterface::setRobot(PyObject* worldCapsule,int robot)
+{
+  if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
+    throw PyException("Invalid cspace index");
+  if(adaptiveQueriesEnabled())
+    throw PyException("setRobot cannot be used with adaptive queries");
+  //the capsule name tags the pointer type, see WorldModel.getNativePointer
+  RobotWorld* world = NULL;
+  if(PyCapsule_IsValid(worldCapsule,"klampt.RobotWorld"))
+    world = reinterpret_cast<RobotWorld*>(PyCapsule_GetPointer(worldCapsule,"klampt.RobotWorld"));
+  if(world == NULL)
+    throw PyException("setRobot requires the result of WorldModel.getNativePointer()",Type);
+  if(robot < 0 || robot >= (int)world->robots.size())
+    throw PyException("Invalid robot index");
+  world->InitCollisions();
+  world->UpdateGeometry();
+  spaces[index]->robotSettings = new WorldPlannerSettings;
+  spaces[index]->robotSettings->InitializeDefault(*world);
+  //the edge resolution is kept in sync by setVisibilityEpsilon
+  spaces[index]->robotSettings->robotSettings[robot].collisionEpsilon = spaces[index]->edgeResolution;
+  spaces[index]->robotSpace = new SingleRobotCSpace(*world,robot,spaces[index]->robotSettings);
+  spaces[index]->robotLocal = new ThreadLocalRobotCSpace(spaces[index]->robotSpace);
+  Py_INCREF(worldCapsule);
+  Py_XDECREF(spaces[index]->worldCapsule);
+  spaces[index]->worldCapsule = worldCapsule;
+}
+
 const char* CSpaceInterface::getProperty(const char* key)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
@@ -780,8 +931,12 @@ PyObject* CSpaceInterface::feasibilityFailures(PyObject* q)
   if(!PyListToConfig(q,vq)) {
     throw PyException("Invalid configuration (must be list)");    
   }
-  vector<string> infeasible;
-  getPreferredSpace(index)->GetInfeasibleNames(vq,infeasible);
+  CSpace* s = getPreferredSpace(index);
+  vector<string> infeasible,pyInfeasible;
+  if(spaces[index]->robotSpace)
+    spaces[index]->robotSpace->GetInfeasibleNames(vq,infeasible);
+  s->GetInfeasibleNames(vq,pyInfeasible);
+  infeasible.insert(infeasible.end(),pyInfeasible.begin(),pyInfeasible.end());
   return ToPy(infeasible);
 }
 
@@ -848,6 +1003,8 @@ void CSpaceInterface::enableAdaptiveQueries(bool enabled)
 {
   if(index < 0 || index >= (int)spaces.size() || spaces[index]==NULL) 
     throw PyException("Invalid cspace index");
+  if(spaces[index]->robotSpace)
+    throw PyException("Adaptive queries cannot be used with a space bound to a robot");
   if(index >= (int)adaptiveSpaces.size()) adaptiveSpaces.resize(spaces.size());
   if(adaptiveSpaces[index] == NULL)
     adaptiveSpaces[index] = new AdaptiveCSpace(spaces[index]);
@@ -1074,6 +1231,8 @@ void destroyPlan(int plan)
   plans[plan] = NULL;
   if(plan < (int)goalSets.size())
     goalSets[plan] = NULL;
+  if(plan < (int)parallelPlans.size())
+    parallelPlans[plan] = NULL;
   plansDeleteList.push_back(plan);
 }
 
@@ -1126,6 +1285,11 @@ bool PlannerInterface::setEndpoints(PyObject* start,PyObject* goal)
   if(igoal < 0) {
     throw PyException("Goal configuration is infeasible");
   }
+  parallelPlans.resize(plans.size());
+  parallelPlans[index] = new ParallelPlanData;
+  parallelPlans[index]->start = qstart;
+  parallelPlans[index]->goal = qgoal;
+  parallelPlans[index]->solved = -1;
   return true;
 }
 bool PlannerInterface::setEndpointSet(PyObject* start,PyObject* goal,PyObject* goalSample)
@@ -1186,15 +1350,81 @@ void PlannerInterface::planMore(int iterations)
   //DumpPlan(plans[plan],"plan.tgf");
 }
 
+//Runs one of the parallel planners per work item until it or another
+//planner finds a path
+struct ParallelPlanBody : public ParallelForBody
+{
+  ParallelPlanBody(ParallelPlanData* _data,int _iterations)
+    :data(_data),iterations(_iterations)
+  {}
+  virtual void Run(int index,int thread)
+  {
+    MotionPlannerInterface* planner = data->planners[index];
+    for(int i=0;i<iterations;i++) {
+      if(AtomicLoad(&data->solved) >= 0) return;
+      planner->PlanMore(1);
+      if(planner->IsSolved()) {
+        ScopedLock lock(mutex);
+        if(data->solved < 0) AtomicExchange(&data->solved,index);
+        return;
+      }
+    }
+  }
+
+  ParallelPlanData* data;
+  int iterations;
+  Mutex mutex;
+};
+
+void PlannerInterface::planMoreParallel(int iterations,int numThreads)
+{
+  if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
+    throw PyException("Invalid plan index");
+  PyCSpace* s = spaces[spaceIndex];
+  if(!s->robotSpace)
+    throw PyException("planMoreParallel requires a space bound to a robot with setRobot");
+  if(s->sample || s->sampleNeighborhood || s->distance || s->interpolate || !s->visibleTests.empty() || !s->constraints.empty())
+    throw PyException("planMoreParallel cannot be used with Python feasibility tests or callbacks");
+  if(index >= (int)parallelPlans.size() || parallelPlans[index]==NULL)
+    throw PyException("planMoreParallel requires endpoints set with setEndpoints");
+  numThreads = ResolveNumThreads(numThreads);
+  ParallelPlanData* data = parallelPlans[index];
+  while((int)data->planners.size() < numThreads) {
+    //distinct seeds, drawn from the global generator so that they follow
+    //its seed
+    unsigned long long seed = ((unsigned long long)RandInt(0x7fffffff) << 32) + data->planners.size();
+    SmartPointer<ThreadLocalRobotCSpace> space = new ThreadLocalRobotCSpace(s->robotSpace,seed);
+    SmartPointer<MotionPlannerInterface> planner = factory.Create(space);
+    planner->AddMilestone(data->start);
+    planner->AddMilestone(data->goal);
+    data->spaces.push_back(space);
+    data->planners.push_back(planner);
+  }
+  ParallelPlanBody body(data,iterations);
+  Py_BEGIN_ALLOW_THREADS
+  ParallelFor((int)data->planners.size(),body,numThreads);
+  Py_END_ALLOW_THREADS
+}
+
+//returns the planner holding the solution to the plan, or NULL
+static MotionPlannerInterface* SolvedPlanner(int index)
+{
+  if(plans[index]->IsSolved()) return plans[index];
+  if(index < (int)parallelPlans.size() && parallelPlans[index] && parallelPlans[index]->solved >= 0)
+    return parallelPlans[index]->planners[parallelPlans[index]->solved];
+  return NULL;
+}
+
 PyObject* PlannerInterface::getPathEndpoints()
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");  
-  if(!plans[index]->IsSolved()) {
+  MotionPlannerInterface* planner = SolvedPlanner(index);
+  if(!planner) {
     Py_RETURN_NONE;
   }
   MilestonePath path;
-  plans[index]->GetSolution(path);
+  planner->GetSolution(path);
   PyObject* pypath = PyList_New(path.NumMilestones());
   for(int i=0;i<path.NumMilestones();i++)
     PyList_SetItem(pypath,(Py_ssize_t)i,PyListFromConfig(path.GetMilestone(i)));
@@ -1205,11 +1435,18 @@ PyObject* PlannerInterface::getPath(int milestone1,int milestone2)
 {
   if(index < 0 || index >= (int)plans.size() || plans[index]==NULL) 
     throw PyException("Invalid plan index");  
-  if(!plans[index]->IsConnected(milestone1,milestone2)) {
-    Py_RETURN_NONE;
+  MotionPlannerInterface* planner = plans[index];
+  if(!planner->IsConnected(milestone1,milestone2)) {
+    //the parallel planners only share the start and goal milestones
+    planner = NULL;
+    if(milestone1 <= 1 && milestone2 <= 1)
+      planner = SolvedPlanner(index);
+    if(!planner) {
+      Py_RETURN_NONE;
+    }
   }
   MilestonePath path;
-  plans[index]->GetPath(milestone1,milestone2,path);
+  planner->GetPath(milestone1,milestone2,path);
   PyObject* pypath = PyList_New(path.NumMilestones());
   for(int i=0;i<path.NumMilestones();i++)
     PyList_SetItem(pypath,(Py_ssize_t)i,PyListFromConfig(path.GetMilestone(i)));
@@ -1230,6 +1467,14 @@ double PlannerInterface::getData(const char* setting)
   else if(0==strcmp(setting,"components")) {
     return plans[index]->NumComponents();
   }
+  else if(0==strcmp(setting,"parallelIterations")) {
+    int n = 0;
+    if(index < (int)parallelPlans.size() && parallelPlans[index]) {
+      for(size_t i=0;i<parallelPlans[index]->planners.size();i++)
+        n += parallelPlans[index]->planners[i]->NumIterations();
+    }
+    return n;
+  }
   else {
     throw PyException("Invalid plan option");
     return 0;
@@ -1286,4 +1531,5 @@ void destroy()
   spacesDeleteList.resize(0);
   plans.resize(0);
   plansDeleteList.resize(0);
+  parallelPlans.resize(0);
 }
@@ -86,6 +86,16 @@ void destroy();
  * "geodesic" (boolean), "minimum" (vector), and "maximum" (vector). 
  * These may be used by planners to make planning faster or more accurate.
  * For a complete list see KrisLibrary/planning/CSpace.h.
+ *
+ * For planning the motion of a robot in a WorldModel, setRobot() binds the
+ * space to a native C++ robot configuration space.  Joint limits, collisions,
+ * and edges are then checked in C++ without calling into Python, and the native
+ * sampler, distance, and interpolation are used unless Python versions are
+ * set.  Python feasibility and visibility tests are then only needed for
+ * extra constraints, and are checked after the native ones.  The native
+ * checks use a private copy of the robot and release the GIL, so other
+ * Python threads may run meanwhile, but they must not move or edit the
+ * other objects in the world during a check.
  */
 class CSpaceInterface
 {
@@ -105,6 +115,11 @@ class CSpaceInterface
   void setInterpolate(PyObject* pyInterp);
   void setProperty(const char* key,const char* value);
   const char* getProperty(const char* key);
+  ///Binds this space to the given robot of a C++ RobotWorld, given by the
+  ///capsule returned by WorldModel.getNativePointer().  The space keeps
+  ///the capsule, and so the world, alive.  Adaptive queries cannot be used
+  ///with a bound space.
+  void setRobot(PyObject* world,int robot);
 
   ///Queries whether a given configuration is feasible 
   bool isFeasible(PyObject* q);
@@ -187,6 +202,14 @@ class CSpaceInterface
  * To plan, call planMore(iters) until getPath(0,1) returns non-NULL.
  * The return value is a list of configurations.
  *
+ * If the space is bound to a robot with CSpaceInterface.setRobot and has no
+ * Python feasibility tests or callbacks, planMoreParallel(iters,numThreads)
+ * runs numThreads independent copies of a point-to-point plan in parallel
+ * without holding the GIL, each for up to iters iterations.  It stops as
+ * soon as one finds a path, which is then returned by getPathEndpoints()
+ * and getPath(0,1).  numThreads <= 0 uses all hardware threads.  The
+ * world must not be modified while it runs.
+ *
  * To get a roadmap (V,E), call getRoadmap().  V is a list of configurations
  * (each configuration is a Python list) and E is a list of edges (each edge is
  * a pair (i,j) indexing into V).
@@ -204,6 +227,7 @@ class PlannerInterface
   bool setEndpointSet(PyObject* start,PyObject* goal,PyObject* goalSample=NULL);
   int addMilestone(PyObject* milestone);
   void planMore(int iterations);
+  void planMoreParallel(int iterations,int numThreads=0);
   PyObject* getPathEndpoints();
   PyObject* getPath(int milestone1,int milestone2);
   double getData(const char* setting);
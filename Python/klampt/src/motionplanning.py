@@ -206,6 +206,14 @@ class CSpaceInterface(_object):
     faster or more accurate. For a complete list see
     KrisLibrary/planning/CSpace.h.
 
+    For planning the motion of a robot in a WorldModel, setRobot() binds
+    the space to a native C++ robot configuration space. Joint limits,
+    collisions, and edges are then checked in C++ without calling into
+    Python, and the native sampler, distance, and interpolation are used
+    unless Python versions are set. Python feasibility and visibility
+    tests are then only needed for extra constraints, and are checked
+    after the native ones.
+
     C++ includes: motionplanning.h 
     """
     __swig_setmethods__ = {}
@@ -271,6 +279,17 @@ class CSpaceInterface(_object):
         """getProperty(CSpaceInterface self, char const * key) -> char const *"""
         return _motionplanning.CSpaceInterface_getProperty(self, *args)
 
+    def setRobot(self, *args):
+        """
+        setRobot(CSpaceInterface self, PyObject * world, int robot)
+
+        Binds this space to the given robot of a C++ RobotWorld, given by the
+        capsule returned by WorldModel.getNativePointer(). The world must
+        outlive this space. Adaptive queries cannot be used with a bound
+        space. 
+        """
+        return _motionplanning.CSpaceInterface_setRobot(self, *args)
+
     def isFeasible(self, *args):
         """
         isFeasible(CSpaceInterface self, PyObject * q) -> bool
@@ -510,6 +529,15 @@ class PlannerInterface(_object):
     To plan, call planMore(iters) until getPath(0,1) returns non-NULL. The
     return value is a list of configurations.
 
+    If the space is bound to a robot with CSpaceInterface.setRobot and has
+    no Python feasibility tests or callbacks,
+    planMoreParallel(iters,numThreads) runs numThreads independent copies
+    of a point-to-point plan in parallel without holding the GIL, each for
+    up to iters iterations. It stops as soon as one finds a path, which is
+    then returned by getPathEndpoints() and getPath(0,1). numThreads <= 0
+    uses all hardware threads. The world must not be modified while it
+    runs.
+
     To get a roadmap (V,E), call getRoadmap(). V is a list of
     configurations (each configuration is a Python list) and E is a list
     of edges (each edge is a pair (i,j) indexing into V).
@@ -554,6 +582,13 @@ class PlannerInterface(_object):
         """planMore(PlannerInterface self, int iterations)"""
         return _motionplanning.PlannerInterface_planMore(self, *args)
 
+    def planMoreParallel(self, *args):
+        """
+        planMoreParallel(PlannerInterface self, int iterations, int numThreads=0)
+        planMoreParallel(PlannerInterface self, int iterations)
+        """
+        return _motionplanning.PlannerInterface_planMoreParallel(self, *args)
+
     def getPathEndpoints(self):
         """getPathEndpoints(PlannerInterface self) -> PyObject *"""
         return _motionplanning.PlannerInterface_getPathEndpoints(self)
@@ -4246,6 +4246,51 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_CSpaceInterface_setRobot(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:CSpaceInterface_setRobot",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_CSpaceInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "CSpaceInterface_setRobot" "', argument " "1"" of type '" "CSpaceInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< CSpaceInterface * >(argp1);
+  arg2 = obj1;
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "CSpaceInterface_setRobot" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
+  {
+    try {
+      (arg1)->setRobot(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_CSpaceInterface_isFeasible(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   CSpaceInterface *arg1 = (CSpaceInterface *) 0 ;
@@ -6315,6 +6360,155 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_PlannerInterface_planMoreParallel__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  int val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:PlannerInterface_planMoreParallel",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_planMoreParallel" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PlannerInterface_planMoreParallel" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  ecode3 = SWIG_AsVal_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "PlannerInterface_planMoreParallel" "', argument " "3"" of type '" "int""'");
+  } 
+  arg3 = static_cast< int >(val3);
+  {
+    try {
+      (arg1)->planMoreParallel(arg2,arg3);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PlannerInterface_planMoreParallel__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PlannerInterface *arg1 = (PlannerInterface *) 0 ;
+  int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:PlannerInterface_planMoreParallel",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_PlannerInterface, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "PlannerInterface_planMoreParallel" "', argument " "1"" of type '" "PlannerInterface *""'"); 
+  }
+  arg1 = reinterpret_cast< PlannerInterface * >(argp1);
+  ecode2 = SWIG_AsVal_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "PlannerInterface_planMoreParallel" "', argument " "2"" of type '" "int""'");
+  } 
+  arg2 = static_cast< int >(val2);
+  {
+    try {
+      (arg1)->planMoreParallel(arg2);
+    }
+    catch(PyException& e) {
+      e.setPyErr();
+      return NULL;
+    }
+    catch(std::exception& e) {
+      PyErr_SetString(PyExc_RuntimeError, const_cast<char*>(e.what()));
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_PlannerInterface_planMoreParallel(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[4];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = args ? (int)PyObject_Length(args) : 0;
+  for (ii = 0; (ii < 3) && (ii < argc); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 2) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_PlannerInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        return _wrap_PlannerInterface_planMoreParallel__SWIG_1(self, args);
+      }
+    }
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_PlannerInterface, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      {
+        int res = SWIG_AsVal_int(argv[1], NULL);
+        _v = SWIG_CheckState(res);
+      }
+      if (_v) {
+        {
+          int res = SWIG_AsVal_int(argv[2], NULL);
+          _v = SWIG_CheckState(res);
+        }
+        if (_v) {
+          return _wrap_PlannerInterface_planMoreParallel__SWIG_0(self, args);
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number or type of arguments for overloaded function 'PlannerInterface_planMoreParallel'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    PlannerInterface::planMoreParallel(int,int)\n"
+    "    PlannerInterface::planMoreParallel(int)\n");
+  return 0;
+}
+
+
 SWIGINTERN PyObject *_wrap_PlannerInterface_getPathEndpoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   PlannerInterface *arg1 = (PlannerInterface *) 0 ;
@@ -6779,6 +6973,14 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"CSpaceInterface_setInterpolate", _wrap_CSpaceInterface_setInterpolate, METH_VARARGS, (char *)"CSpaceInterface_setInterpolate(CSpaceInterface self, PyObject * pyInterp)"},
 	 { (char *)"CSpaceInterface_setProperty", _wrap_CSpaceInterface_setProperty, METH_VARARGS, (char *)"CSpaceInterface_setProperty(CSpaceInterface self, char const * key, char const * value)"},
 	 { (char *)"CSpaceInterface_getProperty", _wrap_CSpaceInterface_getProperty, METH_VARARGS, (char *)"CSpaceInterface_getProperty(CSpaceInterface self, char const * key) -> char const *"},
+	 { (char *)"CSpaceInterface_setRobot", _wrap_CSpaceInterface_setRobot, METH_VARARGS, (char *)"\n"
+		"CSpaceInterface_setRobot(CSpaceInterface self, PyObject * world, int robot)\n"
+		"\n"
+		"Binds this space to the given robot of a C++ RobotWorld, given by the\n"
+		"capsule returned by WorldModel.getNativePointer(). The world must\n"
+		"outlive this space. Adaptive queries cannot be used with a bound\n"
+		"space. \n"
+		""},
 	 { (char *)"CSpaceInterface_isFeasible", _wrap_CSpaceInterface_isFeasible, METH_VARARGS, (char *)"\n"
 		"CSpaceInterface_isFeasible(CSpaceInterface self, PyObject * q) -> bool\n"
 		"\n"
@@ -6927,6 +7129,10 @@ static PyMethodDef SwigMethods[] = {
 		""},
 	 { (char *)"PlannerInterface_addMilestone", _wrap_PlannerInterface_addMilestone, METH_VARARGS, (char *)"PlannerInterface_addMilestone(PlannerInterface self, PyObject * milestone) -> int"},
 	 { (char *)"PlannerInterface_planMore", _wrap_PlannerInterface_planMore, METH_VARARGS, (char *)"PlannerInterface_planMore(PlannerInterface self, int iterations)"},
+	 { (char *)"PlannerInterface_planMoreParallel", _wrap_PlannerInterface_planMoreParallel, METH_VARARGS, (char *)"\n"
+		"planMoreParallel(int iterations, int numThreads=0)\n"
+		"PlannerInterface_planMoreParallel(PlannerInterface self, int iterations)\n"
+		""},
 	 { (char *)"PlannerInterface_getPathEndpoints", _wrap_PlannerInterface_getPathEndpoints, METH_VARARGS, (char *)"PlannerInterface_getPathEndpoints(PlannerInterface self) -> PyObject *"},
 	 { (char *)"PlannerInterface_getPath", _wrap_PlannerInterface_getPath, METH_VARARGS, (char *)"PlannerInterface_getPath(PlannerInterface self, int milestone1, int milestone2) -> PyObject *"},
 	 { (char *)"PlannerInterface_getData", _wrap_PlannerInterface_getData, METH_VARARGS, (char *)"PlannerInterface_getData(PlannerInterface self, char const * setting) -> double"},
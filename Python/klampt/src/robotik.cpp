@@ -8,6 +8,9 @@
 #include "Planning/RobotCSpace.h"
 #include "Modeling/World.h"
 #include "Planning/RobotCSpace.h"
+#include "Modeling/ParallelFor.h"
+#include "Modeling/Atomic.h"
+#include <KrisLibrary/utils/threadutils.h>
 #include "pyerr.h"
 
 //defined in robotsim.cpp
@@ -308,7 +311,7 @@ IKSolver::IKSolver(const RobotModel& _robot)
 {}
 
 IKSolver::IKSolver(const IKSolver& solver)
-  :robot(solver.robot),objectives(solver.objectives),tol(solver.tol),maxIters(solver.maxIters),activeDofs(solver.activeDofs),useJointLimits(solver.useJointLimits),qmin(solver.qmin),qmax(solver.qmax),lastIters(solver.lastIters)
+  :robot(solver.robot),objectives(solver.objectives),tol(solver.tol),maxIters(solver.maxIters),activeDofs(solver.activeDofs),useJointLimits(solver.useJointLimits),qmin(solver.qmin),qmax(solver.qmax),biasConfig(solver.biasConfig),seeds(solver.seeds),lastIters(solver.lastIters)
 {}
 
 
@@ -524,6 +527,64 @@ PyObject* IKSolver::solve(int iters,double tol)
   return tuple;
 }
 
+//Throws an exception if the solver's limits or bias have the wrong size
+static void CheckIKSettings(const IKSolver& s,const RobotKinematics3D& robot)
+{
+  if(s.useJointLimits && !s.qmin.empty()) {
+    if(s.qmin.size() != robot.links.size()) throw PyException("Invalid size on qmin");
+    if(s.qmax.size() != robot.links.size()) throw PyException("Invalid size on qmax");
+  }
+  if(!s.biasConfig.empty() && s.biasConfig.size() != robot.links.size())
+    throw PyException("Invalid size on biasConfig");
+}
+
+//Runs the solver with the settings of s from robot's current
+//configuration.  Only touches robot, so restarts can run in parallel on
+//separate copies of the robot.
+//
+//If firstSolved is given, this is restart number index of a multi-start
+//solve, and it is abandoned as soon as an earlier restart converges
+//(*firstSolved < index).  RobotIKSolver has no way to stop in the middle of
+//a solve, so the solver is then run one iteration at a time, checking the
+//flag in between.
+static bool SolveIK(const IKSolver& s,RobotKinematics3D& robot,int& iters,volatile int* firstSolved=NULL,int index=0)
+{
+  RobotIKFunction f(robot);
+  vector<IKGoal> goals(s.objectives.size());
+  for(size_t i=0;i<s.objectives.size();i++)
+    goals[i] = s.objectives[i].goal;
+  f.UseIK(goals);
+  if(s.activeDofs.empty()) GetDefaultIKDofs(robot,goals,f.activeDofs);
+  else f.activeDofs.mapping = s.activeDofs;
+
+  RobotIKSolver solver(f);
+  if(s.useJointLimits) {
+    if(s.qmin.empty())
+      solver.UseJointLimits();
+    else
+      solver.UseJointLimits(Vector(s.qmin),Vector(s.qmax));
+  }
+  if(!s.biasConfig.empty())
+    solver.UseBiasConfiguration(Vector(s.biasConfig));
+  solver.solver.verbose = 0;
+
+  if(!firstSolved || index == 0) {
+    iters=s.maxIters;
+    return solver.Solve(s.tol,iters);
+  }
+  iters = 0;
+  while(iters < s.maxIters) {
+    if(AtomicLoad(firstSolved) < index) return false;
+    int n = 1;
+    bool res = solver.Solve(s.tol,n);
+    iters += n;
+    if(res) return true;
+    //stopped without using the iteration, e.g., at a local minimum
+    if(n < 1) return false;
+  }
+  return false;
+}
+
 bool IKSolver::solve()
 {
   if(useJointLimits) {
@@ -537,32 +598,9 @@ bool IKSolver::solve()
       }
     }
   }
-  RobotIKFunction f(*robot.robot);
-  vector<IKGoal> goals(objectives.size());
-  for(size_t i=0;i<objectives.size();i++)
-    goals[i] = objectives[i].goal;
-  f.UseIK(goals);
-  if(activeDofs.empty()) GetDefaultIKDofs(*robot.robot,goals,f.activeDofs);
-  else f.activeDofs.mapping = activeDofs;
-
-  RobotIKSolver solver(f);
-  if(useJointLimits) {
-    if(qmin.empty())
-      solver.UseJointLimits();
-    else {
-      if(qmin.size() != robot.robot->links.size()) throw PyException("Invalid size on qmin");
-      if(qmax.size() != robot.robot->links.size()) throw PyException("Invalid size on qmax");
-      solver.UseJointLimits(Vector(qmin),Vector(qmax));
-    }
-  }
-  if(!biasConfig.empty()) {
-    if(biasConfig.size() != robot.robot->links.size()) throw PyException("Invalid size on biasConfig");
-    solver.UseBiasConfiguration(Vector(biasConfig));
-  }
-  solver.solver.verbose = 0;
-
-  int iters=maxIters;
-  bool res = solver.Solve(tol,iters);
+  CheckIKSettings(*this,*robot.robot);
+  int iters;
+  bool res = SolveIK(*this,*robot.robot,iters);
   robot.robot->UpdateGeometry();
   lastIters = iters;
   return res;
@@ -596,6 +634,115 @@ void IKSolver::sampleInitial()
 }
 
 
+void IKSolver::addSeed(const std::vector<double>& q)
+{
+  if(q.size() != robot.robot->links.size()) throw PyException("Invalid size on seed");
+  seeds.push_back(q);
+}
+
+void IKSolver::clearSeeds()
+{
+  seeds.resize(0);
+}
+
+struct IKRestartBody : public ParallelForBody
+{
+  IKRestartBody(const IKSolver& _solver,const vector<Config>& _starts,bool _best)
+    :solver(_solver),starts(_starts),best(_best),firstSolved((int)_starts.size())
+  {
+    solved.resize(starts.size(),0);
+    results.resize(starts.size());
+    iters.resize(starts.size(),0);
+  }
+
+  virtual void Run(int index,int thread)
+  {
+    //a start earlier in the order has already converged
+    if(!best && AtomicLoad(&firstSolved) < index) return;
+    RobotKinematics3D& robot = robots[thread];
+    robot.q = starts[index];
+    robot.UpdateFrames();
+    solved[index] = SolveIK(solver,robot,iters[index],(best ? NULL : &firstSolved),index);
+    results[index] = robot.q;
+    if(solved[index]) {
+      ScopedLock lock(mutex);
+      if(index < firstSolved) AtomicExchange(&firstSolved,index);
+    }
+  }
+
+  //a copy of the settings, since Python may change them while this runs
+  IKSolver solver;
+  const vector<Config>& starts;
+  bool best;
+  vector<RobotKinematics3D> robots;
+  Mutex mutex;
+  volatile int firstSolved;
+  vector<char> solved;  //vector<bool> can't be written concurrently
+  vector<Config> results;
+  vector<int> iters;
+};
+
+bool IKSolver::solveMultiStart(int numRestarts,int numThreads,bool best)
+{
+  Robot* r = robot.robot;
+  CheckIKSettings(*this,*r);
+  //draw all starts on this thread, since sampling uses the global RNG
+  Config qorig = r->q;
+  vector<Config> starts;
+  starts.push_back(qorig);
+  for(size_t i=0;i<seeds.size() && (int)starts.size()<numRestarts;i++)
+    starts.push_back(Config(Vector(seeds[i])));
+  while((int)starts.size() < numRestarts) {
+    sampleInitial();
+    starts.push_back(r->q);
+  }
+  r->q = qorig;
+  if(useJointLimits) {
+    const Real* usedQmin = (qmin.empty() ? &r->qMin[0] : &qmin[0]);
+    const Real* usedQmax = (qmax.empty() ? &r->qMax[0] : &qmax[0]);
+    for(size_t k=0;k<starts.size();k++)
+      for(int i=0;i<starts[k].n;i++)
+        starts[k](i) = Clamp(starts[k](i),usedQmin[i],usedQmax[i]);
+  }
+
+  int threads = Min(ResolveNumThreads(numThreads),(int)starts.size());
+  IKRestartBody body(*this,starts,best);
+  body.robots.resize(threads,*r);
+  //the restarts only touch the copies above, so other Python threads may
+  //run meanwhile
+  Py_BEGIN_ALLOW_THREADS
+  ParallelFor((int)starts.size(),body,threads);
+  Py_END_ALLOW_THREADS
+
+  int choice = -1;
+  if(!best) {
+    if(body.firstSolved < (int)starts.size()) choice = body.firstSolved;
+  }
+  else {
+    Config qref = (biasConfig.empty() ? qorig : Config(Vector(biasConfig)));
+    Real bestDist = Inf;
+    for(size_t k=0;k<starts.size();k++) {
+      if(!body.solved[k]) continue;
+      Real d = body.results[k].distanceSquared(qref);
+      if(d < bestDist) {
+        bestDist = d;
+        choice = (int)k;
+      }
+    }
+  }
+  if(choice < 0) {
+    r->UpdateFrames();
+    lastIters = 0;
+    return false;
+  }
+  r->q = body.results[choice];
+  r->UpdateFrames();
+  r->UpdateGeometry();
+  lastIters = body.iters[choice];
+  return true;
+}
+
+
 GeneralizedIKSolver::GeneralizedIKSolver(const WorldModel& world)
   :world(world)
 {}
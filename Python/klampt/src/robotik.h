@@ -178,6 +178,29 @@ class IKSolver
   /// Samples an initial random configuration
   void sampleInitial();
 
+  /** Multi-start solve: runs the solver from up to numRestarts starting
+   * configurations, concurrently on numThreads threads (<= 0 uses all
+   * hardware threads).  The starts are the robot's current configuration,
+   * then the seeds given to addSeed, then random samples drawn as in
+   * sampleInitial.
+   *
+   * If best is false, the result is the first start in this order that
+   * converges, and the later starts are stopped once it is found.  If
+   * best is true, all starts are run and the result is the converged
+   * configuration closest to the bias configuration (or to the current
+   * configuration if no bias is set).  Either way, the chosen start does not
+   * depend on the number of threads.
+   *
+   * Returns true and sets the robot to the result if any start converged.
+   * Otherwise, the robot's configuration is left unchanged.  Other Python
+   * threads may run while the starts are solved.
+   */
+  bool solveMultiStart(int numRestarts,int numThreads=0,bool best=false);
+  /// Adds a starting configuration for solveMultiStart
+  void addSeed(const std::vector<double>& q);
+  /// Clears the starting configurations added by addSeed
+  void clearSeeds();
+
   RobotModel robot;
   std::vector<IKObjective> objectives;
   double tol;
@@ -186,6 +209,7 @@ class IKSolver
   bool useJointLimits;
   std::vector<double> qmin,qmax;
   std::vector<double> biasConfig;
+  std::vector<std::vector<double> > seeds;
   //temp: stores # of iterations used in last solve call
   int lastIters;
 };
@@ -19,6 +19,10 @@ class RigidObject;
 class Terrain;
 class Robot;
 
+// Forward declaration of C-type PyObject
+struct _object;
+typedef _object PyObject;
+
 /** @brief Stores mass information for a rigid body or robot link.
  * Note: you should use the set/get functions rather than changing the members
  * directly due to strangeness in SWIG's handling of vectors.
@@ -118,6 +122,16 @@ class RobotModelLink
   void getPositionJacobian(const double p[3],std::vector<std::vector<double> >& out);
   ///Returns the orientation jacobian of the link (row-major matrix)
   void getOrientationJacobian(std::vector<std::vector<double> >& out);
+  ///Same as getJacobian, but returns a 6xn NumPy array.  If out is given,
+  ///it must be a C-contiguous float64 array of that size, and it is filled
+  ///and returned instead of allocating a new array.
+  PyObject* getJacobianArray(const double p[3],PyObject* out=NULL);
+  ///Same as getPositionJacobian, but returns a 3xn NumPy array (see
+  ///getJacobianArray)
+  PyObject* getPositionJacobianArray(const double p[3],PyObject* out=NULL);
+  ///Same as getOrientationJacobian, but returns a 3xn NumPy array (see
+  ///getJacobianArray)
+  PyObject* getOrientationJacobianArray(PyObject* out=NULL);
   ///Returns the velocity of the origin given the robot's current velocity
   void getVelocity(double out[3]);
   ///Returns the angular velocity given the robot's current velocity
@@ -301,6 +315,54 @@ class RobotModel
   ///Note: does not include gravity term G(q)
   void accelFromTorques(const std::vector<double>& t,std::vector<double>& out);
 
+  //NumPy versions of the state and dynamics functions.  Array inputs may be
+  //any C-contiguous float64 buffer (e.g., a NumPy array), and are read
+  //without copying to a list.  If out is given, it must be a C-contiguous
+  //float64 array of the result's size, and it is filled and returned;
+  //otherwise a new NumPy array is returned.  Passing the same out array at
+  //each call avoids allocating a new NumPy array, but the matrix and
+  //dynamics results are still computed in temporary storage and then
+  //copied into out.
+  ///Same as getConfig, but returns a NumPy array
+  PyObject* getConfigArray(PyObject* out=NULL);
+  ///Same as getVelocity, but returns a NumPy array
+  PyObject* getVelocityArray(PyObject* out=NULL);
+  ///Same as setConfig, but takes a float64 array
+  void setConfigArray(PyObject* q);
+  ///Same as setVelocity, but takes a float64 array
+  void setVelocityArray(PyObject* dq);
+  ///Same as getComJacobian, but returns a 3xn NumPy array
+  PyObject* getComJacobianArray(PyObject* out=NULL);
+  ///Same as getMassMatrix, but returns an nxn NumPy array
+  PyObject* getMassMatrixArray(PyObject* out=NULL);
+  ///Same as getMassMatrixInv, but returns an nxn NumPy array
+  PyObject* getMassMatrixInvArray(PyObject* out=NULL);
+  ///Same as getCoriolisForceMatrix, but returns an nxn NumPy array
+  PyObject* getCoriolisForceMatrixArray(PyObject* out=NULL);
+  ///Same as getCoriolisForces, but returns a NumPy array
+  PyObject* getCoriolisForcesArray(PyObject* out=NULL);
+  ///Same as getGravityForces, but returns a NumPy array
+  PyObject* getGravityForcesArray(const double g[3],PyObject* out=NULL);
+  ///Same as torquesFromAccel, but takes and returns float64 arrays
+  PyObject* torquesFromAccelArray(PyObject* ddq,PyObject* out=NULL);
+  ///Same as accelFromTorques, but takes and returns float64 arrays
+  PyObject* accelFromTorquesArray(PyObject* t,PyObject* out=NULL);
+
+  //batch kinematics functions
+  ///Evaluates the world transforms of the given links at each of the N
+  ///configurations in qs, an N x n float64 array, using numThreads threads
+  ///(<= 0 uses all hardware threads).  The robot's configuration is not
+  ///changed.  Returns an N x len(links) x 4 x 4 NumPy array of homogeneous
+  ///transforms.  Other Python threads may run during the computation, and
+  ///batches smaller than 64 configurations run on the calling thread.
+  PyObject* batchLinkTransforms(PyObject* qs,const std::vector<int>& links,int numThreads=0);
+  ///Evaluates the Jacobians of points on the given links at each of the N
+  ///configurations in qs (see batchLinkTransforms).  localPoints lists the
+  ///3 local coordinates of each link's point, or is empty to use the link
+  ///origins.  Returns an N x len(links) x 6 x n NumPy array, where each
+  ///6 x n matrix is laid out as in RobotModelLink.getJacobian.
+  PyObject* batchLinkJacobians(PyObject* qs,const std::vector<int>& links,const std::vector<double>& localPoints,int numThreads=0);
+
   //interpolation functions
   ///Interpolates smoothly between two configurations, properly taking into account nonstandard joints
   void interpolate(const std::vector<double>& a,const std::vector<double>& b,double u,std::vector<double>& out);
@@ -520,9 +582,64 @@ class WorldModel
   ///initialized whenever geometry collision, distance, or ray-casting
   ///routines are called.
   void enableInitCollisions(bool enabled);
+  ///Returns a capsule named "klampt.RobotWorld" holding a pointer to the
+  ///underlying C++ RobotWorld structure, for passing to native code in
+  ///other modules, e.g., motionplanning.CSpaceInterface.setRobot.  The
+  ///capsule holds a reference to the world, so the world stays alive as
+  ///long as the capsule does.
+  PyObject* getNativePointer();
 
   //WARNING: do not modify this member directly
   int index;
 };
 
+/** @brief Performs the collision queries of
+ * klampt.model.collide.WorldCollider natively, returning all results of a
+ * query in one call.
+ *
+ * Keeps a mask of the pairs of elements to test, which by default holds
+ * the same pairs as WorldCollider: terrains vs rigid objects and non-root
+ * robot links, rigid objects vs each other and robot links, links of
+ * different robots, and each robot's enabled self-collision pairs.
+ * Queries gather the candidate pairs from a bounding volume hierarchy over
+ * the world's geometries, test them exactly, and return the results as two
+ * parallel lists of world IDs.
+ *
+ * Geometries are tested at their current transforms, i.e., as of the last
+ * setConfig / setTransform call.  The mask is sized when this object is
+ * created, so create a new one after adding elements to the world.
+ */
+class WorldCollisionQuery
+{
+ public:
+  WorldCollisionQuery(const WorldModel& world);
+  WorldCollisionQuery(const WorldCollisionQuery& rhs);
+  ~WorldCollisionQuery();
+  ///Enables or disables testing between the elements with the given IDs.
+  ///A robot ID refers to all of the robot's links.
+  void enablePair(int id1,int id2,bool enabled=true);
+  ///Returns true if the elements with the given IDs are tested
+  bool isPairEnabled(int id1,int id2);
+  ///Enables or disables all tests involving the element with the given ID
+  void enable(int id,bool enabled=true);
+  ///Returns the enabled pairs whose bounding boxes are within distance tol,
+  ///without testing them exactly.  a[i] < b[i] for each pair.
+  void candidatePairs(double tol,std::vector<int>& out,std::vector<int>& out2);
+  ///Returns all enabled colliding pairs.  a[i] < b[i] for each pair.
+  void collisions(std::vector<int>& out,std::vector<int>& out2);
+  ///Returns all enabled pairs within distance tol.  a[i] < b[i] for each
+  ///pair.
+  void withinDistance(double tol,std::vector<int>& out,std::vector<int>& out2);
+  ///Returns the enabled colliding pairs (a[i],b[i]) with a[i] in ids1 and
+  ///b[i] in ids2.  If ids2 is empty, returns the pairs among ids1, with
+  ///a[i] < b[i].
+  void collisionsBetween(const std::vector<int>& ids1,const std::vector<int>& ids2,std::vector<int>& out,std::vector<int>& out2);
+  ///Same as collisionsBetween, but returns the pairs within distance tol
+  void withinDistanceBetween(const std::vector<int>& ids1,const std::vector<int>& ids2,double tol,std::vector<int>& out,std::vector<int>& out2);
+
+  int world;
+  //WARNING: do not modify this member directly
+  void* dataPtr;
+};
+
 #endif
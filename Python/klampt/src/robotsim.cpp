@@ -8,6 +8,8 @@
 #include "Control/LoggingController.h"
 #include "Planning/RobotCSpace.h"
 #include "Simulation/WorldSimulation.h"
+#include "Modeling/WorldBVH.h"
+#include "Modeling/BatchKinematics.h"
 #include "Modeling/Interpolate.h"
 #include "Planning/RobotCSpace.h"
 #include "IO/XmlWorld.h"
@@ -37,6 +39,15 @@
 
 /***************************  GLOBALS: REFERENCING TO KLAMPT C++ CODE ***************************************/
 
+/// Internally used.  A BatchKinematics kept between calls, so that its
+/// per-thread copies of the robot are reused.  Only touched with the GIL held.
+struct BatchKinematicsCache
+{
+  BatchKinematicsCache() : inUse(false) {}
+  BatchKinematics batch;
+  bool inUse;
+};
+
 /// Internally used.
 struct WorldData
 {
@@ -44,6 +55,8 @@ struct WorldData
   bool worldExternal;
   XmlWorld xmlWorld;
   int refCount;
+  ///Internally used by RobotModel.batchLinkTransforms/Jacobians, per robot
+  vector<SmartPointer<BatchKinematicsCache> > batchKinematics;
 };
 
 /// Internally used.
@@ -1316,6 +1329,111 @@ void copy(const Matrix& mat,vector<vector<double> >& v)
   }
 }
 
+//Accesses a C-contiguous float64 buffer (e.g., a NumPy array) through the
+//Python buffer protocol, so the *Array functions never convert to lists
+class Float64Buffer
+{
+ public:
+  Float64Buffer() : obj(NULL),data(NULL) {}
+  ~Float64Buffer() { if(obj) PyBuffer_Release(&view); }
+  //Gets the buffer of o, which must hold exactly n doubles (any number if
+  //n < 0).  Throws a PyException otherwise.
+  void Get(PyObject* o,Py_ssize_t n,bool writable,const char* name)
+  {
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+    if(writable) flags |= PyBUF_WRITABLE;
+    if(PyObject_GetBuffer(o,&view,flags) != 0) {
+      PyErr_Clear();
+      throw PyException(string(name)+" must be a C-contiguous"+(writable?" writable":"")+" float64 array",Type);
+    }
+    obj = o;
+    const char* format = view.format;
+    if(format && (*format == '@' || *format == '=')) format++;
+    if(view.itemsize != sizeof(double) || (format && strcmp(format,"d") != 0))
+      throw PyException(string(name)+" must be a float64 array",Type);
+    if(n >= 0 && view.len != n*(Py_ssize_t)sizeof(double)) {
+      stringstream ss;
+      ss<<name<<" must have "<<n<<" elements";
+      throw PyException(ss.str(),Type);
+    }
+    data = (double*)view.buf;
+  }
+  Py_ssize_t size() const { return view.len/(Py_ssize_t)sizeof(double); }
+
+  PyObject* obj;
+  Py_buffer view;
+  double* data;
+};
+
+//Returns a new float64 NumPy array of the given shape
+static PyObject* NewArray(const vector<Py_ssize_t>& shape)
+{
+  PyObject* numpy = PyImport_ImportModule("numpy");
+  if(!numpy) throw PyPyErrorException();
+  PyObject* pyshape = PyTuple_New(shape.size());
+  for(size_t i=0;i<shape.size();i++)
+    PyTuple_SetItem(pyshape,i,PyLong_FromSsize_t(shape[i]));
+  PyObject* res = PyObject_CallMethod(numpy,(char*)"zeros",(char*)"O",pyshape);
+  Py_DECREF(pyshape);
+  Py_DECREF(numpy);
+  if(!res) throw PyPyErrorException();
+  return res;
+}
+
+//Returns a new reference to out, or if out is NULL or None, a new float64
+//NumPy array of shape (m,n), or (m,) if n < 0
+static PyObject* OutputArray(PyObject* out,int m,int n)
+{
+  if(out && out != Py_None) {
+    Py_INCREF(out);
+    return out;
+  }
+  vector<Py_ssize_t> shape(1,m);
+  if(n >= 0) shape.push_back(n);
+  return NewArray(shape);
+}
+
+static PyObject* ToArray(const Matrix& mat,PyObject* out)
+{
+  PyObject* res = OutputArray(out,mat.m,mat.n);
+  try {
+    Float64Buffer buf;
+    buf.Get(res,mat.m*mat.n,true,"out");
+    int k=0;
+    for(int i=0;i<mat.m;i++)
+      for(int j=0;j<mat.n;j++)
+        buf.data[k++] = mat(i,j);
+  }
+  catch(...) {
+    Py_DECREF(res);
+    throw;
+  }
+  return res;
+}
+
+static PyObject* ToArray(const Vector& vec,PyObject* out)
+{
+  PyObject* res = OutputArray(out,vec.n,-1);
+  try {
+    Float64Buffer buf;
+    buf.Get(res,vec.n,true,"out");
+    vec.getCopy(buf.data);
+  }
+  catch(...) {
+    Py_DECREF(res);
+    throw;
+  }
+  return res;
+}
+
+static void FromArray(PyObject* in,int n,Vector& vec,const char* name)
+{
+  Float64Buffer buf;
+  buf.Get(in,n,false,name);
+  vec.resize(n);
+  vec.copy(buf.data);
+}
+
 void TriangleMesh::translate(const double t[3])
 {
   for(size_t i=0;i<vertices.size();i+=3) {
@@ -1972,6 +2090,28 @@ void WorldModel::enableInitCollisions(bool enabled)
   }
 }
 
+//releases the world reference held by a capsule from getNativePointer
+static void DerefWorldCapsule(PyObject* capsule)
+{
+  int index = (int)(intptr_t)PyCapsule_GetContext(capsule);
+  try {
+    derefWorld(index);
+  }
+  catch(PyException&) {
+    fprintf(stderr,"WorldModel native pointer: invalid world %d\n",index);
+  }
+}
+
+PyObject* WorldModel::getNativePointer()
+{
+  //the capsule name is the type tag checked by the receiving module
+  PyObject* capsule = PyCapsule_New(worlds[index]->world,"klampt.RobotWorld",DerefWorldCapsule);
+  if(!capsule) return NULL;
+  PyCapsule_SetContext(capsule,(void*)(intptr_t)index);
+  refWorld(index);
+  return capsule;
+}
+
 
 std::string WorldModel::getName(int id)
 {
@@ -2228,20 +2368,46 @@ void RobotModelLink::getPositionJacobian(const double p[3],vector<vector<double>
   copy(Jmat,J);
 }
 
-void RobotModelLink::getOrientationJacobian(vector<vector<double> >& J)
+static void GetOrientationJacobian(Robot* robot,int index,Matrix& Jmat)
 {
-  Matrix Jmat;
-  Jmat.resize(3,robotPtr->links.size(),Zero);
+  Jmat.resize(3,robot->links.size(),Zero);
   int j=index;
   while(j!=-1) {
     Vector3 w;
-    robotPtr->GetOrientationJacobian(index,j,w);
+    robot->GetOrientationJacobian(index,j,w);
     Jmat(0,j)=w.x; Jmat(1,j)=w.y; Jmat(2,j)=w.z;
-    j=robotPtr->parents[j];
+    j=robot->parents[j];
   }
+}
+
+void RobotModelLink::getOrientationJacobian(vector<vector<double> >& J)
+{
+  Matrix Jmat;
+  GetOrientationJacobian(robotPtr,index,Jmat);
   copy(Jmat,J);
 }
 
+PyObject* RobotModelLink::getJacobianArray(const double p[3],PyObject* out)
+{
+  Matrix Jmat;
+  robotPtr->GetFullJacobian(Vector3(p),index,Jmat);
+  return ToArray(Jmat,out);
+}
+
+PyObject* RobotModelLink::getPositionJacobianArray(const double p[3],PyObject* out)
+{
+  Matrix Jmat;
+  robotPtr->GetPositionJacobian(Vector3(p),index,Jmat);
+  return ToArray(Jmat,out);
+}
+
+PyObject* RobotModelLink::getOrientationJacobianArray(PyObject* out)
+{
+  Matrix Jmat;
+  GetOrientationJacobian(robotPtr,index,Jmat);
+  return ToArray(Jmat,out);
+}
+
 void RobotModelLink::getVelocity(double out[3])
 {
   Vector3 v;
@@ -2544,6 +2710,32 @@ void RobotModel::setVelocity(const vector<double>& dq)
   robot->dq.copy(&dq[0]);
 }
 
+PyObject* RobotModel::getConfigArray(PyObject* out)
+{
+  return ToArray(robot->q,out);
+}
+
+PyObject* RobotModel::getVelocityArray(PyObject* out)
+{
+  return ToArray(robot->dq,out);
+}
+
+void RobotModel::setConfigArray(PyObject* q)
+{
+  Float64Buffer buf;
+  buf.Get(q,robot->q.n,false,"configuration");
+  robot->q.copy(buf.data);
+  robot->UpdateFrames();
+  robot->UpdateGeometry();
+}
+
+void RobotModel::setVelocityArray(PyObject* dq)
+{
+  Float64Buffer buf;
+  buf.Get(dq,robot->dq.n,false,"velocity");
+  robot->dq.copy(buf.data);
+}
+
 void RobotModel::getJointLimits(vector<double>& qmin,vector<double>& qmax)
 {
   qmin.resize(robot->q.n);
@@ -2775,42 +2967,86 @@ void RobotModel::getComJacobian(std::vector<std::vector<double> >& out)
   copy(J,out);
 }
 
+static void GetMassMatrix(Robot* robot,Matrix& B)
+{
+  robot->UpdateDynamics();
+  robot->GetKineticEnergyMatrix(B);
+}
+
+static void GetMassMatrixInv(Robot* robot,Matrix& Binv)
+{
+  //robot->UpdateDynamics();
+  NewtonEulerSolver ne(*robot);
+  ne.CalcKineticEnergyMatrixInverse(Binv);
+}
+
+static void GetCoriolisForceMatrix(Robot* robot,Matrix& C)
+{
+  robot->UpdateDynamics();
+  robot->GetCoriolisForceMatrix(C);
+}
+
+static void GetCoriolisForces(Robot* robot,Vector& C)
+{
+  if(robot->links.size() > 6) {
+    NewtonEulerSolver ne(*robot);
+    ne.CalcResidualTorques(C);
+  }
+  else {
+    robot->UpdateDynamics();
+    robot->GetCoriolisForces(C);
+  }
+}
+
+static void TorquesFromAccel(Robot* robot,const Vector& ddq,Vector& t)
+{
+  if(robot->links.size() > 6) {
+    NewtonEulerSolver ne(*robot);
+    ne.CalcTorques(ddq,t);
+  }
+  else {
+    robot->UpdateDynamics();
+    robot->CalcTorques(ddq,t);
+  }
+}
+
+static void AccelFromTorques(Robot* robot,const Vector& t,Vector& ddq)
+{
+  if(robot->links.size() > 6) {
+    NewtonEulerSolver ne(*robot);
+    ne.CalcAccel(t,ddq);
+  }
+  else {
+    robot->UpdateDynamics();
+    robot->CalcAcceleration(ddq,t);
+  }
+}
+
 void RobotModel::getMassMatrix(std::vector<std::vector<double> >& B)
 {
   Matrix Bmat;
-  robot->UpdateDynamics();
-  robot->GetKineticEnergyMatrix(Bmat);
+  GetMassMatrix(robot,Bmat);
   copy(Bmat,B);
 }
 
 void RobotModel::getMassMatrixInv(std::vector<std::vector<double> >& Binv)
 {
   Matrix Bmat;
-  //robot->UpdateDynamics();
-  NewtonEulerSolver ne(*robot);
-  ne.CalcKineticEnergyMatrixInverse(Bmat);
+  GetMassMatrixInv(robot,Bmat);
   copy(Bmat,Binv);
 }
 
 void RobotModel::getCoriolisForceMatrix(std::vector<std::vector<double> >& C)
 {
   Matrix Cmat;
-  robot->UpdateDynamics();
-  robot->GetCoriolisForceMatrix(Cmat);
+  GetCoriolisForceMatrix(robot,Cmat);
   copy(Cmat,C);
 }
 
 void RobotModel::getCoriolisForces(std::vector<double>& C)
 {
   Vector Cvec;
-  if(robot->links.size() > 6) {
-    NewtonEulerSolver ne(*robot);
-    ne.CalcResidualTorques(Cvec);
-  }
-  else {
-    robot->UpdateDynamics();
-    robot->GetCoriolisForces(Cvec);
-  }
+  GetCoriolisForces(robot,Cvec);
   copy(Cvec,C);
 }
 
@@ -2825,14 +3061,7 @@ void RobotModel::torquesFromAccel(const std::vector<double>& ddq,std::vector<dou
 {
   Vector ddqvec,tvec;
   copy(ddq,ddqvec);
-  if(robot->links.size() > 6) {
-    NewtonEulerSolver ne(*robot);
-    ne.CalcTorques(ddqvec,tvec);
-  }
-  else {
-    robot->UpdateDynamics();
-    robot->CalcTorques(ddqvec,tvec);
-  }
+  TorquesFromAccel(robot,ddqvec,tvec);
   copy(tvec,out);
 }
 
@@ -2840,15 +3069,162 @@ void RobotModel::accelFromTorques(const std::vector<double>& t,std::vector<doubl
 {
   Vector ddqvec,tvec;
   copy(t,tvec);
-  if(robot->links.size() > 6) {
-    NewtonEulerSolver ne(*robot);
-    ne.CalcAccel(tvec,ddqvec);
+  AccelFromTorques(robot,tvec,ddqvec);
+  copy(ddqvec,out);
+}
+
+PyObject* RobotModel::getComJacobianArray(PyObject* out)
+{
+  Matrix J;
+  robot->GetCOMJacobian(J);
+  return ToArray(J,out);
+}
+
+PyObject* RobotModel::getMassMatrixArray(PyObject* out)
+{
+  Matrix B;
+  GetMassMatrix(robot,B);
+  return ToArray(B,out);
+}
+
+PyObject* RobotModel::getMassMatrixInvArray(PyObject* out)
+{
+  Matrix Binv;
+  GetMassMatrixInv(robot,Binv);
+  return ToArray(Binv,out);
+}
+
+PyObject* RobotModel::getCoriolisForceMatrixArray(PyObject* out)
+{
+  Matrix C;
+  GetCoriolisForceMatrix(robot,C);
+  return ToArray(C,out);
+}
+
+PyObject* RobotModel::getCoriolisForcesArray(PyObject* out)
+{
+  Vector C;
+  GetCoriolisForces(robot,C);
+  return ToArray(C,out);
+}
+
+PyObject* RobotModel::getGravityForcesArray(const double g[3],PyObject* out)
+{
+  Vector G;
+  robot->GetGravityTorques(Vector3(g),G);
+  return ToArray(G,out);
+}
+
+PyObject* RobotModel::torquesFromAccelArray(PyObject* ddq,PyObject* out)
+{
+  Vector ddqvec,tvec;
+  FromArray(ddq,robot->links.size(),ddqvec,"ddq");
+  TorquesFromAccel(robot,ddqvec,tvec);
+  return ToArray(tvec,out);
+}
+
+PyObject* RobotModel::accelFromTorquesArray(PyObject* t,PyObject* out)
+{
+  Vector ddqvec,tvec;
+  FromArray(t,robot->links.size(),tvec,"t");
+  AccelFromTorques(robot,tvec,ddqvec);
+  return ToArray(ddqvec,out);
+}
+
+//Holds the BatchKinematics kept for a robot while it is used.  Made and
+//destroyed with the GIL held.  If the kept one is already in use by another
+//thread, or the robot is not in a world, a temporary one is used instead.
+class BatchKinematicsLock
+{
+ public:
+  BatchKinematicsLock(int world,int index,Robot* robot)
+  {
+    if(world >= 0 && world < (int)worlds.size() && worlds[world] && index >= 0) {
+      vector<SmartPointer<BatchKinematicsCache> >& caches = worlds[world]->batchKinematics;
+      if((int)caches.size() <= index) caches.resize(index+1);
+      if(!caches[index]) caches[index] = new BatchKinematicsCache;
+      if(!caches[index]->inUse) cache = caches[index];
+    }
+    if(!cache) cache = new BatchKinematicsCache;
+    cache->inUse = true;
+    cache->batch.SetRobot(*robot);
+    cache->batch.ClearQueries();
   }
-  else {
-    robot->UpdateDynamics();
-    robot->CalcAcceleration(ddqvec,tvec);
+  ~BatchKinematicsLock() { cache->inUse = false; }
+  BatchKinematics& batch() { return cache->batch; }
+
+  //a reference, so the batch outlives the world if it is deleted meanwhile
+  SmartPointer<BatchKinematicsCache> cache;
+};
+
+//Sets up the queries of a batch, and returns the number of configurations in qs
+static Py_ssize_t SetupBatch(Robot* robot,const Float64Buffer& qs,const std::vector<int>& links,const std::vector<double>& localPoints,BatchKinematics& batch)
+{
+  Py_ssize_t n = (Py_ssize_t)robot->links.size();
+  if(n == 0 || qs.size() % n != 0) throw PyException("qs must be an N x n array of configurations",Type);
+  if(!localPoints.empty() && localPoints.size() != 3*links.size()) throw PyException("localPoints must have 3 coordinates for each link");
+  for(size_t i=0;i<links.size();i++) {
+    if(links[i] < 0 || links[i] >= n) throw PyException("Invalid link index");
+    if(localPoints.empty()) batch.AddQuery(links[i]);
+    else batch.AddQuery(links[i],Vector3(&localPoints[i*3]));
+  }
+  return qs.size()/n;
+}
+
+PyObject* RobotModel::batchLinkTransforms(PyObject* qs,const std::vector<int>& links,int numThreads)
+{
+  Float64Buffer qbuf;
+  qbuf.Get(qs,-1,false,"qs");
+  BatchKinematicsLock lock(world,index,robot);
+  BatchKinematics& batch = lock.batch();
+  batch.numThreads = numThreads;
+  Py_ssize_t N = SetupBatch(robot,qbuf,links,std::vector<double>(),batch);
+  vector<Py_ssize_t> shape(4,4);
+  shape[0] = N;
+  shape[1] = (Py_ssize_t)links.size();
+  PyObject* res = NewArray(shape);
+  try {
+    Float64Buffer out;
+    out.Get(res,N*shape[1]*16,true,"out");
+    //the batch works on its own copies of the robot, so other Python
+    //threads may run meanwhile
+    Py_BEGIN_ALLOW_THREADS
+    batch.Transforms(qbuf.data,(size_t)N,out.data);
+    Py_END_ALLOW_THREADS
+  }
+  catch(...) {
+    Py_DECREF(res);
+    throw;
   }
-  copy(ddqvec,out);
+  return res;
+}
+
+PyObject* RobotModel::batchLinkJacobians(PyObject* qs,const std::vector<int>& links,const std::vector<double>& localPoints,int numThreads)
+{
+  Float64Buffer qbuf;
+  qbuf.Get(qs,-1,false,"qs");
+  BatchKinematicsLock lock(world,index,robot);
+  BatchKinematics& batch = lock.batch();
+  batch.numThreads = numThreads;
+  Py_ssize_t N = SetupBatch(robot,qbuf,links,localPoints,batch);
+  vector<Py_ssize_t> shape(4);
+  shape[0] = N;
+  shape[1] = (Py_ssize_t)links.size();
+  shape[2] = 6;
+  shape[3] = (Py_ssize_t)robot->links.size();
+  PyObject* res = NewArray(shape);
+  try {
+    Float64Buffer out;
+    out.Get(res,N*shape[1]*6*shape[3],true,"out");
+    Py_BEGIN_ALLOW_THREADS
+    batch.Jacobians(qbuf.data,(size_t)N,out.data);
+    Py_END_ALLOW_THREADS
+  }
+  catch(...) {
+    Py_DECREF(res);
+    throw;
+  }
+  return res;
 }
 
 
@@ -3093,6 +3469,203 @@ void TerrainModel::drawGL(bool keepAppearance)
   }
 }
 
+/// Internally used.
+struct WorldCollisionQueryData
+{
+  char& Mask(int a,int b) { return mask[a*numIDs+b]; }
+  void SetMask(int a,int b,bool enabled) { Mask(a,b) = Mask(b,a) = (enabled ? 1 : 0); }
+  ///Expands a robot ID to its link IDs
+  void Expand(int id,vector<int>& ids) const;
+  void Query(const vector<int>* ids1,const vector<int>* ids2,bool exact,double tol,std::vector<int>& out,std::vector<int>& out2);
+
+  RobotWorld* world;
+  int numIDs;
+  vector<char> mask;     //numIDs x numIDs
+  WorldBVH bvh;
+  //scratch space
+  vector<pair<int,int> > pairs;
+  vector<char> inSet1,inSet2;
+};
+
+void WorldCollisionQueryData::Expand(int id,vector<int>& ids) const
+{
+  ids.resize(0);
+  if(id < 0 || id >= numIDs) throw PyException("Invalid world ID");
+  int r = world->IsRobot(id);
+  if(r >= 0) {
+    for(size_t j=0;j<world->robots[r]->links.size();j++)
+      ids.push_back(world->RobotLinkID(r,j));
+  }
+  else ids.push_back(id);
+}
+
+void WorldCollisionQueryData::Query(const vector<int>* ids1,const vector<int>* ids2,bool exact,double tol,std::vector<int>& out,std::vector<int>& out2)
+{
+  out.resize(0);
+  out2.resize(0);
+  vector<int> temp;
+  if(ids1) {
+    inSet1.assign(numIDs,0);
+    for(size_t i=0;i<ids1->size();i++) {
+      Expand((*ids1)[i],temp);
+      for(size_t k=0;k<temp.size();k++) inSet1[temp[k]] = 1;
+    }
+  }
+  if(ids2) {
+    inSet2.assign(numIDs,0);
+    for(size_t i=0;i<ids2->size();i++) {
+      Expand((*ids2)[i],temp);
+      for(size_t k=0;k<temp.size();k++) inSet2[temp[k]] = 1;
+    }
+  }
+  //broadphase
+  bvh.Refit(*world);
+  bvh.OverlappingPairs(tol,pairs);
+  for(size_t i=0;i<pairs.size();i++) {
+    const WorldBVH::Item& ia = bvh.items[pairs[i].first];
+    const WorldBVH::Item& ib = bvh.items[pairs[i].second];
+    int a = ia.id, b = ib.id;
+    if(a >= numIDs || b >= numIDs || !Mask(a,b)) continue;
+    AnyCollisionGeometry3D* ga = ia.geometry;
+    AnyCollisionGeometry3D* gb = ib.geometry;
+    if(ids2) {
+      if(inSet1[a] && inSet2[b]) { }
+      else if(inSet1[b] && inSet2[a]) { swap(a,b); swap(ga,gb); }
+      else continue;
+    }
+    else {
+      if(ids1 && !(inSet1[a] && inSet1[b])) continue;
+      if(a > b) { swap(a,b); swap(ga,gb); }
+    }
+    //narrowphase
+    if(exact) {
+      if(tol > 0) { if(!ga->WithinDistance(*gb,tol)) continue; }
+      else if(!ga->Collides(*gb)) continue;
+    }
+    out.push_back(a);
+    out2.push_back(b);
+  }
+}
+
+WorldCollisionQuery::WorldCollisionQuery(const WorldModel& _world)
+  :world(_world.index),dataPtr(NULL)
+{
+  refWorld(world);
+  WorldCollisionQueryData* data = new WorldCollisionQueryData;
+  dataPtr = new SmartPointer<WorldCollisionQueryData>(data);
+  RobotWorld& rworld = *worlds[world]->world;
+  data->world = &rworld;
+  data->numIDs = rworld.NumIDs();
+  data->mask.assign(data->numIDs*data->numIDs,0);
+  //the default mask is the same as klampt.model.collide.WorldCollider
+  for(size_t t=0;t<rworld.terrains.size();t++) {
+    int tid = rworld.TerrainID(t);
+    for(size_t o=0;o<rworld.rigidObjects.size();o++)
+      data->SetMask(tid,rworld.RigidObjectID(o),true);
+    for(size_t r=0;r<rworld.robots.size();r++)
+      for(size_t j=0;j<rworld.robots[r]->links.size();j++)
+        //links fixed to the world are not tested against the terrain
+        if(rworld.robots[r]->parents[j] >= 0)
+          data->SetMask(tid,rworld.RobotLinkID(r,j),true);
+  }
+  for(size_t o=0;o<rworld.rigidObjects.size();o++) {
+    int oid = rworld.RigidObjectID(o);
+    for(size_t o2=0;o2<o;o2++)
+      data->SetMask(oid,rworld.RigidObjectID(o2),true);
+    for(size_t r=0;r<rworld.robots.size();r++)
+      for(size_t j=0;j<rworld.robots[r]->links.size();j++)
+        data->SetMask(oid,rworld.RobotLinkID(r,j),true);
+  }
+  for(size_t r=0;r<rworld.robots.size();r++) {
+    Robot* robot = rworld.robots[r];
+    for(size_t r2=0;r2<r;r2++)
+      for(size_t j=0;j<robot->links.size();j++)
+        for(size_t k=0;k<rworld.robots[r2]->links.size();k++)
+          data->SetMask(rworld.RobotLinkID(r,j),rworld.RobotLinkID(r2,k),true);
+    if(robot->selfCollisions.m != (int)robot->links.size()) continue;
+    for(size_t j=0;j<robot->links.size();j++)
+      for(size_t k=j+1;k<robot->links.size();k++)
+        if(robot->selfCollisions(j,k) != NULL)
+          data->SetMask(rworld.RobotLinkID(r,j),rworld.RobotLinkID(r,k),true);
+  }
+}
+
+WorldCollisionQuery::WorldCollisionQuery(const WorldCollisionQuery& rhs)
+  :world(rhs.world),dataPtr(NULL)
+{
+  refWorld(world);
+  dataPtr = new SmartPointer<WorldCollisionQueryData>(*reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(rhs.dataPtr));
+}
+
+WorldCollisionQuery::~WorldCollisionQuery()
+{
+  delete reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(dataPtr);
+  derefWorld(world);
+}
+
+void WorldCollisionQuery::enablePair(int id1,int id2,bool enabled)
+{
+  WorldCollisionQueryData& data = **reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(dataPtr);
+  vector<int> a,b;
+  data.Expand(id1,a);
+  data.Expand(id2,b);
+  for(size_t i=0;i<a.size();i++)
+    for(size_t j=0;j<b.size();j++)
+      if(a[i] != b[j]) data.SetMask(a[i],b[j],enabled);
+}
+
+bool WorldCollisionQuery::isPairEnabled(int id1,int id2)
+{
+  WorldCollisionQueryData& data = **reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(dataPtr);
+  vector<int> a,b;
+  data.Expand(id1,a);
+  data.Expand(id2,b);
+  for(size_t i=0;i<a.size();i++)
+    for(size_t j=0;j<b.size();j++)
+      if(data.Mask(a[i],b[j])) return true;
+  return false;
+}
+
+void WorldCollisionQuery::enable(int id,bool enabled)
+{
+  WorldCollisionQueryData& data = **reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(dataPtr);
+  vector<int> a;
+  data.Expand(id,a);
+  for(size_t i=0;i<a.size();i++)
+    for(int j=0;j<data.numIDs;j++)
+      if(a[i] != j) data.SetMask(a[i],j,enabled);
+}
+
+void WorldCollisionQuery::candidatePairs(double tol,std::vector<int>& out,std::vector<int>& out2)
+{
+  WorldCollisionQueryData& data = **reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(dataPtr);
+  data.Query(NULL,NULL,false,tol,out,out2);
+}
+
+void WorldCollisionQuery::collisions(std::vector<int>& out,std::vector<int>& out2)
+{
+  WorldCollisionQueryData& data = **reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(dataPtr);
+  data.Query(NULL,NULL,true,0,out,out2);
+}
+
+void WorldCollisionQuery::withinDistance(double tol,std::vector<int>& out,std::vector<int>& out2)
+{
+  WorldCollisionQueryData& data = **reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(dataPtr);
+  data.Query(NULL,NULL,true,tol,out,out2);
+}
+
+void WorldCollisionQuery::collisionsBetween(const std::vector<int>& ids1,const std::vector<int>& ids2,std::vector<int>& out,std::vector<int>& out2)
+{
+  WorldCollisionQueryData& data = **reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(dataPtr);
+  data.Query(&ids1,(ids2.empty() ? NULL : &ids2),true,0,out,out2);
+}
+
+void WorldCollisionQuery::withinDistanceBetween(const std::vector<int>& ids1,const std::vector<int>& ids2,double tol,std::vector<int>& out,std::vector<int>& out2)
+{
+  WorldCollisionQueryData& data = **reinterpret_cast<SmartPointer<WorldCollisionQueryData>*>(dataPtr);
+  data.Query(&ids1,(ids2.empty() ? NULL : &ids2),true,tol,out,out2);
+}
+
 
 
 
@@ -3193,6 +3766,18 @@ void Simulator::setState(const string& str)
   sim->ReadState(FromBase64(str));
 }
 
+void Simulator::getSnapshot(std::vector<char>& out)
+{
+  if(!sim->WriteSnapshot(out))
+    throw PyException("Error writing simulation snapshot");
+}
+
+void Simulator::setSnapshot(const std::string& str)
+{
+  if(!sim->ReadSnapshot(str.data(),str.length()))
+    throw PyException("Invalid simulation snapshot");
+}
+
 void Simulator::checkObjectOverlap(std::vector<int>& out,std::vector<int>& out2)
 {
   vector<pair<ODEObjectID,ODEObjectID> > overlaps;
@@ -3775,6 +4360,98 @@ void SimRobotSensor::getMeasurements(std::vector<double>& out)
   sensor->GetMeasurements(out);
 }
 
+std::vector<std::string> SimRobotSensor::measurementArrayNames()
+{
+  std::vector<std::string> names;
+  if(!sensor) return names;
+  vector<SensorMeasurementView> views;
+  sensor->GetMeasurementViews(views);
+  for(size_t i=0;i<views.size();i++)
+    names.push_back(views[i].name);
+  return names;
+}
+
+//Returns the simulator's reference to sensor, or NULL if no simulator owns it
+static SmartPointer<SensorBase> GetSensorReference(SensorBase* sensor)
+{
+  for(size_t i=0;i<sims.size();i++) {
+    if(!sims[i]) continue;
+    vector<ControlledRobotSimulator>& robots = sims[i]->sim.controlSimulators;
+    for(size_t j=0;j<robots.size();j++) {
+      vector<SmartPointer<SensorBase> >& sensors = robots[j].sensors.sensors;
+      for(size_t k=0;k<sensors.size();k++)
+        if((SensorBase*)sensors[k] == sensor) return sensors[k];
+    }
+  }
+  return NULL;
+}
+
+//releases the sensor reference held by a measurement array's base
+static void DeleteSensorCapsule(PyObject* capsule)
+{
+  delete (SmartPointer<SensorBase>*)PyCapsule_GetPointer(capsule,"klampt.SensorBase");
+}
+
+//Returns the class of the objects that numpy uses as the base of measurement
+//arrays.  Each instance exposes a sensor's storage through
+//__array_interface__ and keeps the sensor alive through its 'sensor' capsule.
+static PyObject* MeasurementArrayBaseClass()
+{
+  static PyObject* cls = NULL;
+  if(!cls) {
+    cls = PyObject_CallFunction((PyObject*)&PyType_Type,(char*)"s(O){}","SensorMeasurementArrayBase",(PyObject*)&PyBaseObject_Type);
+    if(!cls) throw PyPyErrorException();
+  }
+  return cls;
+}
+
+PyObject* SimRobotSensor::getMeasurementArray(const std::string& name)
+{
+  if(!sensor) throw PyException("Invalid sensor");
+  vector<SensorMeasurementView> views;
+  sensor->GetMeasurementViews(views);
+  const SensorMeasurementView* view = NULL;
+  for(size_t i=0;i<views.size();i++)
+    if(views[i].name == name) view = &views[i];
+  if(!view) throw PyException("Sensor has no measurement array named "+name);
+  SmartPointer<SensorBase> ref = GetSensorReference(sensor);
+  if(!ref) throw PyException("Sensor is not owned by a simulator");
+  const int one = 1;
+  string typestr = (*(const char*)&one == 1 ? "<" : ">");
+  if(view->type == SensorMeasurementView::Float32) typestr += "f4";
+  else if(view->type == SensorMeasurementView::UInt8) typestr = "|u1";
+  else typestr += "f8";
+
+  PyObject* numpy = PyImport_ImportModule("numpy");
+  if(!numpy) throw PyPyErrorException();
+  PyObject* shape = PyTuple_New(view->shape.size());
+  for(size_t i=0;i<view->shape.size();i++)
+    PyTuple_SetItem(shape,i,PyInt_FromLong(view->shape[i]));
+  PyObject* result = NULL;
+  if(view->NumElements() == 0 || view->data == NULL) {
+    //numpy does not accept a NULL data pointer
+    result = PyObject_CallMethod(numpy,(char*)"zeros",(char*)"Os",shape,typestr.c_str());
+    Py_DECREF(shape);
+  }
+  else {
+    //a read-only view of the sensor's storage.  numpy keeps base alive, and
+    //base keeps the sensor alive, even after the simulator is destroyed.
+    PyObject* base = PyObject_CallObject(MeasurementArrayBaseClass(),NULL);
+    PyObject* capsule = PyCapsule_New(new SmartPointer<SensorBase>(ref),"klampt.SensorBase",DeleteSensorCapsule);
+    PyObject* interface = Py_BuildValue("{s:N,s:s,s:(NO),s:i}","shape",shape,"typestr",typestr.c_str(),"data",PyLong_FromVoidPtr(const_cast<void*>(view->data)),Py_True,"version",3);
+    if(base && capsule && interface &&
+       PyObject_SetAttrString(base,"sensor",capsule) == 0 &&
+       PyObject_SetAttrString(base,"__array_interface__",interface) == 0)
+      result = PyObject_CallMethod(numpy,(char*)"asarray",(char*)"O",base);
+    Py_XDECREF(interface);
+    Py_XDECREF(capsule);
+    Py_XDECREF(base);
+  }
+  Py_DECREF(numpy);
+  if(!result) throw PyPyErrorException();
+  return result;
+}
+
 std::string SimRobotSensor::getSetting(const std::string& name)
 {
   if(!sensor) return std::string();
@@ -17,6 +17,10 @@ class ControlledRobotSimulator;
 class ODEGeometry;
 typedef struct dxBody *dBodyID;
 
+// Forward declaration of C-type PyObject
+struct _object;
+typedef _object PyObject;
+
 //forward declarations
 class SimRobotSensor;
 class SimRobotController;
@@ -58,6 +62,16 @@ class SimRobotSensor
   std::vector<std::string> measurementNames();
   ///Returns a list of measurements from the previous simulation (or kinematicSimulate) timestep
   void getMeasurements(std::vector<double>& out);
+  ///Returns the names of the arrays available through getMeasurementArray,
+  ///e.g., ['rgb','depth'] for a camera.
+  std::vector<std::string> measurementArrayNames();
+  ///Returns a read-only numpy view of the named measurement array, e.g.,
+  ///an h x w x 3 uint8 array for a camera's 'rgb' image and an h x w
+  ///float32 array for its 'depth' image.  The view shares the sensor's
+  ///storage, so its contents change on the next simulation step; copy it to
+  ///keep a measurement.  The view keeps the sensor alive, but must not be
+  ///used after the sensor's resolution settings change.  Requires numpy.
+  PyObject* getMeasurementArray(const std::string& name);
   ///Returns the value of the named setting (you will need to manually parse this)
   std::string getSetting(const std::string& name);
   ///Sets the value of the named setting (you will need to manually cast an int/float/etc to a str)
@@ -323,6 +337,14 @@ class Simulator
   /// Sets the current simulation state from a Base64 string returned by
   /// a prior getState call.
   void setState(const std::string& str);
+  /// Returns a compact binary snapshot of the current simulation state as
+  /// a bytes object.  Faster than getState, since the state is copied
+  /// directly with no Base64 encoding.  Snapshots can only be restored into
+  /// a simulator with the same world and controllers.
+  void getSnapshot(std::vector<char>& out_bytes);
+  /// Sets the current simulation state from a bytes object returned by a
+  /// prior getSnapshot call.
+  void setSnapshot(const std::string& in_bytes);
 
   /// Advances the simulation by time t, and updates the world model from the
   /// simulation state.
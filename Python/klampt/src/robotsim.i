@@ -198,6 +198,10 @@ static PyObject* convert_dmatrix_obj(const std::vector<std::vector<double> >& ma
    $1 = &temp[0];
 }
 
+%typemap(typecheck,precedence=SWIG_TYPECHECK_DOUBLE_ARRAY) const double [ANY] {
+   $1 = (PySequence_Check($input) && PyObject_Length($input) == $1_dim0) ? 1 : 0;
+}
+
 %typemap(in, numinputs=0) double out[ANY] (double temp[$1_dim0]) {
    $1 = &temp[0];
 }
@@ -440,6 +444,40 @@ static PyObject* convert_dmatrix_obj(const std::vector<std::vector<double> >& ma
     }
 }
 
+%typemap(in, numinputs=0) std::vector<char>& out_bytes (std::vector<char> temp) {
+    $1 = &temp;
+}
+
+%typemap(argout) std::vector<char>& out_bytes {
+    PyObject *o, *o2, *o3;
+    o = PyBytes_FromStringAndSize(($1->empty() ? NULL : &(*$1)[0]),(Py_ssize_t)$1->size());
+    if ((!$result) || ($result == Py_None)) {
+        $result = o;
+    } else {
+        if (!PyTuple_Check($result)) {
+            PyObject *o2 = $result;
+            $result = PyTuple_New(1);
+            PyTuple_SetItem($result,0,o2);
+        }
+        o3 = PyTuple_New(1);
+        PyTuple_SetItem(o3,0,o);
+        o2 = $result;
+        $result = PySequence_Concat(o2,o3);
+        Py_DECREF(o2);
+        Py_DECREF(o3);
+    }
+}
+
+%typemap(in) const std::string& in_bytes (std::string temp) {
+    char* buf;
+    Py_ssize_t len;
+    if (PyBytes_AsStringAndSize($input,&buf,&len) < 0) {
+        return NULL;
+    }
+    temp.assign(buf,len);
+    $1 = &temp;
+}
+
 %typemap(argout) std::vector<std::string> {
   int size = $1.size();
   $result = PyList_New(size);
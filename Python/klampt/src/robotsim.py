@@ -1875,6 +1875,37 @@ class RobotModelLink(_object):
         """
         return _robotsim.RobotModelLink_getOrientationJacobian(self)
 
+    def getJacobianArray(self, *args):
+        """
+        getJacobianArray(RobotModelLink self, double const [3] p, PyObject * out=None) -> PyObject *
+        getJacobianArray(RobotModelLink self, double const [3] p) -> PyObject *
+
+        Same as getJacobian, but returns a 6xn NumPy array. If out is given,
+        it must be a C-contiguous float64 array of that size, and it is filled
+        and returned instead of allocating a new array. 
+        """
+        return _robotsim.RobotModelLink_getJacobianArray(self, *args)
+
+    def getPositionJacobianArray(self, *args):
+        """
+        getPositionJacobianArray(RobotModelLink self, double const [3] p, PyObject * out=None) -> PyObject *
+        getPositionJacobianArray(RobotModelLink self, double const [3] p) -> PyObject *
+
+        Same as getPositionJacobian, but returns a 3xn NumPy array (see
+        getJacobianArray) 
+        """
+        return _robotsim.RobotModelLink_getPositionJacobianArray(self, *args)
+
+    def getOrientationJacobianArray(self, out=None):
+        """
+        getOrientationJacobianArray(RobotModelLink self, PyObject * out=None) -> PyObject *
+        getOrientationJacobianArray(RobotModelLink self) -> PyObject *
+
+        Same as getOrientationJacobian, but returns a 3xn NumPy array (see
+        getJacobianArray) 
+        """
+        return _robotsim.RobotModelLink_getOrientationJacobianArray(self, out)
+
     def getVelocity(self):
         """
         getVelocity(RobotModelLink self)
@@ -2395,6 +2426,139 @@ class RobotModel(_object):
         """
         return _robotsim.RobotModel_accelFromTorques(self, *args)
 
+    def getConfigArray(self, out=None):
+        """
+        getConfigArray(RobotModel self, PyObject * out=None) -> PyObject *
+        getConfigArray(RobotModel self) -> PyObject *
+
+        Same as getConfig, but returns a NumPy array 
+        """
+        return _robotsim.RobotModel_getConfigArray(self, out)
+
+    def getVelocityArray(self, out=None):
+        """
+        getVelocityArray(RobotModel self, PyObject * out=None) -> PyObject *
+        getVelocityArray(RobotModel self) -> PyObject *
+
+        Same as getVelocity, but returns a NumPy array 
+        """
+        return _robotsim.RobotModel_getVelocityArray(self, out)
+
+    def setConfigArray(self, *args):
+        """
+        setConfigArray(RobotModel self, PyObject * q)
+
+        Same as setConfig, but takes a float64 array 
+        """
+        return _robotsim.RobotModel_setConfigArray(self, *args)
+
+    def setVelocityArray(self, *args):
+        """
+        setVelocityArray(RobotModel self, PyObject * dq)
+
+        Same as setVelocity, but takes a float64 array 
+        """
+        return _robotsim.RobotModel_setVelocityArray(self, *args)
+
+    def getComJacobianArray(self, out=None):
+        """
+        getComJacobianArray(RobotModel self, PyObject * out=None) -> PyObject *
+        getComJacobianArray(RobotModel self) -> PyObject *
+
+        Same as getComJacobian, but returns a 3xn NumPy array 
+        """
+        return _robotsim.RobotModel_getComJacobianArray(self, out)
+
+    def getMassMatrixArray(self, out=None):
+        """
+        getMassMatrixArray(RobotModel self, PyObject * out=None) -> PyObject *
+        getMassMatrixArray(RobotModel self) -> PyObject *
+
+        Same as getMassMatrix, but returns an nxn NumPy array 
+        """
+        return _robotsim.RobotModel_getMassMatrixArray(self, out)
+
+    def getMassMatrixInvArray(self, out=None):
+        """
+        getMassMatrixInvArray(RobotModel self, PyObject * out=None) -> PyObject *
+        getMassMatrixInvArray(RobotModel self) -> PyObject *
+
+        Same as getMassMatrixInv, but returns an nxn NumPy array 
+        """
+        return _robotsim.RobotModel_getMassMatrixInvArray(self, out)
+
+    def getCoriolisForceMatrixArray(self, out=None):
+        """
+        getCoriolisForceMatrixArray(RobotModel self, PyObject * out=None) -> PyObject *
+        getCoriolisForceMatrixArray(RobotModel self) -> PyObject *
+
+        Same as getCoriolisForceMatrix, but returns an nxn NumPy array 
+        """
+        return _robotsim.RobotModel_getCoriolisForceMatrixArray(self, out)
+
+    def getCoriolisForcesArray(self, out=None):
+        """
+        getCoriolisForcesArray(RobotModel self, PyObject * out=None) -> PyObject *
+        getCoriolisForcesArray(RobotModel self) -> PyObject *
+
+        Same as getCoriolisForces, but returns a NumPy array 
+        """
+        return _robotsim.RobotModel_getCoriolisForcesArray(self, out)
+
+    def getGravityForcesArray(self, *args):
+        """
+        getGravityForcesArray(RobotModel self, double const [3] g, PyObject * out=None) -> PyObject *
+        getGravityForcesArray(RobotModel self, double const [3] g) -> PyObject *
+
+        Same as getGravityForces, but returns a NumPy array 
+        """
+        return _robotsim.RobotModel_getGravityForcesArray(self, *args)
+
+    def torquesFromAccelArray(self, *args):
+        """
+        torquesFromAccelArray(RobotModel self, PyObject * ddq, PyObject * out=None) -> PyObject *
+        torquesFromAccelArray(RobotModel self, PyObject * ddq) -> PyObject *
+
+        Same as torquesFromAccel, but takes and returns float64 arrays 
+        """
+        return _robotsim.RobotModel_torquesFromAccelArray(self, *args)
+
+    def accelFromTorquesArray(self, *args):
+        """
+        accelFromTorquesArray(RobotModel self, PyObject * t, PyObject * out=None) -> PyObject *
+        accelFromTorquesArray(RobotModel self, PyObject * t) -> PyObject *
+
+        Same as accelFromTorques, but takes and returns float64 arrays 
+        """
+        return _robotsim.RobotModel_accelFromTorquesArray(self, *args)
+
+    def batchLinkTransforms(self, *args):
+        """
+        batchLinkTransforms(RobotModel self, PyObject * qs, intVector links, int numThreads=0) -> PyObject *
+        batchLinkTransforms(RobotModel self, PyObject * qs, intVector links) -> PyObject *
+
+        Evaluates the world transforms of the given links at each of the N
+        configurations in qs, an N x n float64 array, using numThreads threads
+        (<= 0 uses all hardware threads). The robot's configuration is not
+        changed. Returns an N x len(links) x 4 x 4 NumPy array of homogeneous
+        transforms. Other Python threads may run during the computation, and
+        batches smaller than 64 configurations run on the calling thread. 
+        """
+        return _robotsim.RobotModel_batchLinkTransforms(self, *args)
+
+    def batchLinkJacobians(self, *args):
+        """
+        batchLinkJacobians(RobotModel self, PyObject * qs, intVector links, doubleVector localPoints, int numThreads=0) -> PyObject *
+        batchLinkJacobians(RobotModel self, PyObject * qs, intVector links, doubleVector localPoints) -> PyObject *
+
+        Evaluates the Jacobians of points on the given links at each of the N
+        configurations in qs (see batchLinkTransforms). localPoints lists the
+        3 local coordinates of each link's point, or is empty to use the link
+        origins. Returns an N x len(links) x 6 x n NumPy array, where each 6 x
+        n matrix is laid out as in RobotModelLink.getJacobian. 
+        """
+        return _robotsim.RobotModel_batchLinkJacobians(self, *args)
+
     def interpolate(self, *args):
         """
         interpolate(RobotModel self, doubleVector a, doubleVector b, double u)
@@ -2981,12 +3145,138 @@ class WorldModel(_object):
         """
         return _robotsim.WorldModel_enableInitCollisions(self, *args)
 
+    def getNativePointer(self):
+        """
+        getNativePointer(WorldModel self) -> PyObject *
+
+        Returns a capsule named "klampt.RobotWorld" holding a pointer to the
+        underlying C++ RobotWorld structure, for passing to native code in
+        other modules, e.g., motionplanning.CSpaceInterface.setRobot. The
+        capsule does not keep the world alive, so it is only valid while this
+        world exists. 
+        """
+        return _robotsim.WorldModel_getNativePointer(self)
+
     __swig_setmethods__["index"] = _robotsim.WorldModel_index_set
     __swig_getmethods__["index"] = _robotsim.WorldModel_index_get
     if _newclass:index = _swig_property(_robotsim.WorldModel_index_get, _robotsim.WorldModel_index_set)
 WorldModel_swigregister = _robotsim.WorldModel_swigregister
 WorldModel_swigregister(WorldModel)
 
+class WorldCollisionQuery(_object):
+    """
+    Performs the collision queries of klampt.model.collide.WorldCollider
+    natively, returning all results of a query in one call.
+
+    Keeps a mask of the pairs of elements to test, which by default holds
+    the same pairs as WorldCollider: terrains vs rigid objects and
+    non-root robot links, rigid objects vs each other and robot links,
+    links of different robots, and each robot's enabled self-collision
+    pairs. Queries gather the candidate pairs from a bounding volume
+    hierarchy over the world's geometries, test them exactly, and return
+    the results as two parallel lists of world IDs.
+
+    Geometries are tested at their current transforms, i.e., as of the
+    last setConfig / setTransform call. The mask is sized when this object
+    is created, so create a new one after adding elements to the world.
+
+    C++ includes: robotmodel.h 
+    """
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, WorldCollisionQuery, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, WorldCollisionQuery, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        """
+        __init__(WorldCollisionQuery self, WorldModel world) -> WorldCollisionQuery
+        __init__(WorldCollisionQuery self, WorldCollisionQuery rhs) -> WorldCollisionQuery
+        """
+        this = _robotsim.new_WorldCollisionQuery(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    __swig_destroy__ = _robotsim.delete_WorldCollisionQuery
+    __del__ = lambda self : None;
+    def enablePair(self, *args):
+        """
+        enablePair(WorldCollisionQuery self, int id1, int id2, bool enabled=True)
+        enablePair(WorldCollisionQuery self, int id1, int id2)
+
+        Enables or disables testing between the elements with the given IDs. A
+        robot ID refers to all of the robot's links. 
+        """
+        return _robotsim.WorldCollisionQuery_enablePair(self, *args)
+
+    def isPairEnabled(self, *args):
+        """
+        isPairEnabled(WorldCollisionQuery self, int id1, int id2) -> bool
+
+        Returns true if the elements with the given IDs are tested. 
+        """
+        return _robotsim.WorldCollisionQuery_isPairEnabled(self, *args)
+
+    def enable(self, *args):
+        """
+        enable(WorldCollisionQuery self, int id, bool enabled=True)
+        enable(WorldCollisionQuery self, int id)
+
+        Enables or disables all tests involving the element with the given ID. 
+        """
+        return _robotsim.WorldCollisionQuery_enable(self, *args)
+
+    def candidatePairs(self, *args):
+        """
+        candidatePairs(WorldCollisionQuery self, double tol)
+
+        Returns the enabled pairs whose bounding boxes are within distance
+        tol, without testing them exactly. a[i] < b[i] for each pair. 
+        """
+        return _robotsim.WorldCollisionQuery_candidatePairs(self, *args)
+
+    def collisions(self):
+        """
+        collisions(WorldCollisionQuery self)
+
+        Returns all enabled colliding pairs. a[i] < b[i] for each pair. 
+        """
+        return _robotsim.WorldCollisionQuery_collisions(self)
+
+    def withinDistance(self, *args):
+        """
+        withinDistance(WorldCollisionQuery self, double tol)
+
+        Returns all enabled pairs within distance tol. a[i] < b[i] for each
+        pair. 
+        """
+        return _robotsim.WorldCollisionQuery_withinDistance(self, *args)
+
+    def collisionsBetween(self, *args):
+        """
+        collisionsBetween(WorldCollisionQuery self, intVector ids1, intVector ids2)
+
+        Returns the enabled colliding pairs (a[i],b[i]) with a[i] in ids1 and
+        b[i] in ids2. If ids2 is empty, returns the pairs among ids1, with
+        a[i] < b[i]. 
+        """
+        return _robotsim.WorldCollisionQuery_collisionsBetween(self, *args)
+
+    def withinDistanceBetween(self, *args):
+        """
+        withinDistanceBetween(WorldCollisionQuery self, intVector ids1, intVector ids2, double tol)
+
+        Same as collisionsBetween, but returns the pairs within distance tol. 
+        """
+        return _robotsim.WorldCollisionQuery_withinDistanceBetween(self, *args)
+
+    __swig_setmethods__["world"] = _robotsim.WorldCollisionQuery_world_set
+    __swig_getmethods__["world"] = _robotsim.WorldCollisionQuery_world_get
+    if _newclass:world = _swig_property(_robotsim.WorldCollisionQuery_world_get, _robotsim.WorldCollisionQuery_world_set)
+    __swig_setmethods__["dataPtr"] = _robotsim.WorldCollisionQuery_dataPtr_set
+    __swig_getmethods__["dataPtr"] = _robotsim.WorldCollisionQuery_dataPtr_get
+    if _newclass:dataPtr = _swig_property(_robotsim.WorldCollisionQuery_dataPtr_get, _robotsim.WorldCollisionQuery_dataPtr_set)
+WorldCollisionQuery_swigregister = _robotsim.WorldCollisionQuery_swigregister
+WorldCollisionQuery_swigregister(WorldCollisionQuery)
+
 class IKObjective(_object):
     """
     A class defining an inverse kinematic target. Either a link on a robot
@@ -3468,6 +3758,47 @@ class IKSolver(_object):
         """
         return _robotsim.IKSolver_sampleInitial(self)
 
+    def solveMultiStart(self, *args):
+        """
+        solveMultiStart(IKSolver self, int numRestarts, int numThreads=0, bool best=False) -> bool
+        solveMultiStart(IKSolver self, int numRestarts, int numThreads=0) -> bool
+        solveMultiStart(IKSolver self, int numRestarts) -> bool
+
+        Multi-start solve: runs the solver from up to numRestarts starting
+        configurations, concurrently on numThreads threads (<= 0 uses all
+        hardware threads). The starts are the robot's current configuration,
+        then the seeds given to addSeed, then random samples drawn as in
+        sampleInitial.
+
+        If best is false, the result is the first start in this order that
+        converges, and the later starts are stopped once it is found. If
+        best is true, all starts are run and the result is the converged
+        configuration closest to the bias configuration (or to the current
+        configuration if no bias is set). Either way, the chosen start does
+        not depend on the number of threads.
+
+        Returns true and sets the robot to the result if any start converged.
+        Otherwise, the robot's configuration is left unchanged. Other Python
+        threads may run while the starts are solved. 
+        """
+        return _robotsim.IKSolver_solveMultiStart(self, *args)
+
+    def addSeed(self, *args):
+        """
+        addSeed(IKSolver self, doubleVector q)
+
+        Adds a starting configuration for solveMultiStart. 
+        """
+        return _robotsim.IKSolver_addSeed(self, *args)
+
+    def clearSeeds(self):
+        """
+        clearSeeds(IKSolver self)
+
+        Clears the starting configurations added by addSeed. 
+        """
+        return _robotsim.IKSolver_clearSeeds(self)
+
     __swig_setmethods__["robot"] = _robotsim.IKSolver_robot_set
     __swig_getmethods__["robot"] = _robotsim.IKSolver_robot_get
     if _newclass:robot = _swig_property(_robotsim.IKSolver_robot_get, _robotsim.IKSolver_robot_set)
@@ -3495,6 +3826,9 @@ class IKSolver(_object):
     __swig_setmethods__["biasConfig"] = _robotsim.IKSolver_biasConfig_set
     __swig_getmethods__["biasConfig"] = _robotsim.IKSolver_biasConfig_get
     if _newclass:biasConfig = _swig_property(_robotsim.IKSolver_biasConfig_get, _robotsim.IKSolver_biasConfig_set)
+    __swig_setmethods__["seeds"] = _robotsim.IKSolver_seeds_set
+    __swig_getmethods__["seeds"] = _robotsim.IKSolver_seeds_get
+    if _newclass:seeds = _swig_property(_robotsim.IKSolver_seeds_get, _robotsim.IKSolver_seeds_set)
     __swig_setmethods__["lastIters"] = _robotsim.IKSolver_lastIters_set
     __swig_getmethods__["lastIters"] = _robotsim.IKSolver_lastIters_get
     if _newclass:lastIters = _swig_property(_robotsim.IKSolver_lastIters_get, _robotsim.IKSolver_lastIters_set)
@@ -3753,6 +4087,28 @@ class SimRobotSensor(_object):
         """
         return _robotsim.SimRobotSensor_getMeasurements(self)
 
+    def measurementArrayNames(self):
+        """
+        measurementArrayNames(SimRobotSensor self) -> stringVector
+
+        Returns the names of the arrays available through getMeasurementArray,
+        e.g., ['rgb','depth'] for a camera. 
+        """
+        return _robotsim.SimRobotSensor_measurementArrayNames(self)
+
+    def getMeasurementArray(self, *args):
+        """
+        getMeasurementArray(SimRobotSensor self, std::string const & name) -> PyObject *
+
+        Returns a read-only numpy view of the named measurement array, e.g.,
+        an h x w x 3 uint8 array for a camera's 'rgb' image and an h x w
+        float32 array for its 'depth' image. The view shares the sensor's
+        storage, so its contents change on the next simulation step; copy it to
+        keep a measurement. The view keeps the sensor alive, but must not be
+        used after the sensor's resolution settings change. Requires numpy. 
+        """
+        return _robotsim.SimRobotSensor_getMeasurementArray(self, *args)
+
     def getSetting(self, *args):
         """
         getSetting(SimRobotSensor self, std::string const & name) -> std::string
@@ -4422,6 +4778,26 @@ class Simulator(_object):
         """
         return _robotsim.Simulator_setState(self, *args)
 
+    def getSnapshot(self):
+        """
+        getSnapshot(Simulator self)
+
+        Returns a compact binary snapshot of the current simulation state as a
+        bytes object. Faster than getState, since the state is copied directly
+        with no Base64 encoding. Snapshots can only be restored into a
+        simulator with the same world and controllers. 
+        """
+        return _robotsim.Simulator_getSnapshot(self)
+
+    def setSnapshot(self, *args):
+        """
+        setSnapshot(Simulator self, std::string const & in_bytes)
+
+        Sets the current simulation state from a bytes object returned by a
+        prior getSnapshot call. 
+        """
+        return _robotsim.Simulator_setSnapshot(self, *args)
+
     def simulate(self, *args):
         """
         simulate(Simulator self, double t)
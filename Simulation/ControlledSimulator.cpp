@@ -11,7 +11,7 @@ const static double gJointLimitWarningThreshold = Inf;
 
 
 ControlledRobotSimulator::ControlledRobotSimulator()
-  :robot(NULL),oderobot(NULL),controller(NULL)
+  :robot(NULL),oderobot(NULL),controller(NULL),sensorNoise(NULL)
 {
   controlTimeStep = 0.01;
 }
@@ -182,35 +182,63 @@ void ControlledRobotSimulator::GetActuatorTorques(Vector& t) const
 
 void ControlledRobotSimulator::Step(Real dt,WorldSimulation* sim)
 {
-  Real endOfTimeStep = curTime + dt;
+  SimulateSensors(dt,sim);
+  StepControl(dt);
+}
 
-  //process sensors, which don't operate on the same loop as the controller,
-  //necessarily.
-  if(nextSenseTime.empty()) {
-    //make sure the sensors get updated
+bool ControlledRobotSimulator::SensorDue(int i,Real dt,Real& delay)
+{
+  if(nextSenseTime.size() != sensors.sensors.size()) {
+    //make sure the sensors get updated.  Sensors may be added at any time,
+    //so hook the new ones up to the noise stream here
+    for(size_t k=nextSenseTime.size();k<sensors.sensors.size();k++)
+      sensors.sensors[k]->noise = sensorNoise;
     nextSenseTime.resize(sensors.sensors.size(),0);
   }
-  for(size_t i=0;i<sensors.sensors.size();i++) {
-    Real delay = 0;
-    if(sensors.sensors[i]->rate == 0)
-      delay = controlTimeStep;
-    else
-      delay = 1.0/sensors.sensors[i]->rate;
-    if(delay < dt) {
-      printf("Sensor %s set to rate higher than internal simulation time step\n",sensors.sensors[i]->name.c_str());
-      printf("  ... Limiting sensor rate to %s\n",1.0/dt);
-      sensors.sensors[i]->rate = 1.0/dt;
-      //todo: handle numerical errors in inversion...
-      delay = dt;
-    }
+  if(sensors.sensors[i]->rate == 0)
+    delay = controlTimeStep;
+  else
+    delay = 1.0/sensors.sensors[i]->rate;
+  if(delay < dt) {
+    printf("Sensor %s set to rate higher than internal simulation time step\n",sensors.sensors[i]->name.c_str());
+    printf("  ... Limiting sensor rate to %g\n",1.0/dt);
+    sensors.sensors[i]->rate = 1.0/dt;
+    //todo: handle numerical errors in inversion...
+    delay = dt;
+  }
+  return curTime >= nextSenseTime[i];
+}
+
+void ControlledRobotSimulator::SetSensorNoise(RandomStream* noise)
+{
+  sensorNoise = noise;
+  for(size_t i=0;i<sensors.sensors.size();i++)
+    sensors.sensors[i]->noise = noise;
+}
+
+void ControlledRobotSimulator::AdvanceSensor(int i,Real delay)
+{
+  sensors.sensors[i]->Advance(delay);
+  nextSenseTime[i] += delay;
+}
 
-    if(curTime >= nextSenseTime[i]) {
+void ControlledRobotSimulator::SimulateSensors(Real dt,WorldSimulation* sim)
+{
+  //process sensors, which don't operate on the same loop as the controller,
+  //necessarily.
+  for(size_t i=0;i<sensors.sensors.size();i++) {
+    Real delay;
+    if(SensorDue(i,dt,delay)) {
       //trigger a sensing action
       sensors.sensors[i]->Simulate(this,sim);
-      sensors.sensors[i]->Advance(delay);
-      nextSenseTime[i] += delay;
+      AdvanceSensor(i,delay);
     }
   }
+}
+
+void ControlledRobotSimulator::StepControl(Real dt)
+{
+  Real endOfTimeStep = curTime + dt;
 
   if(controller) {
     //the controller update happens less often than the PID update loop
@@ -18,7 +18,20 @@ class ControlledRobotSimulator
  public:
   ControlledRobotSimulator();
   void Init(Robot* robot,ODERobot* oderobot,RobotController* controller=NULL);
+  ///Simulates the sensors that are due, then steps the controller
   void Step(Real dt,WorldSimulation* sim);
+  ///The two parts of Step
+  void SimulateSensors(Real dt,WorldSimulation* sim);
+  void StepControl(Real dt);
+  ///Returns true if sensor i should be simulated at the current time, and
+  ///sets delay to its sensing period
+  bool SensorDue(int i,Real dt,Real& delay);
+  ///Called after sensor i is simulated
+  void AdvanceSensor(int i,Real delay);
+  ///Makes the sensors draw their noise from the given stream, or from the
+  ///global generator if NULL.  Sensors added afterwards are hooked up to it
+  ///before their first update.
+  void SetSensorNoise(RandomStream* noise);
   void UpdateRobot();
 
   void GetCommandedConfig(Config& q);
@@ -41,6 +54,9 @@ class ControlledRobotSimulator
   ODERobot* oderobot;
   RobotController* controller;
   Real controlTimeStep;
+  ///If set, the sensors draw their noise from this stream (see
+  ///SensorBase::noise)
+  RandomStream* sensorNoise;
 
   //state
   Real curTime;
@@ -1,5 +1,6 @@
 #include "ODECustomGeometry.h"
 #include "ODECommon.h"
+#include "Modeling/Atomic.h"
 #include <KrisLibrary/geometry/CollisionPointCloud.h>
 #include <ode/collision.h>
 #include <KrisLibrary/Timer.h>
@@ -26,7 +27,10 @@ const static bool gDoTriangleTriangleCollisionDetection = false;
 //doesn't consider unique contact points if they are between this tolerance
 const static Real cptol=1e-5;
 
-static bool gCustomGeometryMeshesIntersect = false;
+//the extra distance, as a multiple of the contact tolerance, that cached
+//mesh-mesh queries look ahead.  Larger values let the cache survive more
+//motion but re-check more triangle pairs on each step
+const static Real gContactCacheSlackScale = 1.0;
 
 int gdCustomGeometryClass = 0;
 
@@ -227,10 +231,10 @@ Vector3 ContactNormal(CollisionMesh& m1,CollisionMesh& m2,const Vector3& p1,cons
     }
     return m1.currentTransform.R*(-tri1.normal());
   }
-  static int warnedCount = 0;
-  if(warnedCount % 10000 == 0) 
+  //may be called from the parallel narrowphase
+  static volatile int warnedCount = 0;
+  if(AtomicAdd(&warnedCount,1) % 10000 == 0) 
     printf("ODECustomMesh: Warning, degenerate triangle, types %d %d\n",type1,type2);
-  warnedCount++;
   //AssertNotReached();
   return Vector3(Zero);
 }
@@ -263,26 +267,189 @@ Vector3 ContactNormal(CollisionMesh& m,const Vector3& p,int t,const Vector3& clo
   case 3:  //face
     return m.currentTransform.R*(-tri.normal());
   }
-  static int warnedCount = 0;
-  if(warnedCount % 10000 == 0) 
+  //may be called from the parallel narrowphase
+  static volatile int warnedCount = 0;
+  if(AtomicAdd(&warnedCount,1) % 10000 == 0) 
     printf("ODECustomMesh: Warning, degenerate triangle, types %d\n",type);
-  warnedCount++;
   //AssertNotReached();
   return Vector3(Zero);
 }
 
-int MeshMeshCollide(CollisionMesh& m1,Real outerMargin1,CollisionMesh& m2,Real outerMargin2,dContactGeom* contact,int maxcontacts)
+CustomGeometryContactCache::MeshPair::MeshPair()
+  :radius2(0),tolerance(-1),slack(0)
+{}
+
+//closest points between segments [a0,a1] and [b0,b1]
+static Real SegmentSegmentClosestPoints(const Vector3& a0,const Vector3& a1,const Vector3& b0,const Vector3& b1,Vector3& pa,Vector3& pb)
 {
-  CollisionMeshQuery q(m1,m2);
-  bool res=q.WithinDistanceAll(outerMargin1+outerMargin2);
-  if(!res) {
+  Vector3 da=a1-a0,db=b1-b0,r=a0-b0;
+  Real aa=da.normSquared(),bb=db.normSquared(),f=db.dot(r);
+  Real s,t;
+  if(aa <= Epsilon && bb <= Epsilon) {
+    s = t = 0;
+  }
+  else if(aa <= Epsilon) {
+    s = 0;
+    t = Clamp(f/bb,0.0,1.0);
+  }
+  else {
+    Real c=da.dot(r);
+    if(bb <= Epsilon) {
+      t = 0;
+      s = Clamp(-c/aa,0.0,1.0);
+    }
+    else {
+      Real ab=da.dot(db);
+      Real denom=aa*bb-ab*ab;
+      if(denom > Epsilon) s = Clamp((ab*f-c*bb)/denom,0.0,1.0);
+      else s = 0;
+      t = (ab*s+f)/bb;
+      if(t < 0) {
+        t = 0;
+        s = Clamp(-c/aa,0.0,1.0);
+      }
+      else if(t > 1) {
+        t = 1;
+        s = Clamp((ab-c)/aa,0.0,1.0);
+      }
+    }
+  }
+  pa = a0 + s*da;
+  pb = b0 + t*db;
+  return pa.distance(pb);
+}
+
+//closest points between two triangles given in the same frame
+static Real TriangleTriangleClosestPoints(const Triangle3D& A,const Triangle3D& B,Vector3& pa,Vector3& pb)
+{
+  Segment3D s;
+  if(A.intersects(B,s)) {
+    pa = pb = s.a;
     return 0;
   }
+  //otherwise the closest points are vertex-face or edge-edge
+  Real dmin = Inf;
+  Vector3 qa,qb;
+  for(int i=0;i<3;i++) {
+    qa = A.closestPoint(B.vertex(i));
+    Real d = qa.distance(B.vertex(i));
+    if(d < dmin) { dmin = d; pa = qa; pb = B.vertex(i); }
+    qb = B.closestPoint(A.vertex(i));
+    d = qb.distance(A.vertex(i));
+    if(d < dmin) { dmin = d; pa = A.vertex(i); pb = qb; }
+  }
+  for(int i=0;i<3;i++) {
+    Segment3D ea = A.edge(i);
+    for(int j=0;j<3;j++) {
+      Segment3D eb = B.edge(j);
+      Real d = SegmentSegmentClosestPoints(ea.a,ea.b,eb.a,eb.b,qa,qb);
+      if(d < dmin) { dmin = d; pa = qa; pb = qb; }
+    }
+  }
+  return dmin;
+}
 
+//Does the job of CollisionMeshQuery::WithinDistanceAll/TolerancePairs/
+//TolerancePoints, but only runs the BVH query when the meshes have moved
+//by more than the slack since the last full query.  Full queries run at
+//tolerance tol+slack and keep the query's own TolerancePoints for the pairs
+//within tol, as the uncached path does.  The
+//distance between any two triangles changes by at most the displacement
+//of m2 relative to m1, which is bounded by |dt| + 2 sin(theta/2) *
+//radius2, so the cached candidate pairs are a superset of the pairs now
+//within tolerance.
+static bool CachedTolerancePairs(CollisionMesh& m1,CollisionMesh& m2,Real tol,CustomGeometryContactCache::MeshPair& cache,
+                                 vector<int>& t1,vector<int>& t2,vector<Vector3>& cp1,vector<Vector3>& cp2)
+{
+  RigidTransform T21; T21.mulInverseA(m1.currentTransform,m2.currentTransform);
+  bool valid = (cache.query != NULL && cache.tolerance == tol);
+  if(valid) {
+    Matrix3 dR; dR.mulTransposeA(cache.T21.R,T21.R);
+    Real motion = T21.t.distance(cache.T21.t) + Sqrt(Max(3.0-dR.trace(),0.0))*cache.radius2;
+    valid = (motion <= cache.slack);
+  }
+  if(!valid) {
+    if(cache.query == NULL) {
+      cache.query = new CollisionMeshQuery(m1,m2);
+      cache.radius2 = 0;
+      for(size_t i=0;i<m2.verts.size();i++)
+        cache.radius2 = Max(cache.radius2,m2.verts[i].norm());
+    }
+    cache.T21 = T21;
+    cache.tolerance = tol;
+    cache.slack = tol*gContactCacheSlackScale;
+    t1.resize(0);
+    t2.resize(0);
+    cp1.resize(0);
+    cp2.resize(0);
+    cache.t1.resize(0);
+    cache.t2.resize(0);
+    if(!cache.query->WithinDistanceAll(tol+cache.slack)) return false;
+    //one query gives both the candidates and, among them in the same order
+    //and with the same closest points, the pairs within tol
+    vector<Vector3> ccp1,ccp2;
+    cache.query->TolerancePairs(cache.t1,cache.t2);
+    cache.query->TolerancePoints(ccp1,ccp2);
+    for(size_t i=0;i<cache.t1.size();i++) {
+      if(ccp1[i].distance(T21*ccp2[i]) <= tol) {
+        t1.push_back(cache.t1[i]);
+        t2.push_back(cache.t2[i]);
+        cp1.push_back(ccp1[i]);
+        cp2.push_back(ccp2[i]);
+      }
+    }
+    return !t1.empty();
+  }
+
+  //re-validate the candidates
+  t1.resize(0);
+  t2.resize(0);
+  cp1.resize(0);
+  cp2.resize(0);
+  RigidTransform T12; T12.setInverse(T21);
+  Triangle3D tri1,tri2,tri2loc;
+  Vector3 p1,p2;
+  for(size_t i=0;i<cache.t1.size();i++) {
+    m1.GetTriangle(cache.t1[i],tri1);
+    m2.GetTriangle(cache.t2[i],tri2);
+    tri2loc.a = T21*tri2.a;
+    tri2loc.b = T21*tri2.b;
+    tri2loc.c = T21*tri2.c;
+    if(TriangleTriangleClosestPoints(tri1,tri2loc,p1,p2) <= tol) {
+      t1.push_back(cache.t1[i]);
+      t2.push_back(cache.t2[i]);
+      cp1.push_back(p1);
+      cp2.push_back(T12*p2);
+    }
+  }
+  return !t1.empty();
+}
+
+int MeshMeshCollide(CollisionMesh& m1,Real outerMargin1,CollisionMesh& m2,Real outerMargin2,dContactGeom* contact,int maxcontacts,bool& meshesIntersect,CustomGeometryContactCache* cache)
+{
   vector<int> t1,t2;
   vector<Vector3> cp1,cp2;
-  q.TolerancePairs(t1,t2);
-  q.TolerancePoints(cp1,cp2);
+  if(cache) {
+    if(&m1 < &m2) {
+      pair<const CollisionMesh*,const CollisionMesh*> key(&m1,&m2);
+      if(!CachedTolerancePairs(m1,m2,outerMargin1+outerMargin2,cache->meshPairs[key],t1,t2,cp1,cp2))
+        return 0;
+    }
+    else {
+      pair<const CollisionMesh*,const CollisionMesh*> key(&m2,&m1);
+      if(!CachedTolerancePairs(m2,m1,outerMargin1+outerMargin2,cache->meshPairs[key],t2,t1,cp2,cp1))
+        return 0;
+    }
+  }
+  else {
+    CollisionMeshQuery q(m1,m2);
+    bool res=q.WithinDistanceAll(outerMargin1+outerMargin2);
+    if(!res) {
+      return 0;
+    }
+    q.TolerancePairs(t1,t2);
+    q.TolerancePoints(cp1,cp2);
+  }
   //printf("%d Collision pairs\n",t1.size());
   const RigidTransform& T1 = m1.currentTransform;
   const RigidTransform& T2 = m2.currentTransform;
@@ -386,7 +553,7 @@ int MeshMeshCollide(CollisionMesh& m1,Real outerMargin1,CollisionMesh& m2,Real o
   }
 
   imax = t1.size();
-  static int warnedCount = 0;
+  static volatile int warnedCount = 0;
   for(size_t i=0;i<imax;i++) {
     m1.GetTriangle(t1[i],tri1);
     m2.GetTriangle(t2[i],tri2);
@@ -399,8 +566,8 @@ int MeshMeshCollide(CollisionMesh& m1,Real outerMargin1,CollisionMesh& m2,Real o
     tri2loc.c = T21*tri2.c;
     Segment3D s;
     if(tri2loc.intersects(tri1,s)) { 
-      gCustomGeometryMeshesIntersect = true;
-      if(warnedCount % 1000 == 0) {
+      meshesIntersect = true;
+      if(AtomicAdd(&warnedCount,1) % 1000 == 0) {
 	printf("ODECustomMesh: Triangles penetrate margin %g+%g: can't trust contact detector\n",outerMargin1,outerMargin2);
       }
       /*
@@ -413,7 +580,6 @@ int MeshMeshCollide(CollisionMesh& m1,Real outerMargin1,CollisionMesh& m2,Real o
       cout<<"  "<<tri2loc.b<<endl;
       cout<<"  "<<tri2loc.c<<endl;
       */
-      warnedCount++;
       /*
       //the two triangles intersect! can't trust results of PQP
       t1[i] = t1.back();
@@ -772,7 +938,7 @@ int PrimitiveGeometryCollide(GeometricPrimitive3D& g1,const RigidTransform& T, R
   return 0;
 }
 
-int MeshGeometryCollide(CollisionMesh& m1,Real outerMargin1,Geometry::AnyCollisionGeometry3D& g2,Real outerMargin2,dContactGeom* contact,int m)
+int MeshGeometryCollide(CollisionMesh& m1,Real outerMargin1,Geometry::AnyCollisionGeometry3D& g2,Real outerMargin2,dContactGeom* contact,int m,bool& meshesIntersect,CustomGeometryContactCache* cache)
 {
   switch(g2.type) {
   case AnyGeometry3D::Primitive:
@@ -782,7 +948,7 @@ int MeshGeometryCollide(CollisionMesh& m1,Real outerMargin1,Geometry::AnyCollisi
   case AnyGeometry3D::TriangleMesh:
     return MeshMeshCollide(m1,outerMargin1,
 			   g2.TriangleMeshCollisionData(),g2.margin+outerMargin2,
-			   contact,m);
+			   contact,m,meshesIntersect,cache);
   case AnyGeometry3D::PointCloud:
     return MeshPointCloudCollide(m1,outerMargin1,
 				 g2.PointCloudCollisionData(),g2.margin+outerMargin2,
@@ -796,7 +962,7 @@ int MeshGeometryCollide(CollisionMesh& m1,Real outerMargin1,Geometry::AnyCollisi
       vector<Geometry::AnyCollisionGeometry3D>& items = g2.GroupCollisionData();
       int n=0;
       for(size_t i=0;i<items.size();i++) {
-	n += MeshGeometryCollide(m1,outerMargin1,items[i],g2.margin+outerMargin2,contact+n,m-n);
+	n += MeshGeometryCollide(m1,outerMargin1,items[i],g2.margin+outerMargin2,contact+n,m-n,meshesIntersect,cache);
 	if(n >= m) return n;
       }
       return n;
@@ -809,7 +975,7 @@ int MeshGeometryCollide(CollisionMesh& m1,Real outerMargin1,Geometry::AnyCollisi
 //m is max number of contacts
 int GeometryGeometryCollide(Geometry::AnyCollisionGeometry3D& g1,Real outerMargin1,
 			    Geometry::AnyCollisionGeometry3D& g2,Real outerMargin2,
-			    dContactGeom* contact,int m)
+			    dContactGeom* contact,int m,bool& meshesIntersect,CustomGeometryContactCache* cache)
 {
   g1.InitCollisionData();
   g2.InitCollisionData();
@@ -817,7 +983,7 @@ int GeometryGeometryCollide(Geometry::AnyCollisionGeometry3D& g1,Real outerMargi
   case AnyGeometry3D::Primitive:
     return PrimitiveGeometryCollide(g1.AsPrimitive(),g1.PrimitiveCollisionData(),g1.margin+outerMargin1,g2,outerMargin2,contact,m);
   case AnyGeometry3D::TriangleMesh:
-    return MeshGeometryCollide(g1.TriangleMeshCollisionData(),g1.margin+outerMargin1,g2,outerMargin2,contact,m);
+    return MeshGeometryCollide(g1.TriangleMeshCollisionData(),g1.margin+outerMargin1,g2,outerMargin2,contact,m,meshesIntersect,cache);
   case AnyGeometry3D::PointCloud:
     switch(g2.type) {
     case AnyGeometry3D::Primitive:
@@ -863,7 +1029,7 @@ int GeometryGeometryCollide(Geometry::AnyCollisionGeometry3D& g1,Real outerMargi
       vector<Geometry::AnyCollisionGeometry3D>& items = g1.GroupCollisionData();
       int n=0;
       for(size_t i=0;i<items.size();i++) {
-	n += GeometryGeometryCollide(items[i],g1.margin+outerMargin1,g2,outerMargin2,contact+n,m-n);
+	n += GeometryGeometryCollide(items[i],g1.margin+outerMargin1,g2,outerMargin2,contact+n,m-n,meshesIntersect,cache);
 	if(n >= m) return n;
       }
       return n;
@@ -873,26 +1039,59 @@ int GeometryGeometryCollide(Geometry::AnyCollisionGeometry3D& g1,Real outerMargi
   return 0;
 }
 
+//set by dCustomGeometryCollide for dCollideMeshesIntersect
+static THREAD_LOCAL bool gCollideMeshesIntersect = false;
+
 int dCustomGeometryCollide (dGeomID o1, dGeomID o2, int flags,
 			   dContactGeom *contact, int skip)
 {
   int m = (flags&0xffff);
   if(m == 0) m=1;
   //printf("CustomGeometry collide\n");
+  dCustomGeometryUpdate(o1);
+  dCustomGeometryUpdate(o2);
+  bool meshesIntersect = false;
+  int n = dCustomGeometryCollideReentrant(o1,o2,m,contact,meshesIntersect);
+  if(meshesIntersect) gCollideMeshesIntersect = true;
+  return n;
+}
+
+int dCollideMeshesIntersect(dGeomID o1,dGeomID o2,int maxcontacts,dContactGeom* contact,bool& meshesIntersect)
+{
+  gCollideMeshesIntersect = false;
+  int n = dCollide(o1,o2,maxcontacts,contact,sizeof(dContactGeom));
+  meshesIntersect = gCollideMeshesIntersect;
+  return n;
+}
+
+bool dIsCustomGeometry(dGeomID o)
+{
+  return dGeomGetClass(o) == gdCustomGeometryClass;
+}
+
+void dCustomGeometryUpdate(dGeomID o)
+{
+  CustomGeometryData* d = dGetCustomGeometryData(o);
+  RigidTransform T;
+  CopyMatrix(T.R,dGeomGetRotation(o));
+  CopyVector(T.t,dGeomGetPosition(o));
+  T.t += T.R*d->odeOffset;
+  d->geometry->SetTransform(T);
+  d->geometry->InitCollisionData();
+  //the contact normal code builds mesh adjacency lazily, do it up front so
+  //that it's never built by two threads at once
+  if(d->geometry->type == AnyGeometry3D::TriangleMesh) {
+    CollisionMesh& m = d->geometry->TriangleMeshCollisionData();
+    if(m.incidentTris.empty()) m.CalcIncidentTris();
+    if(m.triNeighbors.empty()) m.CalcTriNeighbors();
+  }
+}
+
+int dCustomGeometryCollideReentrant(dGeomID o1,dGeomID o2,int maxcontacts,dContactGeom* contact,bool& meshesIntersect,CustomGeometryContactCache* cache)
+{
   CustomGeometryData* d1 = dGetCustomGeometryData(o1);
   CustomGeometryData* d2 = dGetCustomGeometryData(o2);
-  RigidTransform T1;
-  RigidTransform T2;
-  CopyMatrix(T1.R,dGeomGetRotation(o1));
-  CopyVector(T1.t,dGeomGetPosition(o1));
-  CopyMatrix(T2.R,dGeomGetRotation(o2));
-  CopyVector(T2.t,dGeomGetPosition(o2));
-  T1.t += T1.R*d1->odeOffset;
-  T2.t += T2.R*d2->odeOffset;
-  d1->geometry->SetTransform(T1);
-  d2->geometry->SetTransform(T2);
-
-  int n=GeometryGeometryCollide(*d1->geometry,d1->outerMargin,*d2->geometry,d2->outerMargin,contact,m);
+  int n=GeometryGeometryCollide(*d1->geometry,d1->outerMargin,*d2->geometry,d2->outerMargin,contact,maxcontacts,meshesIntersect,cache);
 
   for(int k=0;k<n;k++) {
     contact[k].g1 = o1;
@@ -946,12 +1145,3 @@ void InitODECustomGeometry()
   gdCustomGeometryClass = dCreateGeomClass(&mmclass);
 }
 
-bool GetCustomGeometryCollisionReliableFlag()
-{
-  return !gCustomGeometryMeshesIntersect;
-}
-
-void ClearCustomGeometryCollisionReliableFlag()
-{
-  gCustomGeometryMeshesIntersect = false;
-}
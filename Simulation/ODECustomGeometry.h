@@ -2,7 +2,11 @@
 #define ODE_CUSTOM_MESH_H
 
 #include <KrisLibrary/geometry/AnyGeometry.h>
+#include <KrisLibrary/geometry/CollisionMesh.h>
+#include <KrisLibrary/utils/SmartPointer.h>
 #include <ode/common.h>
+#include <ode/contact.h>
+#include <map>
 using namespace Geometry;
 
 struct CustomGeometryData
@@ -19,16 +23,64 @@ struct CustomGeometryData
   Vector3 odeOffset;
 };
 
+/** @brief Narrowphase state kept between steps for one pair of custom
+ * geometries, used to warm-start mesh-mesh contact detection.
+ *
+ * For each pair of meshes, a full BVH query gathers every triangle pair
+ * within the contact tolerance plus a slack distance.  Until the relative
+ * motion of the meshes exceeds the slack, no other triangle pair can come
+ * within tolerance, so only the cached pairs are re-checked.  Steps that
+ * run the full query return the same points as an uncached query.
+ *
+ * Mesh pairs are keyed by (lower,higher) address so that the cache hits
+ * regardless of the order in which the broadphase reports the pair.
+ */
+struct CustomGeometryContactCache
+{
+  struct MeshPair
+  {
+    MeshPair();
+
+    SmartPointer<CollisionMeshQuery> query;
+    ///Radius of the second mesh (the one with the higher address) about
+    ///its local origin
+    Real radius2;
+    ///Relative transform of the second mesh w.r.t. the first mesh, the
+    ///tolerance, and the slack at the last full query
+    RigidTransform T21;
+    Real tolerance,slack;
+    ///Candidate triangle pairs within tolerance+slack at the last full query
+    vector<int> t1,t2;
+  };
+
+  map<pair<const CollisionMesh*,const CollisionMesh*>,MeshPair> meshPairs;
+};
 
 dGeomID dCreateCustomGeometry(AnyCollisionGeometry3D* geom,Real outerMargin=0);
 CustomGeometryData* dGetCustomGeometryData(dGeomID o);
 void InitODECustomGeometry();
 
-///if the underlying meshes had a collision, the result is flagged as
-///unreliable in a global flag.
-bool GetCustomGeometryCollisionReliableFlag();
-///Resets the reliability flag to true
-void ClearCustomGeometryCollisionReliableFlag();
+///Returns true if o was created with dCreateCustomGeometry
+bool dIsCustomGeometry(dGeomID o);
+///Copies the current ODE transform of o into its collision geometry and
+///initializes its collision data.  Call this from a single thread before
+///o is used in dCustomGeometryCollideReentrant.
+void dCustomGeometryUpdate(dGeomID o);
+///A reentrant alternative to dCollide for two custom geometries that have
+///been prepared with dCustomGeometryUpdate.  If the underlying meshes
+///collide, the result is unreliable and meshesIntersect is set to true.
+///Several threads may call this at once as long as the geometries are not
+///moved in the meantime.  (Plain dCollide works too, but reports mesh
+///overlap only through dCollideMeshesIntersect.)
+///
+///If cache is non-NULL, it is used to warm-start mesh-mesh queries and
+///should be passed in again with the same pair on the next step.  A cache
+///may only be used by one thread at a time.
+int dCustomGeometryCollideReentrant(dGeomID o1,dGeomID o2,int maxcontacts,dContactGeom* contact,bool& meshesIntersect,CustomGeometryContactCache* cache=NULL);
+///Calls dCollide on any two geoms.  ODE's collider interface cannot return
+///extra results, so if it dispatches to the custom geometry collider, the
+///mesh overlap is passed back through a thread-local flag.
+int dCollideMeshesIntersect(dGeomID o1,dGeomID o2,int maxcontacts,dContactGeom* contact,bool& meshesIntersect);
 
 #endif
 
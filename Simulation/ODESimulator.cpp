@@ -2,6 +2,8 @@
 #include "ODECommon.h"
 #include "ODECustomGeometry.h"
 #include "Settings.h"
+#include "Modeling/ParallelFor.h"
+#include "Modeling/Atomic.h"
 #include <list>
 #include <fstream>
 //#include "Geometry/Clusterize.h"
@@ -13,6 +15,7 @@
 #include <ode/ode.h>
 #include <KrisLibrary/Timer.h>
 #include <KrisLibrary/myfile.h>
+#include <KrisLibrary/utils/threadutils.h>
 #ifndef WIN32
 #include <unistd.h>
 #endif //WIN32
@@ -22,28 +25,14 @@
 
 const static size_t gMaxKMeansSize = 5000;
 const static size_t gMaxHClusterSize = 2000;
-static size_t gPreclusterContacts = 0;
-static double gClusterTime = 0;
-static double gContactDetectTime = 0;
 
 //if at the beginning of the timestep, the two objects are touching with depth d in the boundary layer
 //of size m, but after the timestep, they are penetrating the boundary layer, the sim will roll back
 //until the new depth d' gives a remaining margin of (m-d') >= c*(m-d) where c<1 is this fraction.
 const static double gRollbackPenetrationFraction = 0.5;  
 
-//stuff for contact detection callbacks
-struct ODEContactResult
-{
-  dGeomID o1,o2;
-  vector<dContactGeom> contacts;
-  vector<dJointFeedback> feedback;
-  bool meshOverlap;
-};
-
+//maximum number of raw contacts detected between a pair of geometries
 const static int max_contacts = 1000;
-static dContactGeom gContactTemp[max_contacts];
-static list<ODEContactResult> gContacts;
-static vector<ODEContactResult*> gContactsVector;
 
 
 //Method for identifying objects via dGeomSetData/dGeomGetData
@@ -151,6 +140,8 @@ ODESimulatorSettings::ODESimulatorSettings()
 
   maxContacts = 20;
   clusterNormalScale = 0.1;
+  numCollisionThreads = 1;
+  contactCaching = gContactCachingEnabled;
 
   errorReductionParameter = 0.95;
   dampedLeastSquaresParameter = 1e-6;
@@ -177,8 +168,13 @@ inline Real CFMFromSpring(Real timestep,Real kP,Real kD)
 struct ODEObject 
 {
   bool gODEInitialized;
-  ODEObject () : gODEInitialized(false) {}
+  bool threadSafe;
+  //simulators may be created on several threads at once, e.g., by
+  //RolloutEngine
+  Mutex mutex;
+  ODEObject () : gODEInitialized(false),threadSafe(false) {}
   void Init() {
+    ScopedLock lock(mutex);
     if(!gODEInitialized) {
       #ifdef dDOUBLE
       if(dCheckConfiguration("ODE_double_precision")!=1) {
@@ -190,6 +186,12 @@ struct ODEObject
       }
       #endif
 
+      //stepping simulators on several threads needs ODE's collision caches
+      //to be per-thread
+      threadSafe = (dCheckConfiguration("ODE_EXT_mt_collisions")==1);
+      if(!threadSafe)
+        printf("ODESimulator: Warning, ODE is not configured with --enable-ou, simulations will be stepped on a single thread\n");
+
       printf("Initializing ODE...\n");
       dInitODE();
       InitODECustomGeometry();
@@ -206,6 +208,17 @@ struct ODEObject
 
 ODEObject g_ODE_object;
 
+bool ODEThreadSafe()
+{
+  g_ODE_object.Init();
+  return g_ODE_object.threadSafe;
+}
+
+void ODEParallelForBody::BeginThread(int thread)
+{
+  dAllocateODEDataForThread(dAllocateMaskAll);
+}
+
 
 
 
@@ -216,6 +229,8 @@ ODESimulator::ODESimulator()
   simTime = 0;
   timestep = 0;
   lastStateTimestep = 0;
+  numPreclusterContacts = 0;
+  contactDetectTime = clusterTime = 0;
 
   g_ODE_object.Init();
   worldID = dWorldCreate();
@@ -353,7 +368,7 @@ void GetCurrentCollisionStatus(ODESimulator* sim,
 {
   marginsRemaining.clear();
   concernedObjects.resize(0);
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
+  for(list<ODEContactResult>::iterator i=sim->contactResults.begin();i!=sim->contactResults.end();i++) {
     CollisionPair collpair(GeomDataToObjectID(dGeomGetData(i->o1)),GeomDataToObjectID(dGeomGetData(i->o2)));
     if(collpair.second < collpair.first) 
       swap(collpair.first,collpair.second);
@@ -436,7 +451,7 @@ bool ODESimulator::CheckObjectOverlap(vector<pair<ODEObjectID,ODEObjectID> >& ov
 {
   DetectCollisions();
   overlaps.resize(0);
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
+  for(list<ODEContactResult>::iterator i=contactResults.begin();i!=contactResults.end();i++) {
     CollisionPair collpair(GeomDataToObjectID(dGeomGetData(i->o1)),GeomDataToObjectID(dGeomGetData(i->o2)));
     if(collpair.second < collpair.first) 
       swap(collpair.first,collpair.second);
@@ -460,8 +475,8 @@ void ODESimulator::Step(Real dt)
 #if DO_TIMING
   Timer timer;
   double collisionTime,stepTime,updateTime;
-  gContactDetectTime = gClusterTime = 0;
-  gPreclusterContacts = 0;
+  contactDetectTime = clusterTime = 0;
+  numPreclusterContacts = 0;
 #endif // DO_TIMING
 
   Status status = StatusNormal;
@@ -555,7 +570,7 @@ void ODESimulator::Step(Real dt)
             }
           }
         }
-  		  if(rollback && !lastState.IsOpen()) {
+  		  if(rollback && lastState.empty()) {
           printf("ODESimulation: Rollback rejected because last state not saved\n");
           //getchar();
           rollback = false;
@@ -583,8 +598,7 @@ void ODESimulator::Step(Real dt)
           Assert(temp.IsOpen());
           WriteState(temp);
           
-          lastState.Seek(0,FILESEEKSTART);
-          ReadState_Internal(lastState);
+          ReadBodyState(&lastState[0]);
           printf("STARTING CONFIGURATION:\n");
           PrintStatus(this,concernedObjects,"Concerned objects originally","had");
           DetectCollisions();
@@ -624,8 +638,7 @@ void ODESimulator::Step(Real dt)
           
           didRollback = true;
           didAnyRollback = true;
-          lastState.Seek(0,FILESEEKSTART);
-          ReadState_Internal(lastState);
+          ReadBodyState(&lastState[0]);
           timestep *= 0.5;
 
           //PrintStatus(this,concernedObjects,"Backed up colliding objects","to previous");
@@ -645,11 +658,8 @@ void ODESimulator::Step(Real dt)
   		  }
   		  else {
           //accept prior step
-          lastState.Close();
-          bool res = lastState.OpenData(FILEREAD | FILEWRITE);
-          Assert(res);
-          Assert(lastState.IsOpen());
-          WriteState_Internal(lastState);
+          lastState.resize(BodyStateSize());
+          if(!lastState.empty()) WriteBodyState(&lastState[0]);
           for(size_t i=0;i<concernedObjects.size();i++) {
             if(marginsRemaining.count(concernedObjects[i]) == 0) {
               printf("ODESimulation: collision %s - %s erased entirely\n",ObjectName(concernedObjects[i].first).c_str(),ObjectName(concernedObjects[i].second).c_str());
@@ -702,7 +712,7 @@ void ODESimulator::Step(Real dt)
   		//determine whether to rollback
   		bool rollback = false;
   		map<CollisionPair,double> marginsRemaining;
-  		for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
+  		for(list<ODEContactResult>::iterator i=contactResults.begin();i!=contactResults.end();i++) {
   		  CollisionPair collpair(GeomDataToObjectID(dGeomGetData(i->o1)),GeomDataToObjectID(dGeomGetData(i->o2)));
   		  if(i->meshOverlap) { 
   		    rollback = true;
@@ -737,10 +747,8 @@ void ODESimulator::Step(Real dt)
   		}
       
   		//save state
-  		lastState.Close();
-  		bool res = lastState.OpenData(FILEREAD | FILEWRITE);
-  		Assert(lastState.IsOpen());
-  		WriteState_Internal(lastState);
+  		lastState.resize(BodyStateSize());
+  		if(!lastState.empty()) WriteBodyState(&lastState[0]);
   		lastMarginsRemaining = marginsRemaining;
   	}
     //do the prospective time step for the next call
@@ -756,7 +764,7 @@ void ODESimulator::Step(Real dt)
     DetectCollisions();
     SetupContactResponse();
 
-  //printf("  %d contacts detected\n",gContacts.size());
+  //printf("  %d contacts detected\n",contactResults.size());
 
 #if DO_TIMING
     collisionTime = timer.ElapsedTime();
@@ -771,7 +779,7 @@ void ODESimulator::Step(Real dt)
     timer.Reset();
 #endif // DO_TIMING
 
-    for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
+    for(list<ODEContactResult>::iterator i=contactResults.begin();i!=contactResults.end();i++) {
       if(i->meshOverlap) 
         status = StatusContactUnreliable;
     }
@@ -789,8 +797,8 @@ void ODESimulator::Step(Real dt)
     cl.penetrating = false;
     for(size_t j=0;j<cl.feedbackIndices.size();j++) {
       int k=cl.feedbackIndices[j];
-      Assert(k >= 0 && k < (int)gContactsVector.size());
-      ODEContactResult* cres = gContactsVector[k];
+      Assert(k >= 0 && k < (int)contactResultsVector.size());
+      ODEContactResult* cres = contactResultsVector[k];
       if(cres->meshOverlap) cl.penetrating = true;
       Vector3 temp;
       for(size_t i=0;i<cres->feedback.size();i++) {
@@ -821,13 +829,13 @@ void ODESimulator::Step(Real dt)
     out<<"total,#preclusterContacts,#contacts,collision detection,contact detect,clustering,dynamics step,misc update"<<endl;
   }
   size_t nc = 0;
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++)
+  for(list<ODEContactResult>::iterator i=contactResults.begin();i!=contactResults.end();i++)
     nc += i->contacts.size();
-  out<<collisionTime+stepTime+updateTime<<","<<gPreclusterContacts<<","<<nc<<","<<collisionTime<<","<<gContactDetectTime<<","<<gClusterTime<<","<<stepTime<<","<<updateTime<<endl;
+  out<<collisionTime+stepTime+updateTime<<","<<numPreclusterContacts<<","<<nc<<","<<collisionTime<<","<<contactDetectTime<<","<<clusterTime<<","<<stepTime<<","<<updateTime<<endl;
 #endif
 
-  //KH: commented this out so GetContacts() would work for ContactSensor simulation.  Be careful about loading state
-  //gContacts.clear();
+  //KH: commented this out so GetBodyContacts() would work for ContactSensor simulation.  Be careful about loading state
+  //contactResults.clear();
 }
 
 
@@ -1110,8 +1118,6 @@ bool depthGreater(const dContactGeom& a,const dContactGeom& b)
 
 void ClusterContacts(vector<dContactGeom>& contacts,int maxClusters,Real clusterNormalScale)
 {
-  gPreclusterContacts += contacts.size();
-
   //for really big contact sets, do a subsampling
   if(contacts.size()*maxClusters > gMaxKMeansSize && contacts.size()*contacts.size() > gMaxHClusterSize) {
     int minsize = Max((int)gMaxKMeansSize/maxClusters,(int)Sqrt(Real(gMaxHClusterSize)));
@@ -1170,8 +1176,26 @@ void MergeContacts(vector<dContactGeom>& contacts,double posTolerance,double ori
   swap(contacts,res);
 }
 
+//A group of candidate geometry pairs found by one broadphase call in
+//DetectCollisions.  The narrowphase runs on each pair independently
+//(possibly in parallel) and then the group's contacts are clustered
+//together, in the same order as a serial pass would produce them.
+struct ODECollisionGroup
+{
+  ODECollisionGroup() : robot(NULL),aggregateCount(true),numPreclusterContacts(0) {}
+
+  ODERobot* robot;                        //for self collisions, the robot
+  bool aggregateCount;                    //passed on to ProcessContacts
+  vector<pair<dGeomID,dGeomID> > pairs;   //candidate pairs, in broadphase order
+  vector<ODEContactResult> results;       //narrowphase output for each pair
+  vector<char> hasResult;                 //whether results[i] should be reported
+  list<ODEContactResult> contacts;        //clustered output
+  size_t numPreclusterContacts;
+};
+
 void collisionCallback(void *data, dGeomID o1, dGeomID o2)
 {
+  ODECollisionGroup* group = reinterpret_cast<ODECollisionGroup*>(data);
   Assert(!dGeomIsSpace(o1) && !dGeomIsSpace(o2));
 
   dBodyID b1 = dGeomGetBody(o1);
@@ -1184,53 +1208,14 @@ void collisionCallback(void *data, dGeomID o1, dGeomID o2)
     return; // b2 is disabled and collides with no-body
   if( b1 && b2 && !dBodyIsEnabled(b1) && !dBodyIsEnabled(b2) )
    return; // both b1 and b2 are disabled
-  
-  ClearCustomGeometryCollisionReliableFlag();
-  int num = dCollide (o1,o2,max_contacts,gContactTemp,sizeof(dContactGeom));
-  vector<dContactGeom> vcontact(num);
-  int numOk = 0;
-  for(int i=0;i<num;i++) {
-    if(gContactTemp[i].g1 == o2 && gContactTemp[i].g2 == o1) {
-      printf("Swapping contact\n");
-      std::swap(gContactTemp[i].g1,gContactTemp[i].g2);
-      for(int k=0;k<3;k++) gContactTemp[i].normal[k]*=-1.0;
-      std::swap(gContactTemp[i].side1,gContactTemp[i].side2);
-    }
-    Assert(gContactTemp[i].g1 == o1);
-    Assert(gContactTemp[i].g2 == o2);
-    vcontact[numOk] = gContactTemp[i];
-    const dReal* n=vcontact[numOk].normal;
-    if(Sqr(n[0])+Sqr(n[1])+Sqr(n[2]) < 0.9 || Sqr(n[0])+Sqr(n[1])+Sqr(n[2]) > 1.2) {
-      //GIMPACT will report this
-      //printf("Warning, degenerate contact with normal %f %f %f\n",vcontact[numOk].normal[0],vcontact[numOk].normal[1],vcontact[numOk].normal[2]);
-      continue;
-    }
-    numOk++;
-  }
-  vcontact.resize(numOk);
-  
-  if(vcontact.size() > 0) {
-    gContacts.push_back(ODEContactResult());
-    gContacts.back().o1 = o1;
-    gContacts.back().o2 = o2;
-    swap(gContacts.back().contacts,vcontact);
-    gContacts.back().meshOverlap = !GetCustomGeometryCollisionReliableFlag();
-  }
-  else {
-    if(!GetCustomGeometryCollisionReliableFlag()) {
-      printf("collision callback: meshes overlapped, but no contacts were generated?\n");
-      gContacts.push_back(ODEContactResult());
-      gContacts.back().o1 = o1;
-      gContacts.back().o2 = o2;
-      swap(gContacts.back().contacts,vcontact);
-      gContacts.back().meshOverlap = !GetCustomGeometryCollisionReliableFlag();
-    }
-  }
+
+  group->pairs.push_back(pair<dGeomID,dGeomID>(o1,o2));
 }
 
 void selfCollisionCallback(void *data, dGeomID o1, dGeomID o2)
 {
-  ODERobot* robot = reinterpret_cast<ODERobot*>(data);
+  ODECollisionGroup* group = reinterpret_cast<ODECollisionGroup*>(data);
+  ODERobot* robot = group->robot;
   Assert(!dGeomIsSpace(o1) && !dGeomIsSpace(o2));
   int link1 = GeomDataToRobotLinkIndex(dGeomGetData(o1));
   int link2 = GeomDataToRobotLinkIndex(dGeomGetData(o2));
@@ -1239,49 +1224,84 @@ void selfCollisionCallback(void *data, dGeomID o1, dGeomID o2)
   if(robot->robot.selfCollisions(link1,link2)==NULL && robot->robot.selfCollisions(link2,link1)==NULL) {
     return;
   }
-  
-  ClearCustomGeometryCollisionReliableFlag();
-  int num = dCollide (o1,o2,max_contacts,gContactTemp,sizeof(dContactGeom));
+
+  group->pairs.push_back(pair<dGeomID,dGeomID>(o1,o2));
+}
+
+//Converts the num raw contacts in buffer between o1 and o2 into res.
+//Returns false if nothing should be reported for this pair.
+bool MakeContactResult(dGeomID o1,dGeomID o2,dContactGeom* buffer,int num,bool meshOverlap,bool selfCollision,ODEContactResult& res)
+{
   vector<dContactGeom> vcontact(num);
   int numOk = 0;
   for(int i=0;i<num;i++) {
-    if(gContactTemp[i].g1 == o2 && gContactTemp[i].g2 == o1) {
-      printf("Swapping contact... shouldn't be here?\n");
-      std::swap(gContactTemp[i].g1,gContactTemp[i].g2);
-      for(int k=0;k<3;k++) gContactTemp[i].normal[k]*=-1.0;
-      std::swap(gContactTemp[i].side1,gContactTemp[i].side2);
+    if(buffer[i].g1 == o2 && buffer[i].g2 == o1) {
+      if(selfCollision) printf("Swapping contact... shouldn't be here?\n");
+      else printf("Swapping contact\n");
+      std::swap(buffer[i].g1,buffer[i].g2);
+      for(int k=0;k<3;k++) buffer[i].normal[k]*=-1.0;
+      std::swap(buffer[i].side1,buffer[i].side2);
     }
-    Assert(gContactTemp[i].g1 == o1);
-    Assert(gContactTemp[i].g2 == o2);
-    vcontact[numOk] = gContactTemp[i];
+    Assert(buffer[i].g1 == o1);
+    Assert(buffer[i].g2 == o2);
+    vcontact[numOk] = buffer[i];
     const dReal* n=vcontact[numOk].normal;
     if(Sqr(n[0])+Sqr(n[1])+Sqr(n[2]) < 0.9 || Sqr(n[0])+Sqr(n[1])+Sqr(n[2]) > 1.2) {
+      if(!selfCollision) {
+        //GIMPACT will report this
+        //printf("Warning, degenerate contact with normal %f %f %f\n",vcontact[numOk].normal[0],vcontact[numOk].normal[1],vcontact[numOk].normal[2]);
+        continue;
+      }
       printf("Warning, degenerate contact with normal %f %f %f\n",vcontact[numOk].normal[0],vcontact[numOk].normal[1],vcontact[numOk].normal[2]);
-      //continue;
     }
     numOk++;
   }
   //TEMP: printing self collisions
-  //if(numOk > 0) printf("%d self collision contacts between links %d and %d\n",numOk,(int)link1,(int)link2);
+  //if(selfCollision && numOk > 0) printf("%d self collision contacts between links %d and %d\n",numOk,GeomDataToRobotLinkIndex(dGeomGetData(o1)),GeomDataToRobotLinkIndex(dGeomGetData(o2)));
   vcontact.resize(numOk);
-  
-  if(kMergeContacts && numOk > 0) {
+
+  if(selfCollision && kMergeContacts && numOk > 0) {
     MergeContacts(vcontact,kContactPosMergeTolerance,kContactOriMergeTolerance);
   }
 
-  if(vcontact.size() > 0) {
-    if(numOk != (int)vcontact.size())
-    	//// The int type is not guaranteed to be big enough, use intptr_t
-		//cout<<numOk<<" contacts between env "<<(int)dGeomGetData(o2)<<" and body "<<(int)dGeomGetData(o1)<<"  (clustered to "<<vcontact.size()<<")"<<endl;
-      cout<<numOk<<" contacts between link "<<GeomDataToRobotLinkIndex(dGeomGetData(o2))<<" and link "<<GeomDataToRobotLinkIndex(dGeomGetData(o1))<<"  (clustered to "<<vcontact.size()<<")"<<endl;
-    gContacts.push_back(ODEContactResult());
-    gContacts.back().o1 = o1;
-    gContacts.back().o2 = o2;
-    swap(gContacts.back().contacts,vcontact);
-    gContacts.back().meshOverlap = !GetCustomGeometryCollisionReliableFlag();
+  if(vcontact.empty()) {
+    if(selfCollision || !meshOverlap) return false;
+    printf("collision callback: meshes overlapped, but no contacts were generated?\n");
   }
+  res.o1 = o1;
+  res.o2 = o2;
+  swap(res.contacts,vcontact);
+  res.meshOverlap = meshOverlap;
+  return true;
 }
 
+//Runs the narrowphase on candidate pairs of custom geometries.  Each worker
+//writes into its own contact buffer and each pair into its own result slot,
+//so no locking is needed.
+struct ODENarrowphaseBody : public ParallelForBody
+{
+  ODENarrowphaseBody(vector<ODECollisionGroup>& _groups,vector<vector<dContactGeom> >& _buffers)
+    :groups(_groups),buffers(_buffers)
+  {}
+  virtual void Run(int index,int thread)
+  {
+    ODECollisionGroup& group = groups[items[index].first];
+    int k = items[index].second;
+    dGeomID o1 = group.pairs[k].first;
+    dGeomID o2 = group.pairs[k].second;
+    vector<dContactGeom>& buffer = buffers[thread];
+    if(buffer.empty()) buffer.resize(max_contacts);
+    bool meshesIntersect = false;
+    int num = dCustomGeometryCollideReentrant(o1,o2,max_contacts,&buffer[0],meshesIntersect,caches[index]);
+    group.hasResult[k] = MakeContactResult(o1,o2,&buffer[0],num,meshesIntersect,group.robot!=NULL,group.results[k]);
+  }
+
+  vector<ODECollisionGroup>& groups;
+  vector<pair<int,int> > items;   //(group, pair) indices
+  vector<CustomGeometryContactCache*> caches;  //NULL if caching is off
+  vector<vector<dContactGeom> >& buffers;
+};
+
 void ProcessContacts(list<ODEContactResult>::iterator start,list<ODEContactResult>::iterator end,const ODESimulatorSettings& settings,bool aggregateCount=true)
 {
   if(kMergeContacts) {
@@ -1289,7 +1309,8 @@ void ProcessContacts(list<ODEContactResult>::iterator start,list<ODEContactResul
       MergeContacts(j->contacts,kContactPosMergeTolerance,kContactOriMergeTolerance);
   }
 
-  static bool warnedContacts = false;
+  //called from the parallel contact clustering
+  static volatile int warnedContacts = 0;
   if(aggregateCount) {
     int numContacts = 0;
     for(list<ODEContactResult>::iterator j=start;j!=end;j++) 
@@ -1297,11 +1318,10 @@ void ProcessContacts(list<ODEContactResult>::iterator start,list<ODEContactResul
     if(numContacts > settings.maxContacts) {
       //printf("Warning: %d robot-env contacts > maximum %d, may crash\n",numContacts,settings.maxContacts);
       if(settings.maxContacts > 50) {
-	if(!warnedContacts) {
+	if(AtomicExchange(&warnedContacts,1) == 0) {
 	  printf("Max contacts > 50, may crash.  Press enter to continue...\n");
 	  //getchar();
 	}
-	warnedContacts = true;
       }
       Real scale = Real(settings.maxContacts)/numContacts;
       for(list<ODEContactResult>::iterator j=start;j!=end;j++) {
@@ -1314,11 +1334,10 @@ void ProcessContacts(list<ODEContactResult>::iterator start,list<ODEContactResul
   else {
     for(list<ODEContactResult>::iterator j=start;j!=end;j++) {
       if(settings.maxContacts > 50) {
-	if(!warnedContacts) {
+	if(AtomicExchange(&warnedContacts,1) == 0) {
 	  printf("Max contacts > 50, may crash.  Press enter to continue...\n");
 	  //getchar();
 	}
-	warnedContacts = true;
       }
       for(list<ODEContactResult>::iterator j=start;j!=end;j++) {
 	ClusterContacts(j->contacts,settings.maxContacts,settings.clusterNormalScale);
@@ -1392,9 +1411,9 @@ void ODESimulator::SetupContactResponse()
   dJointGroupEmpty(contactGroupID);
 
   int index=0;
-  gContactsVector.resize(gContacts.size());
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
-    gContactsVector[index] = &(*i);
+  contactResultsVector.resize(contactResults.size());
+  for(list<ODEContactResult>::iterator i=contactResults.begin();i!=contactResults.end();i++) {
+    contactResultsVector[index] = &(*i);
     SetupContactResponse(GeomDataToObjectID(dGeomGetData(i->o1)),GeomDataToObjectID(dGeomGetData(i->o2)),index,*i);
     index++;
   }
@@ -1466,11 +1485,37 @@ void ODESimulator::SetupContactResponse(const ODEObjectID& a,const ODEObjectID&
       if(reverse)
 	cl->points[k+start].n.inplaceNegative();
     }
-    Assert(feedbackIndex >= 0 && feedbackIndex < (int)gContacts.size());
+    Assert(feedbackIndex >= 0 && feedbackIndex < (int)contactResults.size());
     cl->feedbackIndices.push_back(feedbackIndex);
   }
 }
 
+//Gathers each group's narrowphase results and clusters them
+struct ODEClusterBody : public ParallelForBody
+{
+  ODEClusterBody(vector<ODECollisionGroup>& _groups,const ODESimulatorSettings& _settings)
+    :groups(_groups),settings(_settings)
+  {}
+  virtual void Run(int index,int thread)
+  {
+    ODECollisionGroup& group = groups[index];
+    for(size_t k=0;k<group.pairs.size();k++) {
+      if(!group.hasResult[k]) continue;
+      group.contacts.push_back(ODEContactResult());
+      ODEContactResult& res = group.contacts.back();
+      res.o1 = group.results[k].o1;
+      res.o2 = group.results[k].o2;
+      res.meshOverlap = group.results[k].meshOverlap;
+      swap(res.contacts,group.results[k].contacts);
+      group.numPreclusterContacts += res.contacts.size();
+    }
+    ProcessContacts(group.contacts.begin(),group.contacts.end(),settings,group.aggregateCount);
+  }
+
+  vector<ODECollisionGroup>& groups;
+  const ODESimulatorSettings& settings;
+};
+
 void dCustomGeometryAABB(dGeomID o,dReal aabb[6]);
 
 void ODESimulator::DetectCollisions()
@@ -1479,109 +1524,102 @@ void ODESimulator::DetectCollisions()
   Timer timer;
 #endif //DO_TIMING
 
-  gContacts.clear();
-  gContactsVector.resize(0);
+  contactResults.clear();
+  contactResultsVector.resize(0);
 
-  CollisionPair cindex;
-  int jcount=0;
+  //broadphase: collect candidate pairs, one group per space-space query in
+  //the order that they should be clustered
+  vector<ODECollisionGroup> groups;
+  groups.reserve(1+robots.size()*(robots.size()+2));
   if(settings.rigidObjectCollisions) {
     //call the collision routine between objects and the world
-    dSpaceCollide(envSpaceID,(void*)this,collisionCallback);
-
-#if DO_TIMING
-    gContactDetectTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
-    
-    ProcessContacts(gContacts.begin(),gContacts.end(),settings,false);
-
-#if DO_TIMING
-    gClusterTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
+    groups.resize(groups.size()+1);
+    groups.back().aggregateCount = false;
+    dSpaceCollide(envSpaceID,(void*)&groups.back(),collisionCallback);
   }
-
-  //do robot-environment collisions
   for(size_t i=0;i<robots.size();i++) {
-#if DO_TIMING
-    timer.Reset();
-#endif //DO_TIMING
-
     //call the collision routine between the robot and the world
-    bool gContactsEmpty = gContacts.empty();
-    list<ODEContactResult>::iterator gContactStart;
-    if(!gContactsEmpty) gContactStart = --gContacts.end();
-    dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)envSpaceID,(void*)this,collisionCallback);
-    if(!gContactsEmpty) ++gContactStart;
-    else gContactStart = gContacts.begin();
-
-#if DO_TIMING
-    gContactDetectTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
-
-    ProcessContacts(gContactStart,gContacts.end(),settings);
-
-#if DO_TIMING
-    gClusterTime += timer.ElapsedTime();
-    timer.Reset();
-#endif //DO_TIMING
+    groups.resize(groups.size()+1);
+    dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)envSpaceID,(void*)&groups.back(),collisionCallback);
 
     if(settings.robotSelfCollisions) {
       robots[i]->EnableSelfCollisions(true);
-
-#if DO_TIMING
-      timer.Reset();
-#endif
-
-      gContactsEmpty = gContacts.empty();
-      if(!gContactsEmpty) gContactStart = --gContacts.end();
       //call the self collision routine for the robot
-      dSpaceCollide(robots[i]->space(),(void*)robots[i],selfCollisionCallback);
-      if(!gContactsEmpty) ++gContactStart;
-      else gContactStart = gContacts.begin();
-
-#if DO_TIMING
-      gContactDetectTime += timer.ElapsedTime();
-      timer.Reset();
-#endif //DO_TIMING
-      
-      ProcessContacts(gContactStart,gContacts.end(),settings);
-
-#if DO_TIMING
-      gClusterTime += timer.ElapsedTime();
-      timer.Reset();
-#endif //DO_TIMING
+      groups.resize(groups.size()+1);
+      groups.back().robot = robots[i];
+      dSpaceCollide(robots[i]->space(),(void*)&groups.back(),selfCollisionCallback);
     }
 
     if(settings.robotRobotCollisions) {    
       for(size_t k=i+1;k<robots.size();k++) {
-	cindex.second = ODEObjectID(1,k);
-
-#if DO_TIMING
-    timer.Reset();
-#endif //DO_TIMING
+        groups.resize(groups.size()+1);
+        dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)robots[k]->space(),(void*)&groups.back(),collisionCallback);
+      }
+    }
+  }
 
-	gContactsEmpty = gContacts.empty();
-	if(!gContactsEmpty) gContactStart = --gContacts.end();
-	dSpaceCollide2((dxGeom *)robots[i]->space(),(dxGeom *)robots[k]->space(),(void*)this,collisionCallback);
-	if(!gContactsEmpty) ++gContactStart;
-	else gContactStart = gContacts.begin();
+  //narrowphase: custom geometries are farmed out to the worker threads,
+  //while ODE's built-in colliders are not reentrant and are run here
+  int numThreads = ResolveNumThreads(settings.numCollisionThreads);
+  if((int)contactBuffers.size() < numThreads)
+    contactBuffers.resize(numThreads);
+  if(contactBuffers[0].empty()) contactBuffers[0].resize(max_contacts);
+  ODENarrowphaseBody narrowphase(groups,contactBuffers);
+  //caches are carried over for pairs that are still in the broadphase and
+  //dropped for the rest.  Map nodes don't move, so the pointers handed to
+  //the workers stay valid
+  map<pair<dGeomID,dGeomID>,CustomGeometryContactCache> newCache;
+  for(size_t i=0;i<groups.size();i++) {
+    ODECollisionGroup& group = groups[i];
+    group.results.resize(group.pairs.size());
+    group.hasResult.resize(group.pairs.size(),0);
+    for(size_t k=0;k<group.pairs.size();k++) {
+      dGeomID o1 = group.pairs[k].first;
+      dGeomID o2 = group.pairs[k].second;
+      if(dIsCustomGeometry(o1) && dIsCustomGeometry(o2)) {
+        dCustomGeometryUpdate(o1);
+        dCustomGeometryUpdate(o2);
+        narrowphase.items.push_back(pair<int,int>((int)i,(int)k));
+        if(settings.contactCaching) {
+          //the broadphase may report the pair in either order
+          pair<dGeomID,dGeomID> key(Min(o1,o2),Max(o1,o2));
+          CustomGeometryContactCache& cache = newCache[key];
+          map<pair<dGeomID,dGeomID>,CustomGeometryContactCache>::iterator prev = contactCache.find(key);
+          if(prev != contactCache.end()) cache.meshPairs.swap(prev->second.meshPairs);
+          narrowphase.caches.push_back(&cache);
+        }
+        else
+          narrowphase.caches.push_back(NULL);
+      }
+      else {
+        dContactGeom* buffer = &contactBuffers[0][0];
+        bool meshesIntersect = false;
+        int num = dCollideMeshesIntersect(o1,o2,max_contacts,buffer,meshesIntersect);
+        group.hasResult[k] = MakeContactResult(o1,o2,buffer,num,meshesIntersect,group.robot!=NULL,group.results[k]);
+      }
+    }
+  }
+  contactCache.swap(newCache);
+  ParallelFor((int)narrowphase.items.size(),narrowphase,numThreads);
 
 #if DO_TIMING
-    gContactDetectTime += timer.ElapsedTime();
-    timer.Reset();
+  contactDetectTime += timer.ElapsedTime();
+  timer.Reset();
 #endif //DO_TIMING
 
-	ProcessContacts(gContactStart,gContacts.end(),settings);
+  //cluster each group, then merge in group order so that the contact
+  //ordering (and hence the dynamics) does not depend on the thread count
+  ODEClusterBody cluster(groups,settings);
+  ParallelFor((int)groups.size(),cluster,numThreads);
+  for(size_t i=0;i<groups.size();i++) {
+    numPreclusterContacts += groups[i].numPreclusterContacts;
+    contactResults.splice(contactResults.end(),groups[i].contacts);
+  }
 
 #if DO_TIMING
-    gClusterTime += timer.ElapsedTime();
-    timer.Reset();
+  clusterTime += timer.ElapsedTime();
+  timer.Reset();
 #endif //DO_TIMING
-      }
-    }
-  }
 }
 
 void ODESimulator::EnableContactFeedback(const ODEObjectID& a,const ODEObjectID& b)
@@ -1626,13 +1664,12 @@ bool HasContact(dBodyID a)
   return false;
 }
 
-///Will produce bogus o1 and o2 vectors
-void GetContacts(dBodyID a,vector<ODEContactList>& contacts)
+void ODESimulator::GetBodyContacts(dBodyID a,vector<ODEContactList>& contacts) const
 {
   if(a == 0) return;
 
   contacts.resize(0);
-  for(list<ODEContactResult>::iterator i=gContacts.begin();i!=gContacts.end();i++) {
+  for(list<ODEContactResult>::const_iterator i=contactResults.begin();i!=contactResults.end();i++) {
     if(a == dGeomGetBody(i->o1) || a == dGeomGetBody(i->o2)) {
       dBodyID b = dGeomGetBody(i->o2);
       bool reverse = false;
@@ -1933,3 +1970,100 @@ bool ODESimulator::WriteState_Internal(File& f) const
     if(!objects[i]->WriteState(f)) return false;
   return true;
 }
+
+//number of dReals per body in the fixed-layout state
+const static int kBodyStateSize = 19;
+
+static void WriteBodyArray(dBodyID body,dReal* x)
+{
+  const dReal* pos=dBodyGetPosition(body);
+  const dReal* q=dBodyGetQuaternion(body);
+  const dReal* w=dBodyGetAngularVel(body);
+  const dReal* v=dBodyGetLinearVel(body);
+  const dReal* frc=dBodyGetForce(body);
+  const dReal* trq=dBodyGetTorque(body);
+  for(int k=0;k<3;k++) x[k] = pos[k];
+  for(int k=0;k<4;k++) x[3+k] = q[k];
+  for(int k=0;k<3;k++) x[7+k] = w[k];
+  for(int k=0;k<3;k++) x[10+k] = v[k];
+  for(int k=0;k<3;k++) x[13+k] = frc[k];
+  for(int k=0;k<3;k++) x[16+k] = trq[k];
+}
+
+static void ReadBodyArray(dBodyID body,const dReal* x)
+{
+  dBodySetPosition(body,x[0],x[1],x[2]);
+  dBodySetQuaternion(body,x+3);
+  dBodySetAngularVel(body,x[7],x[8],x[9]);
+  dBodySetLinearVel(body,x[10],x[11],x[12]);
+  dBodySetForce(body,x[13],x[14],x[15]);
+  dBodySetTorque(body,x[16],x[17],x[18]);
+}
+
+int ODESimulator::BodyStateSize() const
+{
+  int n = 0;
+  for(size_t i=0;i<robots.size();i++) 
+    for(size_t j=0;j<robots[i]->robot.links.size();j++)
+      if(robots[i]->body(j) != NULL) n++;
+  n += (int)objects.size();
+  return n*kBodyStateSize;
+}
+
+void ODESimulator::WriteBodyState(dReal* data) const
+{
+  for(size_t i=0;i<robots.size();i++) 
+    for(size_t j=0;j<robots[i]->robot.links.size();j++) {
+      dBodyID body = robots[i]->body(j);
+      if(body == NULL) continue;
+      WriteBodyArray(body,data);
+      data += kBodyStateSize;
+    }
+  for(size_t i=0;i<objects.size();i++) {
+    WriteBodyArray(objects[i]->body(),data);
+    data += kBodyStateSize;
+  }
+}
+
+void ODESimulator::ReadBodyState(const dReal* data)
+{
+  for(size_t i=0;i<robots.size();i++) 
+    for(size_t j=0;j<robots[i]->robot.links.size();j++) {
+      dBodyID body = robots[i]->body(j);
+      if(body == NULL) continue;
+      ReadBodyArray(body,data);
+      data += kBodyStateSize;
+    }
+  for(size_t i=0;i<objects.size();i++) {
+    ReadBodyArray(objects[i]->body(),data);
+    data += kBodyStateSize;
+  }
+  ClearContactFeedback();
+}
+
+int ODESimulator::BinaryStateSize() const
+{
+  return 3+BodyStateSize();
+}
+
+void ODESimulator::WriteBinaryState(dReal* data) const
+{
+  data[0] = simTime;
+  data[1] = lastStateTimestep;
+  data[2] = (dReal)GetStatus();
+  WriteBodyState(data+3);
+}
+
+void ODESimulator::ReadBinaryState(const dReal* data)
+{
+  simTime = data[0];
+  lastStateTimestep = data[1];
+  int status = (int)data[2];
+  ReadBodyState(data+3);
+
+  //same as ReadState
+  energies.clear();
+  lastMarginsRemaining.clear();
+  statusHistory.clear();
+  statusHistory.push_back(pair<Status,Real>((Status)status,simTime));
+}
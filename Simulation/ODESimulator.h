@@ -4,15 +4,29 @@
 #include "ODERobot.h"
 #include "ODERigidObject.h"
 #include "ODESurface.h"
+#include "ODECustomGeometry.h"
 #include "Modeling/Terrain.h"
 #include "Modeling/RigidObject.h"
+#include "Modeling/ParallelFor.h"
 #include <KrisLibrary/robotics/Contact.h>
 #include <ode/contact.h>
 #include <map>
+#include <list>
 
 struct ODEObjectID;
 struct ODEContactList;
-struct ODEContactResult;
+
+/** @ingroup Simulation
+ * @brief The raw contacts detected between two ODE geometries on the
+ * current step.  Used internally by ODESimulator.
+ */
+struct ODEContactResult
+{
+  dGeomID o1,o2;
+  vector<dContactGeom> contacts;
+  vector<dJointFeedback> feedback;
+  bool meshOverlap;
+};
 
 /** @ingroup Simulation
  * @brief Global simulator settings.
@@ -51,6 +65,18 @@ struct ODESimulatorSettings
   ///uses this weight to scale distances in normal space.  Distance in position
   ///space have weight 1. (default 0.1)
   double clusterNormalScale;
+  ///Number of threads used for narrowphase collision detection and contact
+  ///clustering.  1 runs serially, <= 0 uses all hardware threads.  Results
+  ///do not depend on this value. (default 1)
+  int numCollisionThreads;
+  ///If true, mesh-mesh narrowphase queries are cached between steps, and
+  ///only triangle pairs near the previous contacts are re-checked while
+  ///bodies move less than the contact tolerance.  Speeds up scenes with
+  ///many resting contacts.  Steps that reuse the cache compute each
+  ///triangle pair's closest points directly, which may pick different
+  ///(equally close) points than the full query for parallel faces, so
+  ///this is off by default. (default false)
+  bool contactCaching;
 
   //ODE constants, mostly relevant to tightness of robot constraints
   ///ODE's global ERP parameter
@@ -83,12 +109,20 @@ struct ODESimulatorSettings
  * StepDynamics() integrates the dynamics without setting up collision
  * detection structures.  This probably should not be used externally.
  *
- * Read/WriteState can be used to serialize state to binary.
+ * Read/WriteState can be used to serialize state to binary.  The
+ * Read/WriteBinaryState functions give a cheaper fixed-layout alternative
+ * that neither encodes nor allocates.
  *
  * To get contact force information from the simulator, use the
  * EnableContactFeedback() function to initialize feedback, and then call
  * GetContactFeedback() to get a pointer to the feedback data structure.
  * Contact forces are updated after Step().
+ *
+ * All collision detection state is stored per simulator, so separate
+ * ODESimulators may be stepped on separate threads if ODEThreadSafe()
+ * returns true.  Each thread that calls into ODE must first call
+ * dAllocateODEDataForThread(); ODEParallelForBody does this for ParallelFor
+ * workers.
  */
 class ODESimulator
 {
@@ -125,6 +159,16 @@ class ODESimulator
   void StepDynamics(Real dt);
   bool ReadState(File& f);
   bool WriteState(File& f) const;
+  ///Number of dReals in the fixed-layout state written by WriteBinaryState.
+  ///Depends only on the number of robot links and objects.
+  int BinaryStateSize() const;
+  ///Copies the state into a fixed-layout array of BinaryStateSize() dReals:
+  ///the simulation time, last time step, and status, followed by the
+  ///position, quaternion, angular velocity, linear velocity, force, and
+  ///torque of each robot link body and then each rigid object body.
+  void WriteBinaryState(dReal* data) const;
+  ///Restores a state written by WriteBinaryState
+  void ReadBinaryState(const dReal* data);
 
   size_t numTerrains() const { return terrains.size(); }
   size_t numRobots() const { return robots.size(); }
@@ -141,6 +185,9 @@ class ODESimulator
   void EnableContactFeedback(const ODEObjectID& a,const ODEObjectID& b);
   ODEContactList* GetContactFeedback(const ODEObjectID& a,const ODEObjectID& b);
   void GetContactFeedback(const ODEObjectID& a,vector<ODEContactList*>& contacts);
+  ///Returns all contacts on body a detected on the last step, whether or not
+  ///feedback is enabled.  Will produce bogus o1 and o2 vectors.
+  void GetBodyContacts(dBodyID a,vector<ODEContactList>& contacts) const;
   void ClearContactFeedback();
   bool InContact(const ODEObjectID& a) const;
   bool InContact(const ODEObjectID& a,const ODEObjectID& b) const;
@@ -152,6 +199,9 @@ class ODESimulator
   //used internally
   bool ReadState_Internal(File& f);
   bool WriteState_Internal(File& f) const;
+  int BodyStateSize() const;
+  void ReadBodyState(const dReal* data);
+  void WriteBodyState(dReal* data) const;
   void DetectCollisions();
   void SetupContactResponse(); 
   void SetupContactResponse(const ODEObjectID& a,const ODEObjectID& b,int feedbackIndex,ODEContactResult& c);
@@ -177,13 +227,44 @@ class ODESimulator
   map<ODEObjectID,Real> energies;
 
 public:
-  //for adaptive time stepping
-  File lastState;
+  //collision detection results for the current step, used internally
+  list<ODEContactResult> contactResults;
+  vector<ODEContactResult*> contactResultsVector;
+  //per-thread contact buffers for DetectCollisions
+  vector<vector<dContactGeom> > contactBuffers;
+  //narrowphase caches for the geometry pairs found by the last broadphase
+  map<pair<dGeomID,dGeomID>,CustomGeometryContactCache> contactCache;
+  //timing statistics, only filled out if DO_TIMING is enabled
+  size_t numPreclusterContacts;
+  double contactDetectTime,clusterTime;
+
+  //for adaptive time stepping, the body state at the start of the last
+  //accepted step (see WriteBodyState)
+  vector<dReal> lastState;
   Real lastStateTimestep;
   map<pair<ODEObjectID,ODEObjectID>,double> lastMarginsRemaining;
 };
 
 
+///Returns true if ODE was configured with --enable-ou, which keeps its
+///collision caches per thread.  Otherwise separate ODESimulators must not be
+///stepped concurrently.
+bool ODEThreadSafe();
+
+/** @ingroup Simulation
+ * @brief A ParallelForBody whose items call into ODE.
+ *
+ * ODE's per-thread data must be allocated on each thread before its first
+ * ODE call.  BeginThread() does so on every worker; ParallelFor's workers
+ * are pool threads, so the data is allocated once per thread and reused by
+ * later calls.
+ */
+class ODEParallelForBody : public ParallelForBody
+{
+ public:
+  virtual void BeginThread(int thread);
+};
+
 /** @ingroup Simulation
  * @brief An index that identifies some ODE object in the world.
  * Environments, robots, robot bodies, or rigid objects are supported.
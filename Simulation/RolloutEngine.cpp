@@ -0,0 +1,202 @@
+#include "RolloutEngine.h"
+#include "IO/XmlODE.h"
+#include "Modeling/ParallelFor.h"
+
+//Gives geom its own copy of its geometry and appearance, so that it can be
+//moved and collided independently of the geometry it was copied from
+static void MakeGeometryUnique(ManagedGeometry& geom)
+{
+  if(!geom) return;
+  ManagedGeometry::GeometryPtr src = geom;
+  ManagedGeometry::AppearancePtr app = geom.Appearance();
+  ManagedGeometry::GeometryPtr dst = geom.CreateEmpty();
+  *dst = *src;
+  if(app) {
+    *geom.Appearance() = *app;
+    geom.Appearance()->geom = dst;
+  }
+}
+
+//Copies a into b, including the geometries, which CopyWorld shares
+static void CopyWorldGeometry(const RobotWorld& a,RobotWorld& b)
+{
+  CopyWorld(a,b);
+  for(size_t i=0;i<b.robots.size();i++) {
+    Robot& robot = *b.robots[i];
+    for(size_t j=0;j<robot.geometry.size();j++) {
+      if(j < robot.geomManagers.size() && robot.geomManagers[j]) {
+        MakeGeometryUnique(robot.geomManagers[j]);
+        robot.geometry[j] = robot.geomManagers[j];
+      }
+      else if(robot.geometry[j])
+        robot.geometry[j] = new Geometry::AnyCollisionGeometry3D(*robot.geometry[j]);
+    }
+  }
+  for(size_t i=0;i<b.rigidObjects.size();i++)
+    MakeGeometryUnique(b.rigidObjects[i]->geometry);
+  for(size_t i=0;i<b.terrains.size();i++)
+    MakeGeometryUnique(b.terrains[i]->geometry);
+}
+
+void RolloutEngine::Worker::Init(const RobotWorld& initialWorld)
+{
+  CopyWorldGeometry(initialWorld,world);
+  //the snapshots share this world's geometries
+  robots.resize(world.robots.size());
+  for(size_t i=0;i<world.robots.size();i++)
+    robots[i] = *world.robots[i];
+  rigidObjects.resize(world.rigidObjects.size());
+  for(size_t i=0;i<world.rigidObjects.size();i++)
+    rigidObjects[i] = *world.rigidObjects[i];
+  terrains.resize(world.terrains.size());
+  for(size_t i=0;i<world.terrains.size();i++)
+    terrains[i] = *world.terrains[i];
+}
+
+void RolloutEngine::Worker::ResetWorld()
+{
+  for(size_t i=0;i<world.robots.size();i++) {
+    *world.robots[i] = robots[i];
+    world.robots[i]->UpdateGeometry();
+  }
+  for(size_t i=0;i<world.rigidObjects.size();i++) {
+    *world.rigidObjects[i] = rigidObjects[i];
+    world.rigidObjects[i]->UpdateGeometry();
+  }
+  for(size_t i=0;i<world.terrains.size();i++)
+    *world.terrains[i] = terrains[i];
+  world.InvalidateBVH();
+}
+
+struct RolloutBody : public ODEParallelForBody
+{
+  RolloutBody(RolloutEngine& _engine,RolloutTask& _task)
+    :engine(_engine),task(_task)
+  {}
+  virtual void Run(int index,int thread)
+  {
+    RolloutEngine::Worker& worker = *engine.workers[thread];
+    worker.ResetWorld();
+    RobotWorld& world = worker.world;
+
+    WorldSimulation sim;
+    sim.Init(&world);
+    sim.robotControllers.resize(world.robots.size());
+    for(size_t i=0;i<world.robots.size();i++) {
+      sim.SetController(i,MakeDefaultController(world.robots[i]));
+      sim.controlSimulators[i].sensors.MakeDefault(world.robots[i]);
+    }
+    TiXmlElement* e = (engine.worldFile.empty() ? NULL : engine.xmlWorld.GetElement("simulation"));
+    if(e) {
+      XmlSimulationSettings s(e);
+      if(!s.GetSettings(sim))
+        fprintf(stderr,"RolloutEngine: warning, simulation settings not read correctly\n");
+    }
+    //the rollouts are the unit of parallelism
+    sim.odesim.GetSettings().numCollisionThreads = 1;
+    sim.sensorScheduler.numThreads = 1;
+
+    RandomStream rng(engine.seeds[index]);
+    sim.SeedSensorNoise(rng.RandInt64());
+    task.Setup(index,rng,sim);
+
+    int worst = ODESimulator::StatusNormal;
+    while(sim.time < engine.duration) {
+      sim.Advance(engine.dt);
+      if(sim.worstStatus > worst) worst = sim.worstStatus;
+      if(task.Done(index,sim)) break;
+    }
+    sim.UpdateModel();
+    task.Evaluate(index,sim,engine.metrics[index]);
+    engine.endTimes[index] = sim.time;
+    engine.statuses[index] = worst;
+  }
+
+  RolloutEngine& engine;
+  RolloutTask& task;
+};
+
+RolloutEngine::RolloutEngine()
+  :duration(1.0),dt(0.01),baseSeed(0),numThreads(0)
+{}
+
+bool RolloutEngine::Init(const char* _worldFile)
+{
+  worldFile = _worldFile;
+  workers.resize(0);
+  initialWorld = new RobotWorld;
+  if(!xmlWorld.Load(worldFile)) {
+    fprintf(stderr,"RolloutEngine: error loading world file %s\n",worldFile.c_str());
+    worldFile.clear();
+    initialWorld = NULL;
+    return false;
+  }
+  if(!xmlWorld.GetWorld(*initialWorld)) {
+    fprintf(stderr,"RolloutEngine: error loading world from %s\n",worldFile.c_str());
+    worldFile.clear();
+    initialWorld = NULL;
+    return false;
+  }
+  return true;
+}
+
+void RolloutEngine::Init(const RobotWorld& world)
+{
+  worldFile.clear();
+  workers.resize(0);
+  initialWorld = new RobotWorld;
+  CopyWorldGeometry(world,*initialWorld);
+}
+
+bool RolloutEngine::Run(RolloutTask& task,int numRollouts)
+{
+  if(!initialWorld) {
+    fprintf(stderr,"RolloutEngine: Init was not called\n");
+    return false;
+  }
+  int threads = (ODEThreadSafe() ? ResolveNumThreads(numThreads) : 1);
+  if(threads > numRollouts) threads = numRollouts;
+  //the world copies are made serially, since they touch the geometry cache
+  for(int i=(int)workers.size();i<threads;i++) {
+    workers.push_back(new Worker);
+    workers.back()->Init(*initialWorld);
+  }
+
+  task.MetricNames(metricNames);
+  seeds.resize(numRollouts);
+  for(int i=0;i<numRollouts;i++)
+    seeds[i] = baseSeed + (unsigned long long)i;
+  metrics.resize(numRollouts);
+  for(int i=0;i<numRollouts;i++)
+    metrics[i].resize(0);
+  endTimes.resize(numRollouts);
+  statuses.resize(numRollouts);
+
+  RolloutBody body(*this,task);
+  ParallelFor(numRollouts,body,threads);
+
+  size_t numMetrics = metricNames.size();
+  for(int i=0;i<numRollouts;i++)
+    if(metrics[i].size() > numMetrics) numMetrics = metrics[i].size();
+  stats.resize(numMetrics);
+  for(size_t j=0;j<numMetrics;j++)
+    stats[j].clear();
+  for(int i=0;i<numRollouts;i++)
+    for(size_t j=0;j<metrics[i].size();j++)
+      stats[j].collect(metrics[i][j]);
+  return true;
+}
+
+void RolloutEngine::PrintStats(FILE* out) const
+{
+  fprintf(out,"%d rollouts:\n",(int)metrics.size());
+  for(size_t j=0;j<stats.size();j++) {
+    string name = (j < metricNames.size() ? metricNames[j] : string("metric"));
+    fprintf(out,"  %s: mean %g, std %g, min %g, max %g\n",name.c_str(),stats[j].mean(),Sqrt(stats[j].variance()),stats[j].minimum(),stats[j].maximum());
+  }
+  int numUnstable = 0;
+  for(size_t i=0;i<statuses.size();i++)
+    if(statuses[i] != ODESimulator::StatusNormal) numUnstable++;
+  if(numUnstable > 0)
+    fprintf(out,"  %d rollouts had an abnormal simulation status\n",numUnstable);
+}
@@ -0,0 +1,107 @@
+#ifndef ROLLOUT_ENGINE_H
+#define ROLLOUT_ENGINE_H
+
+#include "WorldSimulation.h"
+#include "IO/XmlWorld.h"
+#include "Modeling/RandomStream.h"
+#include <KrisLibrary/utils/StatCollector.h>
+#include <vector>
+#include <string>
+#include <stdio.h>
+using namespace std;
+
+/** @ingroup Simulation
+ * @brief The user-defined part of a Monte Carlo rollout (see RolloutEngine).
+ *
+ * A single task object is shared by all of the engine's threads, so these
+ * methods must only modify the simulation they are given, and should draw
+ * random numbers only from the given rng.
+ */
+class RolloutTask
+{
+ public:
+  virtual ~RolloutTask() {}
+  ///Returns the names of the metrics produced by Evaluate
+  virtual void MetricNames(vector<string>& names) const { names.resize(0); }
+  ///Randomizes the initial state, controllers, and parameters of a
+  ///rollout.  sim has just been initialized from a fresh copy of the world
+  ///with the default controllers and sensors.
+  virtual void Setup(int index,RandomStream& rng,WorldSimulation& sim) {}
+  ///Called after each time step.  Return true to end the rollout early.
+  virtual bool Done(int index,WorldSimulation& sim) { return false; }
+  ///Computes the metrics of the rollout at its end
+  virtual void Evaluate(int index,WorldSimulation& sim,vector<double>& metrics) = 0;
+};
+
+/** @ingroup Simulation
+ * @brief Runs many simulations of a world under randomized conditions, in
+ * parallel.
+ *
+ * Each thread simulates its own copy of the world, including its own copies
+ * of the geometries, so no model state is shared between threads.  Before
+ * every rollout, the robots, rigid objects, and terrains of the thread's
+ * world are restored from a snapshot of the initial world, so changes that
+ * a task makes to the models (e.g., masses, joint limits, or friction) do
+ * not carry over to later rollouts.  Geometry data that is edited in place
+ * is not restored.
+ *
+ * Every rollout starts from a new WorldSimulation on the restored world,
+ * and rollout i is seeded with baseSeed+i.  That seed drives both the
+ * task's rng and the sensor noise (WorldSimulation::SeedSensorNoise), and
+ * the simulation's own threads are disabled.  A rollout's results thus
+ * depend only on its seed, and are bit-for-bit the same regardless of
+ * numThreads or which thread ran it.
+ *
+ * Results are stored by rollout index.  The per-metric statistics are
+ * accumulated in rollout order after all rollouts finish, so they are
+ * reproducible too.
+ */
+class RolloutEngine
+{
+ public:
+  RolloutEngine();
+  ///Loads the world file (including any simulation settings) to simulate
+  bool Init(const char* worldFile);
+  ///Sets the world to simulate, with the default simulation settings.  The
+  ///world is copied, so it may be changed or destroyed afterwards.
+  void Init(const RobotWorld& world);
+  ///Runs numRollouts rollouts of the task.  Returns false if Init has not
+  ///been called.
+  bool Run(RolloutTask& task,int numRollouts);
+  ///Prints the mean, standard deviation, min, and max of each metric
+  void PrintStats(FILE* out=stdout) const;
+
+  //settings
+  string worldFile;         ///< the file given to Init, or empty
+  Real duration;            ///< simulated duration of each rollout
+  Real dt;                  ///< time step of each WorldSimulation::Advance call
+  unsigned long long baseSeed;
+  int numThreads;           ///< <= 0 uses all hardware threads
+
+  //results, indexed by rollout
+  vector<string> metricNames;
+  vector<unsigned long long> seeds;
+  vector<vector<double> > metrics;
+  vector<Real> endTimes;    ///< the simulation time at which each rollout ended
+  vector<int> statuses;     ///< the worst ODESimulator::Status of each rollout
+  ///Statistics of each metric over all rollouts
+  vector<StatCollector> stats;
+
+  //internal: the world copy owned by each thread, and the snapshot of its
+  //initial state
+  struct Worker
+  {
+    void Init(const RobotWorld& world);
+    void ResetWorld();
+
+    RobotWorld world;
+    vector<Robot> robots;
+    vector<RigidObject> rigidObjects;
+    vector<Terrain> terrains;
+  };
+  XmlWorld xmlWorld;        ///< holds the simulation settings if loaded from a file
+  SmartPointer<RobotWorld> initialWorld;
+  vector<SmartPointer<Worker> > workers;
+};
+
+#endif
@@ -0,0 +1,113 @@
+#include "SensorScheduler.h"
+#include "WorldSimulation.h"
+#include "Modeling/ParallelFor.h"
+#include <KrisLibrary/Timer.h>
+
+//Simulates a due sensor and records the time it took in item.cost
+static void SimulateItem(WorldSimulation* sim,SensorScheduler::Item& item,bool concurrent)
+{
+  ControlledRobotSimulator* robot = &sim->controlSimulators[item.robot];
+  SensorBase* sensor = robot->sensors.sensors[item.sensor];
+  Timer timer;
+  if(sensor->UsesWorldModel()) sensor->SimulateUpdated(robot,sim,concurrent);
+  else sensor->Simulate(robot,sim);
+  item.cost = timer.ElapsedTime();
+}
+
+struct SensorSimulateBody : public ParallelForBody
+{
+  SensorSimulateBody(WorldSimulation* _sim,vector<SensorScheduler::Item>& _items,const vector<int>& _indices,bool _concurrent)
+    :sim(_sim),items(_items),indices(_indices),concurrent(_concurrent)
+  {}
+  virtual void Run(int index,int thread)
+  {
+    //each item is written by one thread only, so no lock is needed
+    SimulateItem(sim,items[indices[index]],concurrent);
+  }
+
+  WorldSimulation* sim;
+  vector<SensorScheduler::Item>& items;
+  const vector<int>& indices;
+  bool concurrent;
+};
+
+SensorScheduler::SensorScheduler()
+  :numThreads(0)
+{}
+
+void SensorScheduler::Step(Real dt,WorldSimulation* sim)
+{
+  items.resize(0);
+  parallelItems.resize(0);
+  costs.resize(sim->controlSimulators.size());
+  bool useWorldModel = false;
+  for(size_t i=0;i<sim->controlSimulators.size();i++) {
+    ControlledRobotSimulator& robot = sim->controlSimulators[i];
+    costs[i].resize(robot.sensors.sensors.size());
+    for(size_t j=0;j<robot.sensors.sensors.size();j++) {
+      Item item;
+      item.robot = (int)i;
+      item.sensor = (int)j;
+      item.cost = 0;
+      if(!robot.SensorDue(j,dt,item.delay)) continue;
+      SensorBase* sensor = robot.sensors.sensors[j];
+      if(sensor->UsesWorldModel()) useWorldModel = true;
+      item.threadSafe = sensor->IsThreadSafe();
+      if(item.threadSafe) parallelItems.push_back((int)items.size());
+      items.push_back(item);
+    }
+  }
+  if(items.empty()) return;
+
+  if(useWorldModel) {
+    sim->UpdateModel();
+    for(size_t k=0;k<items.size();k++) {
+      ControlledRobotSimulator* robot = &sim->controlSimulators[items[k].robot];
+      SensorBase* sensor = robot->sensors.sensors[items[k].sensor];
+      if(sensor->UsesWorldModel()) sensor->PrepareWorldModel(robot,sim);
+    }
+    //the simulation has moved everything since the last sub-step
+    sim->world->UpdateBVH();
+  }
+
+  //the thread safe sensors go first...
+  int threads = Min(ResolveNumThreads(numThreads),(int)parallelItems.size());
+  SensorSimulateBody parallelBody(sim,items,parallelItems,threads > 1);
+  ParallelFor((int)parallelItems.size(),parallelBody,threads);
+  //...then the rest run, and the thread safe ones are finished, in robot
+  //and sensor order, so that noise is drawn in the same order for any
+  //number of threads
+  for(size_t k=0;k<items.size();k++) {
+    Item& item = items[k];
+    ControlledRobotSimulator* robot = &sim->controlSimulators[item.robot];
+    SensorBase* sensor = robot->sensors.sensors[item.sensor];
+    if(!item.threadSafe) SimulateItem(sim,item,false);
+    if(sensor->UsesWorldModel()) {
+      Timer timer;
+      sensor->FinishSimulate(robot,sim);
+      item.cost += timer.ElapsedTime();
+    }
+    costs[item.robot][item.sensor].collect(item.cost);
+  }
+
+  for(size_t k=0;k<items.size();k++)
+    sim->controlSimulators[items[k].robot].AdvanceSensor(items[k].sensor,items[k].delay);
+}
+
+void SensorScheduler::ClearStats()
+{
+  for(size_t i=0;i<costs.size();i++)
+    for(size_t j=0;j<costs[i].size();j++)
+      costs[i][j].clear();
+}
+
+void SensorScheduler::PrintStats(WorldSimulation* sim,FILE* out) const
+{
+  fprintf(out,"Sensor simulation times:\n");
+  for(size_t i=0;i<costs.size();i++) {
+    for(size_t j=0;j<costs[i].size();j++) {
+      if(costs[i][j].number() == 0) continue;
+      fprintf(out,"  %s %s: %d calls, mean %gs, max %gs\n",sim->world->robots[i]->name.c_str(),sim->controlSimulators[i].sensors.sensors[j]->name.c_str(),(int)costs[i][j].number(),costs[i][j].mean(),costs[i][j].maximum());
+    }
+  }
+}
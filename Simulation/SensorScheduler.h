@@ -0,0 +1,59 @@
+#ifndef SENSOR_SCHEDULER_H
+#define SENSOR_SCHEDULER_H
+
+#include <KrisLibrary/math/math.h>
+#include <KrisLibrary/utils/StatCollector.h>
+#include <vector>
+#include <stdio.h>
+using namespace std;
+using namespace Math;
+
+class WorldSimulation;
+
+/** @ingroup Simulation
+ * @brief Simulates the sensors of all robots in a WorldSimulation, used by
+ * WorldSimulation::Advance.
+ *
+ * On each sub-step, the sensors that are due are collected across all
+ * robots.  If any of them reads the world model (see
+ * SensorBase::UsesWorldModel), the world model and its BVH are updated
+ * once for all of them, rather than once per visual sensor.  Sensors that
+ * are thread safe then run concurrently on up to numThreads threads (<= 0
+ * uses all hardware threads); while they do, each is told not to start
+ * threads of its own.  Afterwards, in robot and sensor order, the other
+ * sensors run and the thread safe ones are finished
+ * (SensorBase::FinishSimulate).  Sensor noise is only drawn in this serial
+ * pass, so it is drawn in a fixed order for any number of threads.  It
+ * comes from the simulation's sensorNoise stream if it was seeded
+ * (WorldSimulation::SeedSensorNoise) and from the global random number
+ * generator otherwise.
+ *
+ * The time spent simulating each sensor is collected in costs, indexed by
+ * robot and sensor.
+ */
+class SensorScheduler
+{
+ public:
+  SensorScheduler();
+  ///Simulates the due sensors for a sub-step of length dt
+  void Step(Real dt,WorldSimulation* sim);
+  void ClearStats();
+  ///Prints the mean and maximum time spent in each sensor
+  void PrintStats(WorldSimulation* sim,FILE* out=stdout) const;
+
+  struct Item
+  {
+    int robot,sensor;
+    Real delay;
+    bool threadSafe;
+    Real cost;
+  };
+
+  int numThreads;
+  vector<vector<StatCollector> > costs;
+  //scratch space: the due sensors, and the indices of the thread safe ones
+  vector<Item> items;
+  vector<int> parallelItems;
+};
+
+#endif
@@ -23,5 +23,6 @@ const static bool gRigidObjectCollisionsEnabled = true;
 const static bool gRobotSelfCollisionsEnabled = false;
 const static bool gRobotRobotCollisionsEnabled = true;
 const static bool gAdaptiveTimeStepping = true;
+const static bool gContactCachingEnabled = false;
 
 #endif
@@ -0,0 +1,129 @@
+#include "SimulationLogger.h"
+#include <KrisLibrary/math3d/rotation.h>
+#include <KrisLibrary/utils/AnyCollection.h>
+#include <sstream>
+
+string SimulationLogMetadata(RobotWorld& world,const char* type)
+{
+  AnyCollection c;
+  c["type"] = string(type);
+  AnyCollection names;
+  names.resize(world.NumIDs());
+  for(int i=0;i<world.NumIDs();i++)
+    names[i] = world.GetName(i);
+  c["names"] = names;
+  stringstream ss;
+  c.write(ss);
+  return ss.str();
+}
+
+SimulationStateLogger::SimulationStateLogger(WorldSimulation& _sim)
+  :sim(_sim)
+{}
+
+bool SimulationStateLogger::Open(const char* fn)
+{
+  RobotWorld* world = sim.world;
+  vector<string> names;
+  names.push_back("time");
+  sensorSizes.resize(world->robots.size());
+  for(size_t i=0;i<world->robots.size();i++) {
+    Robot* robot = world->robots[i];
+    names.push_back(robot->name+"_cmx");
+    names.push_back(robot->name+"_cmy");
+    names.push_back(robot->name+"_cmz");
+    for(size_t j=0;j<robot->links.size();j++)
+      names.push_back(robot->name+"_q["+robot->linkNames[j]+"]");
+    for(size_t j=0;j<robot->links.size();j++)
+      names.push_back(robot->name+"_dq["+robot->linkNames[j]+"]");
+    for(size_t j=0;j<robot->drivers.size();j++)
+      names.push_back(robot->name+"_t["+robot->linkNames[robot->drivers[j].linkIndices[0]]+"]");
+    RobotSensors& sensors = sim.controlSimulators[i].sensors;
+    sensorSizes[i].resize(sensors.sensors.size());
+    for(size_t j=0;j<sensors.sensors.size();j++) {
+      SensorBase* s = sensors.sensors[j];
+      vector<string> mnames;
+      s->MeasurementNames(mnames);
+      sensorSizes[i][j] = (int)mnames.size();
+      for(size_t k=0;k<mnames.size();k++)
+        names.push_back(robot->name+"_"+s->name+"["+mnames[k]+"]");
+    }
+  }
+  const char* objectColumns[12] = {"x","y","z","rz","ry","rx","dx","dy","dz","wz","wy","wx"};
+  for(size_t i=0;i<world->rigidObjects.size();i++)
+    for(int k=0;k<12;k++)
+      names.push_back(world->rigidObjects[i]->name+"_"+objectColumns[k]);
+  row.reserve(names.size());
+  return writer.Open(fn,names,SimulationLogMetadata(*world,"state"));
+}
+
+void SimulationStateLogger::Log()
+{
+  if(!writer.IsOpen()) return;
+  RobotWorld* world = sim.world;
+  row.resize(0);
+  row.push_back(sim.time);
+  Config q,dq;
+  Vector t;
+  vector<double> ms;
+  for(size_t i=0;i<world->robots.size();i++) {
+    sim.UpdateRobot(i);
+    Vector3 com = world->robots[i]->GetCOM();
+    row.push_back(com.x);
+    row.push_back(com.y);
+    row.push_back(com.z);
+    sim.controlSimulators[i].GetSimulatedConfig(q);
+    sim.controlSimulators[i].GetSimulatedVelocity(dq);
+    sim.controlSimulators[i].GetActuatorTorques(t);
+    for(int j=0;j<q.n;j++) row.push_back(q[j]);
+    for(int j=0;j<dq.n;j++) row.push_back(dq[j]);
+    for(int j=0;j<t.n;j++) row.push_back(t[j]);
+    RobotSensors& sensors = sim.controlSimulators[i].sensors;
+    for(size_t j=0;j<sensors.sensors.size();j++) {
+      sensors.sensors[j]->GetMeasurements(ms);
+      //keep the columns aligned if the number of measurements changed
+      ms.resize(sensorSizes[i][j],0.0);
+      row.insert(row.end(),ms.begin(),ms.end());
+    }
+  }
+  for(size_t i=0;i<world->rigidObjects.size();i++) {
+    RigidTransform T;
+    Vector3 w,v;
+    sim.odesim.object(i)->GetTransform(T);
+    sim.odesim.object(i)->GetVelocity(w,v);
+    EulerAngleRotation r;
+    r.setMatrixZYX(T.R);
+    double values[12] = {T.t.x,T.t.y,T.t.z,r.x,r.y,r.z,v.x,v.y,v.z,w.x,w.y,w.z};
+    row.insert(row.end(),values,values+12);
+  }
+  writer.Append(row);
+}
+
+
+SimulationContactLogger::SimulationContactLogger(WorldSimulation& _sim)
+  :sim(_sim)
+{}
+
+bool SimulationContactLogger::Open(const char* fn)
+{
+  const char* columns[12] = {"time","body1","body2","cop x","cop y","cop z","fx","fy","fz","tx","ty","tz"};
+  vector<string> names(columns,columns+12);
+  row.resize(12);
+  return writer.Open(fn,names,SimulationLogMetadata(*sim.world,"contact_wrench"));
+}
+
+void SimulationContactLogger::Log()
+{
+  if(!writer.IsOpen()) return;
+  for(WorldSimulation::ContactFeedbackMap::iterator i=sim.contactFeedback.begin();i!=sim.contactFeedback.end();i++) {
+    if(i->second.contactCount==0) continue;
+    const ContactFeedbackInfo& info = i->second;
+    row[0] = sim.time;
+    row[1] = sim.ODEToWorldID(i->first.first);
+    row[2] = sim.ODEToWorldID(i->first.second);
+    info.meanPoint.get(row[3],row[4],row[5]);
+    info.meanForce.get(row[6],row[7],row[8]);
+    info.meanTorque.get(row[9],row[10],row[11]);
+    writer.Append(row);
+  }
+}
@@ -0,0 +1,57 @@
+#ifndef SIMULATION_LOGGER_H
+#define SIMULATION_LOGGER_H
+
+#include "WorldSimulation.h"
+#include "IO/ColumnLog.h"
+
+/** @ingroup Simulation
+ * @brief Logs the simulation state to a column log (see IO/ColumnLog.h)
+ * each time Log() is called.
+ *
+ * Each row holds the time, then for each robot its center of mass,
+ * simulated q, dq, actuator torques, and the measurements of each sensor,
+ * then for each rigid object its position, ZYX euler angles, velocity, and
+ * angular velocity.  Columns are named as in SimGUIBackend::DoLogging.
+ *
+ * The number of sensor measurements is fixed when the log is opened.
+ */
+class SimulationStateLogger
+{
+ public:
+  SimulationStateLogger(WorldSimulation& sim);
+  bool Open(const char* fn);
+  void Log();
+  void Close() { writer.Close(); }
+
+  WorldSimulation& sim;
+  ColumnLogWriter writer;
+  vector<vector<int> > sensorSizes;
+  vector<double> row;
+};
+
+/** @ingroup Simulation
+ * @brief Logs the contact wrench between each pair of bodies in contact to
+ * a column log each time Log() is called.
+ *
+ * Rows have the columns time, body1, body2, cop x/y/z, fx/fy/fz, and
+ * tx/ty/tz, where the bodies are given by world ID.  The metadata is a JSON
+ * object whose "names" list gives the name of each ID.
+ */
+class SimulationContactLogger
+{
+ public:
+  SimulationContactLogger(WorldSimulation& sim);
+  bool Open(const char* fn);
+  void Log();
+  void Close() { writer.Close(); }
+
+  WorldSimulation& sim;
+  ColumnLogWriter writer;
+  vector<double> row;
+};
+
+///Returns the JSON metadata {"type":type,"names":[...]} listing the name
+///of each world ID, used by the simulation column logs
+string SimulationLogMetadata(RobotWorld& world,const char* type);
+
+#endif
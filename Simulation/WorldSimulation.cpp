@@ -1,7 +1,9 @@
 #include "WorldSimulation.h"
+#include "Modeling/ParallelFor.h"
 #include <KrisLibrary/Timer.h>
 #include <ode/ode.h>
 #include "ODECommon.h"
+#include <string.h>
 
 #define READ_FILE_DEBUG(file,object,prefix)		\
   if(!ReadFile(file,object)) { \
@@ -105,8 +107,121 @@ void Reset(ContactFeedbackInfo& info)
   info.meanForce.setZero();
   info.meanTorque.setZero();
   info.meanPoint.setZero();
-  info.times.clear();
-  info.contactLists.clear();
+  info.firstRecord = info.lastRecord = -1;
+  info.numRecords = 0;
+}
+
+//default capacity of the contact pool
+const static int kDefaultContactPoolRecords = 4096;
+const static int kDefaultContactPoolPoints = 32768;
+
+ContactFeedbackPool::ContactFeedbackPool()
+  :firstRecord(0),numRecords(0),pointHead(0),pointsUsed(0),numDropped(0)
+{}
+
+void ContactFeedbackPool::Reserve(int maxRecords,int maxPoints)
+{
+  records.resize(maxRecords);
+  points.resize(maxPoints);
+  forces.resize(maxPoints);
+  Clear();
+}
+
+void ContactFeedbackPool::Clear()
+{
+  firstRecord = numRecords = 0;
+  pointHead = pointsUsed = 0;
+  numDropped = 0;
+}
+
+void ContactFeedbackPool::PopFront()
+{
+  const ContactFeedbackRecord& r = records[firstRecord];
+  //the oldest record in the pool is also the oldest of its pair, unless
+  //the pair was reset since it was added
+  ContactFeedbackInfo* info = r.owner;
+  if(info->firstRecord == firstRecord) {
+    info->firstRecord = r.next;
+    if(r.next < 0) info->lastRecord = -1;
+    info->numRecords--;
+  }
+  pointsUsed -= r.used;
+  firstRecord = (firstRecord+1) % (int)records.size();
+  numRecords--;
+  numDropped++;
+}
+
+void ContactFeedbackPool::Add(ContactFeedbackInfo& info,double time,const ODEContactList& list)
+{
+  int n = (int)list.points.size();
+  int capacity = (int)points.size();
+  if(records.empty() || n > capacity) {
+    if(numDropped == 0)
+      fprintf(stderr,"ContactFeedbackPool: record of %d points does not fit in a pool of %d records / %d points, dropping it\n",n,(int)records.size(),capacity);
+    numDropped++;
+    return;
+  }
+  if(numRecords == 0) pointHead = pointsUsed = 0;
+  //the points are stored contiguously, so skip the end of the arrays if
+  //they do not fit there
+  int start = pointHead, used = n;
+  if(start + n > capacity) {
+    used += capacity - start;
+    start = 0;
+  }
+  while(numRecords > 0 && (numRecords == (int)records.size() || pointsUsed + used > capacity)) {
+    if(numDropped == 0)
+      fprintf(stderr,"ContactFeedbackPool: capacity of %d records / %d points exceeded, overwriting the oldest contact feedback\n",(int)records.size(),capacity);
+    PopFront();
+  }
+  if(numRecords == 0) { start = 0; used = n; }
+  int index = (firstRecord + numRecords) % (int)records.size();
+  ContactFeedbackRecord& r = records[index];
+  r.time = time;
+  r.start = start;
+  r.count = n;
+  r.used = used;
+  r.penetrating = list.penetrating;
+  r.owner = &info;
+  r.next = -1;
+  for(int k=0;k<n;k++) {
+    points[start+k] = list.points[k];
+    //forces are empty if the list was not solved
+    if(k < (int)list.forces.size()) forces[start+k] = list.forces[k];
+    else forces[start+k].setZero();
+  }
+  pointHead = start + n;
+  pointsUsed += used;
+  if(info.lastRecord >= 0) records[info.lastRecord].next = index;
+  else info.firstRecord = index;
+  info.lastRecord = index;
+  info.numRecords++;
+  numRecords++;
+}
+
+void ContactFeedbackPool::Get(int record,ODEContactList& list) const
+{
+  const ContactFeedbackRecord& r = records[record];
+  list.points.assign(points.begin()+r.start,points.begin()+r.start+r.count);
+  list.forces.assign(forces.begin()+r.start,forces.begin()+r.start+r.count);
+  list.penetrating = r.penetrating;
+  list.feedbackIndices.resize(0);
+}
+
+void ContactFeedbackPool::GetTimes(const ContactFeedbackInfo& info,vector<double>& times) const
+{
+  times.resize(info.numRecords);
+  int k=0;
+  for(int r=info.firstRecord;r>=0;r=records[r].next,k++)
+    times[k] = records[r].time;
+}
+
+void ContactFeedbackPool::GetContactLists(const ContactFeedbackInfo& info,vector<ODEContactList>& contactLists) const
+{
+  contactLists.resize(info.numRecords);
+  int k=0;
+  for(int r=info.firstRecord;r>=0;r=records[r].next,k++)
+    Get(r,contactLists[k]);
 }
 
 template <class T>
@@ -187,7 +302,7 @@ bool ReadFile(File& f,ODEContactList& list)
   return true;
 }
 
-bool WriteFile(File& f,const ContactFeedbackInfo& info)
+bool WriteFile(File& f,const ContactFeedbackInfo& info,const ContactFeedbackPool& pool)
 {
   if(!WriteFile(f,info.accum)) return false;
   if(!WriteFile(f,info.inContact)) return false;
@@ -199,12 +314,20 @@ bool WriteFile(File& f,const ContactFeedbackInfo& info)
   if(!WriteFile(f,info.meanTorque)) return false;
   if(!WriteFile(f,info.meanPoint)) return false;
   if(!WriteFile(f,info.accumFull)) return false;
-  if(!WriteFile(f,info.times)) return false;
-  if(!WriteFile(f,info.contactLists)) return false;
+  //written as the vectors of times and ODEContactLists
+  if(!WriteFile(f,info.numRecords)) return false;
+  for(int r=info.firstRecord;r>=0;r=pool.records[r].next)
+    if(!WriteFile(f,pool.records[r].time)) return false;
+  if(!WriteFile(f,info.numRecords)) return false;
+  ODEContactList list;
+  for(int r=info.firstRecord;r>=0;r=pool.records[r].next) {
+    pool.Get(r,list);
+    if(!WriteFile(f,list)) return false;
+  }
   return true;
 }
 
-bool ReadFile(File& f,ContactFeedbackInfo& info)
+bool ReadFile(File& f,ContactFeedbackInfo& info,ContactFeedbackPool& pool)
 {
   READ_FILE_DEBUG(f,info.accum,"ReadFile(ContactFeedbackInfo)");
   READ_FILE_DEBUG(f,info.inContact,"ReadFile(ContactFeedbackInfo)");
@@ -216,14 +339,26 @@ bool ReadFile(File& f,ContactFeedbackInfo& info)
   READ_FILE_DEBUG(f,info.meanTorque,"ReadFile(ContactFeedbackInfo)");
   READ_FILE_DEBUG(f,info.meanPoint,"ReadFile(ContactFeedbackInfo)");
   READ_FILE_DEBUG(f,info.accumFull,"ReadFile(ContactFeedbackInfo)");
-  READ_FILE_DEBUG(f,info.times,"ReadFile(ContactFeedbackInfo)");
-  READ_FILE_DEBUG(f,info.contactLists,"ReadFile(ContactFeedbackInfo)");
+  vector<double> times;
+  vector<ODEContactList> contactLists;
+  READ_FILE_DEBUG(f,times,"ReadFile(ContactFeedbackInfo)");
+  READ_FILE_DEBUG(f,contactLists,"ReadFile(ContactFeedbackInfo)");
+  if(times.size() != contactLists.size()) {
+    fprintf(stderr,"ReadFile(ContactFeedbackInfo): %d times but %d contact lists\n",(int)times.size(),(int)contactLists.size());
+    return false;
+  }
+  info.firstRecord = info.lastRecord = -1;
+  info.numRecords = 0;
+  if(!times.empty() && pool.RecordCapacity() == 0)
+    pool.Reserve(kDefaultContactPoolRecords,kDefaultContactPoolPoints);
+  for(size_t i=0;i<times.size();i++)
+    pool.Add(info,times[i],contactLists[i]);
   return true;
 }
 
 
 WorldSimulation::WorldSimulation()
-  :time(0),simStep(0.001),fakeSimulation(false),worstStatus(ODESimulator::StatusNormal)
+  :time(0),simStep(0.001),fakeSimulation(false),sensorNoiseSeeded(false),worstStatus(ODESimulator::StatusNormal)
 {}
 
 void WorldSimulation::Init(RobotWorld* _world)
@@ -245,6 +380,7 @@ void WorldSimulation::Init(RobotWorld* _world)
     Robot* robot=world->robots[i];
     RobotMotorCommand& command=controlSimulators[i].command;
     controlSimulators[i].Init(robot,odesim.robot(i),(i < robotControllers.size() ? robotControllers[i] : NULL));
+    controlSimulators[i].SetSensorNoise(sensorNoiseSeeded ? &sensorNoise : NULL);
 
     //RobotController* c=controlSimulators[i].controller;
 
@@ -295,6 +431,7 @@ void WorldSimulation::OnAddModel()
     Robot* robot=world->robots[i];
     RobotMotorCommand& command=controlSimulators[i].command;
     controlSimulators[i].Init(robot,odesim.robot(i),(i < robotControllers.size() ? robotControllers[i] : NULL));
+    controlSimulators[i].SetSensorNoise(sensorNoiseSeeded ? &sensorNoise : NULL);
 
     //RobotController* c=controlSimulators[i].controller;
 
@@ -328,6 +465,14 @@ void WorldSimulation::OnAddModel()
   }
 }
 
+void WorldSimulation::SeedSensorNoise(unsigned long long seed)
+{
+  sensorNoise.Seed(seed);
+  sensorNoiseSeeded = true;
+  for(size_t i=0;i<controlSimulators.size();i++)
+    controlSimulators[i].SetSensorNoise(&sensorNoise);
+}
+
 void WorldSimulation::SetController(int index,SmartPointer<RobotController> c)
 {
   if(robotControllers.empty()) {
@@ -359,8 +504,16 @@ void WorldSimulation::Advance(Real dt)
     return;
   }
 
+  contactPool.Clear();
+  feedbackSlots.resize(0);
   for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
     Reset(i->second);
+    if(i->second.accum || i->second.accumFull) {
+      FeedbackSlot slot;
+      slot.info = &i->second;
+      slot.list = odesim.GetContactFeedback(i->first.first,i->first.second);
+      if(slot.list) feedbackSlots.push_back(slot);
+    }
   }
   //Timer timer;
   Real timeLeft=dt;
@@ -369,8 +522,9 @@ void WorldSimulation::Advance(Real dt)
   //printf("Advance %g -> %g, simulation time step %g\n",time,time+dt,simStep);
   while(timeLeft > 0.0) {
     Real step = Min(timeLeft,simStep);
+    sensorScheduler.Step(step,this);
     for(size_t i=0;i<controlSimulators.size();i++) 
-      controlSimulators[i].Step(step,this);
+      controlSimulators[i].StepControl(step);
     for(size_t i=0;i<hooks.size();i++)
       hooks[i]->Step(step);
 
@@ -400,49 +554,44 @@ void WorldSimulation::Advance(Real dt)
     numSteps++;
 
     //accumulate contact information
-    for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
-      if(i->second.accum || i->second.accumFull) {
-	ODEContactList* list = odesim.GetContactFeedback(i->first.first,i->first.second);
-	if(!list) continue;
-	if(i->second.accum) {
-	  if(list->forces.empty()) i->second.separationCount++;
-	  else i->second.contactCount++;
-	  i->second.inContact = !list->forces.empty();
-    i->second.penetrating = list->penetrating;
-    if(list->penetrating) i->second.penetrationCount++;
-	  Vector3 meanPoint(Zero),meanForce(Zero),meanTorque(Zero);
-	  if(!list->forces.empty()) {
-	    Real wsum = 0;
-	    for(size_t k=0;k<list->forces.size();k++) {
-	      Real w = list->forces[k].dot(list->points[k].n);
-	      meanPoint += list->points[k].x*w;
-	      wsum += w;
-	    }
-	    if(wsum == 0) {
-	      meanPoint.setZero();
-	      for(size_t k=0;k<list->forces.size();k++) 
-		meanPoint += list->points[k].x;
-	      meanPoint /= list->forces.size();
-	    }
-	    else 
-	      meanPoint /= wsum;
-	      //update average;
-	    i->second.meanPoint += 1.0/i->second.contactCount*(meanPoint - i->second.meanPoint);
-	  }
+    for(size_t i=0;i<feedbackSlots.size();i++) {
+      ContactFeedbackInfo& info = *feedbackSlots[i].info;
+      const ODEContactList* list = feedbackSlots[i].list;
+      if(info.accum) {
+	if(list->forces.empty()) info.separationCount++;
+	else info.contactCount++;
+	info.inContact = !list->forces.empty();
+	info.penetrating = list->penetrating;
+	if(list->penetrating) info.penetrationCount++;
+	Vector3 meanPoint(Zero),meanForce(Zero),meanTorque(Zero);
+	if(!list->forces.empty()) {
+	  Real wsum = 0;
 	  for(size_t k=0;k<list->forces.size();k++) {
-	    meanForce += list->forces[k];
-	    meanTorque += cross((list->points[k].x-meanPoint),list->forces[k]);
+	    Real w = list->forces[k].dot(list->points[k].n);
+	    meanPoint += list->points[k].x*w;
+	    wsum += w;
 	  }
-	  //update average
-
-	  i->second.meanForce += 1.0/numSteps*(meanForce - i->second.meanForce);
-	  i->second.meanTorque += 1.0/numSteps*(meanTorque - i->second.meanTorque);
+	  if(wsum == 0) {
+	    meanPoint.setZero();
+	    for(size_t k=0;k<list->forces.size();k++) 
+	      meanPoint += list->points[k].x;
+	    meanPoint /= list->forces.size();
+	  }
+	  else 
+	    meanPoint /= wsum;
+	  //update average;
+	  info.meanPoint += 1.0/info.contactCount*(meanPoint - info.meanPoint);
 	}
-	if(i->second.accumFull) {
-	  i->second.times.push_back(time + accumTime);
-	  i->second.contactLists.push_back(*list);
+	for(size_t k=0;k<list->forces.size();k++) {
+	  meanForce += list->forces[k];
+	  meanTorque += cross((list->points[k].x-meanPoint),list->forces[k]);
 	}
+	//update average
+	info.meanForce += 1.0/numSteps*(meanForce - info.meanForce);
+	info.meanTorque += 1.0/numSteps*(meanTorque - info.meanTorque);
       }
+      if(info.accumFull)
+	contactPool.Add(info,time + accumTime,*list);
     }
   }
   time += dt;
@@ -462,6 +611,8 @@ void WorldSimulation::Advance(Real dt)
   if(anyKilled) {
     swap(hooks,newhooks);
   }
+
+  if(history.Capacity() > 0) history.Push(*this);
   /*
   //convert sums to means
   for(ContactFeedbackMap::iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
@@ -475,6 +626,26 @@ void WorldSimulation::Advance(Real dt)
   //printf("WorldSimulation: Sim step %gs, real step %gs\n",dt,timer.ElapsedTime());
 }
 
+struct AdvanceSimulationsBody : public ODEParallelForBody
+{
+  AdvanceSimulationsBody(const vector<WorldSimulation*>& _sims,Real _dt)
+    :sims(_sims),dt(_dt)
+  {}
+  virtual void Run(int index,int thread)
+  {
+    sims[index]->Advance(dt);
+  }
+
+  const vector<WorldSimulation*>& sims;
+  Real dt;
+};
+
+void AdvanceSimulations(const vector<WorldSimulation*>& sims,Real dt,int numThreads)
+{
+  AdvanceSimulationsBody body(sims,dt);
+  ParallelFor((int)sims.size(),body,(ODEThreadSafe() ? ResolveNumThreads(numThreads) : 1));
+}
+
 void WorldSimulation::AdvanceFake(Real dt)
 {
   bool oldFake = fakeSimulation;
@@ -562,6 +733,13 @@ bool WorldSimulation::ReadState(File& f)
     fprintf(stderr,"WorldSimulation::ReadState: ODE sim failed to read\n");
     return false;
   }
+  if(!ReadAuxState(f)) return false;
+  UpdateModel();
+  return true;
+}
+
+bool WorldSimulation::ReadAuxState(File& f)
+{
   //controlSimulators will read the robotControllers' states
   for(size_t i=0;i<controlSimulators.size();i++) {
     if(!controlSimulators[i].ReadState(f)) {
@@ -582,9 +760,9 @@ bool WorldSimulation::ReadState(File& f)
     return false;
   }
   contactFeedback.clear();
+  contactPool.Clear();
   for(int i=0;i<n;i++) {
     pair<ODEObjectID,ODEObjectID> key;
-    ContactFeedbackInfo info;
     if(!ReadFile(f,key.first)) {
       fprintf(stderr,"Unable to read contact feedback %d object 1\n",i);
       return false;
@@ -593,13 +771,12 @@ bool WorldSimulation::ReadState(File& f)
       fprintf(stderr,"Unable to read contact feedback %d object 2\n",i);
       return false;
     }
-    if(!ReadFile(f,info)) {
+    //read in place, since the pool's records point to the info
+    if(!ReadFile(f,contactFeedback[key],contactPool)) {
       fprintf(stderr,"Unable to read contact feedback %d info\n",i);
       return false;
     }
-    contactFeedback[key] = info;
   }
-  UpdateModel();
   return true;
 }
 
@@ -607,6 +784,11 @@ bool WorldSimulation::WriteState(File& f) const
 {
   if(!WriteFile(f,time)) return false;
   if(!odesim.WriteState(f)) return false;
+  return WriteAuxState(f);
+}
+
+bool WorldSimulation::WriteAuxState(File& f) const
+{
   //controlSimulators will write the robotControllers' states
   for(size_t i=0;i<controlSimulators.size();i++) {
     if(!controlSimulators[i].WriteState(f)) return false;
@@ -621,7 +803,7 @@ bool WorldSimulation::WriteState(File& f) const
   for(ContactFeedbackMap::const_iterator i=contactFeedback.begin();i!=contactFeedback.end();i++) {
     if(!WriteFile(f,i->first.first)) return false;
     if(!WriteFile(f,i->first.second)) return false;
-    if(!WriteFile(f,i->second)) return false;
+    if(!WriteFile(f,i->second,contactPool)) return false;
   }
   return true;
 }
@@ -648,12 +830,137 @@ bool WorldSimulation::WriteState(string& s) const
   return true;
 }
 
+const static char kSnapshotMagic[4] = {'K','S','N','P'};
+const static int kSnapshotVersion = 1;
+
+bool WorldSimulation::WriteSnapshot(vector<char>& buf) const
+{
+  //the auxiliary state is variable-length, so encode it into a scratch
+  //buffer that keeps its capacity between calls
+  if(!snapshotScratch.IsOpen()) {
+    if(!snapshotScratch.OpenData(FILEREAD | FILEWRITE)) return false;
+  }
+  snapshotScratch.Seek(0,FILESEEKSTART);
+  if(!WriteAuxState(snapshotScratch)) return false;
+  //HACK for File internal buffer length bug returning buffer capacity rather
+  //than size
+  int auxSize = snapshotScratch.Position();
+
+  WorldSimulationSnapshotHeader header;
+  for(int i=0;i<4;i++) header.magic[i] = kSnapshotMagic[i];
+  header.version = kSnapshotVersion;
+  header.realSize = (int)sizeof(dReal);
+  header.numODEReals = odesim.BinaryStateSize();
+  header.auxSize = auxSize;
+  header.reserved = 0;
+  header.time = time;
+
+  size_t odeBytes = header.numODEReals*sizeof(dReal);
+  buf.resize(sizeof(header)+odeBytes+auxSize);
+  memcpy(&buf[0],&header,sizeof(header));
+  odesim.WriteBinaryState((dReal*)&buf[sizeof(header)]);
+  if(auxSize > 0)
+    memcpy(&buf[sizeof(header)+odeBytes],snapshotScratch.GetDataBuffer(),auxSize);
+  return true;
+}
+
+bool WorldSimulation::ReadSnapshot(const char* data,size_t size)
+{
+  WorldSimulationSnapshotHeader header;
+  if(size < sizeof(header)) {
+    fprintf(stderr,"WorldSimulation::ReadSnapshot: snapshot too short\n");
+    return false;
+  }
+  memcpy(&header,data,sizeof(header));
+  if(memcmp(header.magic,kSnapshotMagic,4) != 0) {
+    fprintf(stderr,"WorldSimulation::ReadSnapshot: not a snapshot\n");
+    return false;
+  }
+  if(header.version != kSnapshotVersion) {
+    fprintf(stderr,"WorldSimulation::ReadSnapshot: unsupported version %d\n",header.version);
+    return false;
+  }
+  if(header.realSize != (int)sizeof(dReal)) {
+    fprintf(stderr,"WorldSimulation::ReadSnapshot: snapshot was written with %d-byte reals, ODE uses %d\n",header.realSize,(int)sizeof(dReal));
+    return false;
+  }
+  if(header.numODEReals != odesim.BinaryStateSize()) {
+    fprintf(stderr,"WorldSimulation::ReadSnapshot: snapshot has %d ODE state entries, simulation has %d\n",header.numODEReals,odesim.BinaryStateSize());
+    return false;
+  }
+  size_t odeBytes = header.numODEReals*sizeof(dReal);
+  if(header.auxSize < 0 || size != sizeof(header)+odeBytes+header.auxSize) {
+    fprintf(stderr,"WorldSimulation::ReadSnapshot: snapshot size %d is inconsistent with its header\n",(int)size);
+    return false;
+  }
+  worstStatus = ODESimulator::StatusNormal;
+  time = header.time;
+  //the body state may not be aligned within the input buffer
+  snapshotODEState.resize(header.numODEReals);
+  memcpy(&snapshotODEState[0],data+sizeof(header),odeBytes);
+  odesim.ReadBinaryState(&snapshotODEState[0]);
+  File f;
+  if(!f.OpenData((void*)(data+sizeof(header)+odeBytes),header.auxSize,FILEREAD)) return false;
+  if(!ReadAuxState(f)) return false;
+  UpdateModel();
+  return true;
+}
+
+WorldSimulationHistory::WorldSimulationHistory()
+  :head(0),count(0)
+{}
+
+void WorldSimulationHistory::Resize(int capacity,size_t snapshotSize)
+{
+  slots.resize(capacity);
+  for(size_t i=0;i<slots.size();i++) {
+    slots[i].resize(0);
+    if(snapshotSize > 0) slots[i].reserve(snapshotSize);
+  }
+  Clear();
+}
+
+void WorldSimulationHistory::Clear()
+{
+  head = 0;
+  count = 0;
+}
+
+bool WorldSimulationHistory::Push(const WorldSimulation& sim)
+{
+  if(slots.empty()) return false;
+  if(!sim.WriteSnapshot(slots[head])) return false;
+  head = (head+1) % (int)slots.size();
+  if(count < (int)slots.size()) count++;
+  return true;
+}
+
+const vector<char>& WorldSimulationHistory::Get(int stepsBack) const
+{
+  Assert(stepsBack >= 0 && stepsBack < count);
+  int n = (int)slots.size();
+  return slots[(head-1-stepsBack+2*n) % n];
+}
+
+bool WorldSimulationHistory::Rewind(WorldSimulation& sim,int stepsBack)
+{
+  if(stepsBack < 0 || stepsBack >= count) return false;
+  const vector<char>& snapshot = Get(stepsBack);
+  if(!sim.ReadSnapshot(&snapshot[0],snapshot.size())) return false;
+  int n = (int)slots.size();
+  head = (head-stepsBack+n) % n;
+  count -= stepsBack;
+  return true;
+}
+
 void WorldSimulation::EnableContactFeedback(int aid,int bid,bool accum,bool accumFull)
 {
   ContactFeedbackInfo f;
   f.accum = accum;
   f.accumFull = accumFull;
   Reset(f);
+  if(accumFull && contactPool.RecordCapacity() == 0)
+    contactPool.Reserve(kDefaultContactPoolRecords,kDefaultContactPoolPoints);
   pair<ODEObjectID,ODEObjectID> index(WorldToODEID(aid),WorldToODEID(bid));
   if(index.second < index.first) 
     swap(index.second,index.first);
@@ -670,6 +977,15 @@ ContactFeedbackInfo* WorldSimulation::GetContactFeedback(int aid,int bid)
   return &contactFeedback[index];
 }
 
+bool WorldSimulation::GetContactFeedbackHistory(int aid,int bid,vector<Real>& times,vector<ODEContactList>& contactLists)
+{
+  ContactFeedbackInfo* info = GetContactFeedback(aid,bid);
+  if(!info) return false;
+  contactPool.GetTimes(*info,times);
+  contactPool.GetContactLists(*info,contactLists);
+  return true;
+}
+
 ODEContactList* WorldSimulation::GetContactList(int aid,int bid)
 {
   ODEObjectID a=WorldToODEID(aid);
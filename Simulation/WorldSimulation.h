@@ -4,6 +4,8 @@
 #include "Modeling/World.h"
 #include "ODESimulator.h"
 #include "ControlledSimulator.h"
+#include "SensorScheduler.h"
+#include "Modeling/RandomStream.h"
 #include <map>
 
 /** @brief Container for information about contacts regarding a certain
@@ -14,6 +16,11 @@
  * call may potential make several inner sub steps.  Rather than simply
  * reporting the data at the last point, this class will aggregate the
  * sub-step data.
+ *
+ * Migration note: the former times and contactLists members have been
+ * removed, since copying each sub-step's contact list made full feedback
+ * slow.  The per-sub-step data is stored in WorldSimulation::contactPool;
+ * use WorldSimulation::GetContactFeedbackHistory to get it in the same form.
  */
 struct ContactFeedbackInfo
 {
@@ -28,8 +35,70 @@ struct ContactFeedbackInfo
 
   //full contact information over sub-steps
   bool accumFull;  //set to true if all ODEContactLists should be stored
-  vector<double> times;
-  vector<ODEContactList> contactLists;
+  ///the sub-step records of this pair in WorldSimulation::contactPool,
+  ///linked through ContactFeedbackRecord::next (-1 if none).  Read them
+  ///with ContactFeedbackPool::GetTimes and GetContactLists.
+  int firstRecord,lastRecord,numRecords;
+};
+
+/** @brief The contacts between one pair of objects on one sub-step, stored
+ * in a ContactFeedbackPool.  The points and forces are the pool's entries
+ * [start,start+count).
+ */
+struct ContactFeedbackRecord
+{
+  double time;
+  int start,count;
+  int used;     ///< the point entries taken, including any skipped at the end of the arrays
+  bool penetrating;
+  ContactFeedbackInfo* owner;  ///< the pair this record belongs to
+  int next;     ///< the next record of the same pair, or -1
+};
+
+/** @brief Fixed-capacity storage for the per-sub-step contact feedback of
+ * the pairs with accumFull set.
+ *
+ * Records, points, and forces live in ring buffers that are reused by each
+ * Advance() call, so recording never allocates.  When a record does not
+ * fit, the oldest records are overwritten, and removed from the front of
+ * their pairs' lists; a record with more points than the whole pool is
+ * dropped.  numDropped counts both.  Use Reserve() to change the capacity;
+ * by default it is set on the first EnableContactFeedback call with
+ * accumFull=true.
+ *
+ * Each record points to its ContactFeedbackInfo, which must not move while
+ * the record is in the pool.
+ */
+class ContactFeedbackPool
+{
+ public:
+  ContactFeedbackPool();
+  void Reserve(int maxRecords,int maxPoints);
+  void Clear();
+  int RecordCapacity() const { return (int)records.size(); }
+  int PointCapacity() const { return (int)points.size(); }
+  ///Copies list into a new record and appends it to info's records,
+  ///overwriting the oldest records if the pool is full
+  void Add(ContactFeedbackInfo& info,double time,const ODEContactList& list);
+  ///Copies a record into list
+  void Get(int record,ODEContactList& list) const;
+  ///Returns the times of info's records
+  void GetTimes(const ContactFeedbackInfo& info,vector<double>& times) const;
+  ///Returns the contact lists of info's records
+  void GetContactLists(const ContactFeedbackInfo& info,vector<ODEContactList>& contactLists) const;
+
+  vector<ContactFeedbackRecord> records;
+  vector<ContactPoint> points;
+  vector<Vector3> forces;
+  int firstRecord;        ///< the oldest record
+  int numRecords;
+  int pointHead;          ///< where the next record's points go
+  int pointsUsed;
+  int numDropped;         ///< records overwritten or dropped since Clear()
+
+ private:
+  ///Removes the oldest record
+  void PopFront();
 };
 
 /** @brief Any function that should be run per sub-step of the simulation
@@ -55,7 +124,61 @@ class WorldSimulationHook
   bool autokill;
 };
 
+class WorldSimulation;
+
+/** @brief The header of a binary snapshot written by
+ * WorldSimulation::WriteSnapshot.
+ *
+ * The header is followed by numODEReals dReals holding the fixed-layout
+ * ODE state (see ODESimulator::WriteBinaryState), then auxSize bytes of
+ * controller, hook, and contact feedback state in the same encoding as
+ * WriteState.  Snapshots are only valid for a simulation with the same
+ * robots, objects, controllers, and hooks, and on the same platform.
+ */
+struct WorldSimulationSnapshotHeader
+{
+  char magic[4];    ///< "KSNP"
+  int version;      ///< the format version, currently 1
+  int realSize;     ///< sizeof(dReal) of the writer
+  int numODEReals;
+  int auxSize;
+  int reserved;
+  double time;
+};
+
+/** @brief A ring buffer holding the last K snapshots of a WorldSimulation,
+ * e.g., for rewinding.
+ *
+ * Slots are reused once the buffer is full, so after warm-up neither
+ * recording nor rewinding allocates memory (unless the snapshot size grows).
+ */
+class WorldSimulationHistory
+{
+ public:
+  WorldSimulationHistory();
+  ///Keeps up to capacity snapshots and clears the history.  If
+  ///snapshotSize is given, each slot is preallocated to that many bytes.
+  void Resize(int capacity,size_t snapshotSize=0);
+  void Clear();
+  int Capacity() const { return (int)slots.size(); }
+  int Size() const { return count; }
+  ///Saves a snapshot of sim, overwriting the oldest one if full
+  bool Push(const WorldSimulation& sim);
+  ///Returns the snapshot stepsBack entries before the newest one
+  const vector<char>& Get(int stepsBack=0) const;
+  ///Restores sim to the snapshot stepsBack entries before the newest one,
+  ///and discards the snapshots newer than it
+  bool Rewind(WorldSimulation& sim,int stepsBack=0);
+
+  vector<vector<char> > slots;
+  int head;    ///< the slot that the next Push writes to
+  int count;
+};
+
 /** @brief A physical simulator for a RobotWorld.
+ *
+ * If history has nonzero capacity, a snapshot is recorded at the end of
+ * every Advance() call.
  */
 class WorldSimulation
 {
@@ -66,6 +189,10 @@ public:
   void OnAddModel();
   ///Sets the robot's controller 
   void SetController(int robot,SmartPointer<RobotController> c);
+  ///Seeds sensorNoise and makes all sensors draw their noise from it.
+  ///Until this is called, sensor noise comes from the global random number
+  ///generator, so it still follows the global seed.
+  void SeedSensorNoise(unsigned long long seed);
   ///Advance simulation time by dt (may take multiple sub-steps)
   void Advance(Real dt);
   ///Advance simulation time without actually performing ODE simulation
@@ -81,6 +208,14 @@ public:
   bool WriteState(File& f) const;
   bool ReadState(const string& data);
   bool WriteState(string& data) const;
+  ///Load/save a compact binary snapshot (see WorldSimulationSnapshotHeader).
+  ///Cheaper than Read/WriteState since the ODE state is copied directly.
+  ///buf is resized, but its memory is reused if it has enough capacity.
+  bool ReadSnapshot(const char* data,size_t size);
+  bool WriteSnapshot(vector<char>& buf) const;
+  //used internally: the controller, hook, and contact feedback state
+  bool ReadAuxState(File& f);
+  bool WriteAuxState(File& f) const;
 
   //contact querying routines
   ///Enables contact feedback between the two objects.  This must be called
@@ -103,6 +238,9 @@ public:
   bool HadPenetration(int aid,int bid=-1);
   ///Returns the ContactFeedback structure for the two objects
   ContactFeedbackInfo* GetContactFeedback(int aid,int bid);
+  ///Returns the per-sub-step contact lists recorded for the two objects
+  ///during the past Advance call (requires accumFull)
+  bool GetContactFeedbackHistory(int aid,int bid,vector<Real>& times,vector<ODEContactList>& contactLists);
   ///Returns the contact list for the prior time step
   ODEContactList* GetContactList(int aid,int bid);
   ///Returns the resultant contact force (on object a) from the prior time step
@@ -126,12 +264,49 @@ public:
   vector<ControlledRobotSimulator> controlSimulators;
   vector<SmartPointer<RobotController> > robotControllers;
   vector<SmartPointer<WorldSimulationHook> > hooks;
+  ///Simulates the robots' sensors on each sub-step
+  SensorScheduler sensorScheduler;
+  ///The stream that sensor noise is drawn from once SeedSensorNoise has
+  ///been called
+  RandomStream sensorNoise;
+  bool sensorNoiseSeeded;
   typedef map<pair<ODEObjectID,ODEObjectID>,ContactFeedbackInfo> ContactFeedbackMap;
   ContactFeedbackMap contactFeedback;
+  ///Storage for the full contact feedback of the accumFull pairs
+  ContactFeedbackPool contactPool;
   ///Worst simulation status over the last Advance() call.
   ODESimulator::Status worstStatus;
+  ///Snapshots recorded after each Advance() call (empty by default)
+  WorldSimulationHistory history;
+
+ private:
+  //scratch space for WriteSnapshot / ReadSnapshot
+  mutable File snapshotScratch;
+  vector<dReal> snapshotODEState;
+  //the feedback pairs in a flat array, rebuilt on each Advance() call so
+  //that sub-steps do not walk contactFeedback
+  struct FeedbackSlot
+  {
+    ContactFeedbackInfo* info;
+    ODEContactList* list;
+  };
+  vector<FeedbackSlot> feedbackSlots;
 };
 
+/** @brief Advances several independent simulations by dt, using up to
+ * numThreads threads (<= 0 uses all hardware threads).
+ *
+ * The simulations must not share worlds, controllers, or hooks.  Each one
+ * is advanced exactly as by its own Advance() call, so the results do not
+ * depend on the number of threads -- except that sensor noise is drawn from
+ * the global random number generator unless each simulation's noise was
+ * seeded with SeedSensorNoise.
+ *
+ * If ODE is not configured with --enable-ou (see ODEThreadSafe()), the
+ * simulations are advanced one at a time.
+ */
+void AdvanceSimulations(const vector<WorldSimulation*>& sims,Real dt,int numThreads=0);
+
 /** @brief A hook that adds a constant force to a body
  */
 class ForceHook : public WorldSimulationHook
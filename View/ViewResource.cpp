@@ -169,6 +169,7 @@ using namespace GLDraw;
 #endif
 
 ViewResource::ViewResource(Robot* robot)
+  :compiledVersion(0),compiledPolicy(MultiPath::InterpLinear),compiledSections(0),compiledHasIK(false)
 {
   SetRobot(robot);
   pathTime = 0;
@@ -307,7 +308,6 @@ void ViewResource::GetLinearPathConfig(const LinearPathResource* rc,Real pathTim
     return;
   }
   else {
-    //TODO: faster tracking using upper_bound?
     Assert(rc->times.size()==rc->milestones.size());
     Assert(rc->times.back() > rc->times.front());
     Real normalizedPathTime = pathTime;
@@ -326,20 +326,17 @@ void ViewResource::GetLinearPathConfig(const LinearPathResource* rc,Real pathTim
       normalizedPathTime = (cnt-n)*(rc->times.back()-rc->times.front());
     else
       normalizedPathTime = rc->times.back()-(cnt-n)*(rc->times.back()-rc->times.front());
-    bool drawn=false;
-    for(size_t i=0;i+1<rc->times.size();i++) {
-      if(rc->times[i] <= normalizedPathTime && normalizedPathTime <= rc->times[i+1]) {
-	Real u=(normalizedPathTime-rc->times[i])/(rc->times[i+1]-rc->times[i]);
-	if(pathViewer.robot==NULL)
-	  interpolate(rc->milestones[i],rc->milestones[i+1],u,q);
-	else {
-	  int d=pathViewer.robot->q.n;
-	  Assert(rc->milestones[i].n == d);
-	  Assert(rc->milestones[i+1].n == d);
-	  Interpolate(*pathViewer.robot,rc->milestones[i],rc->milestones[i+1],u,q);
-	}
-	return;
-      }
+    int i=linearPathCursor.Find(rc->times,normalizedPathTime);
+    Real u=1;
+    if(rc->times[i+1] > rc->times[i])
+      u=Clamp((normalizedPathTime-rc->times[i])/(rc->times[i+1]-rc->times[i]),0.0,1.0);
+    if(pathViewer.robot==NULL)
+      interpolate(rc->milestones[i],rc->milestones[i+1],u,q);
+    else {
+      int d=pathViewer.robot->q.n;
+      Assert(rc->milestones[i].n == d);
+      Assert(rc->milestones[i+1].n == d);
+      Interpolate(*pathViewer.robot,rc->milestones[i],rc->milestones[i+1],u,q);
     }
   }
 }
@@ -362,10 +359,54 @@ void ViewResource::GetMultiPathConfig(const MultiPathResource* rc,Real pathTime,
   else
     normalizedPathTime = maxTime-(cnt-n)*(maxTime-minTime);
 
-  if(pathViewer.robot)
-    EvaluateMultiPath(*pathViewer.robot,rc->path,normalizedPathTime,q,pathIKResolution);
-  else
-    rc->path.Evaluate(normalizedPathTime,q);
+  EvaluateMultiPathCached(rc,normalizedPathTime,q);
+}
+
+void ViewResource::EvaluateMultiPathCached(const MultiPathResource* rc,Real t,Config& q)
+{
+  //interpolate as EvaluateMultiPath does with a robot, and as
+  //MultiPath::Evaluate does without one
+  MultiPath::InterpPolicy policy = (pathViewer.robot ? MultiPath::InterpLinear : MultiPath::InterpCubic);
+  if(rc->version != compiledVersion || policy != compiledPolicy || rc->path.sections.size() != compiledSections) {
+    compiledVersion = rc->version;
+    compiledPolicy = policy;
+    compiledSections = rc->path.sections.size();
+    compiledHasIK = false;
+    vector<IKGoal> ik;
+    for(size_t s=0;s<rc->path.sections.size();s++) {
+      rc->path.GetIKProblem(ik,s);
+      if(!ik.empty()) compiledHasIK = true;
+    }
+    if(!compiledPath.Compile(rc->path,policy))
+      compiledPath.Clear();
+  }
+  bool solveIK = false;
+  if(pathViewer.robot && compiledHasIK) {
+    if(!rc->path.settings.contains("resolution"))
+      solveIK = true;
+    else
+      solveIK = (rc->path.settings.as<Real>("resolution") > pathIKResolution);
+  }
+  if(compiledPath.Empty() || solveIK || (pathViewer.robot && compiledPath.dim != pathViewer.robot->q.n)) {
+    if(pathViewer.robot)
+      EvaluateMultiPath(*pathViewer.robot,rc->path,t,q,pathIKResolution);
+    else
+      rc->path.Evaluate(t,q);
+    return;
+  }
+  if(pathViewer.robot==NULL) {
+    compiledPath.Eval(t,q);
+    return;
+  }
+  //interpolate the segment in the robot's configuration space
+  int d = compiledPath.dim;
+  Real u;
+  int i = compiledPath.Locate(t,u);
+  segStart.resize(d);
+  segEnd.resize(d);
+  segStart.copy(&compiledPath.milestones[i*d]);
+  segEnd.copy(&compiledPath.milestones[(i+1)*d]);
+  Interpolate(*pathViewer.robot,segStart,segEnd,u,q);
 }
 
 void ViewResource::RenderLinearPath(const LinearPathResource* rc,Real pathTime)
@@ -403,7 +444,7 @@ void ViewResource::RenderMultiPath(const MultiPathResource* rc,Real pathTime)
     normalizedPathTime = maxTime-(cnt-n)*(maxTime-minTime);
 
   Config q;
-  EvaluateMultiPath(*pathViewer.robot,rc->path,normalizedPathTime,q,pathIKResolution);
+  EvaluateMultiPathCached(rc,normalizedPathTime,q);
   pathViewer.robot->UpdateConfig(q);
   pathViewer.Draw();
   pathViewer.robot->UpdateConfig(oldq);
@@ -2,6 +2,7 @@
 #define VIEW_RESOURCE_H
 
 #include "Modeling/Resources.h"
+#include "Modeling/CompiledPath.h"
 #include "View/ViewRobot.h"
 #include "View/ViewStance.h"
 #include "View/ViewGrasp.h"
@@ -20,10 +21,22 @@ class ViewResource
   void GetAnimConfig(const ResourcePtr& r,Config& q);
   void GetLinearPathConfig(const LinearPathResource* rc,Real pathTime,Config& q);
   void GetMultiPathConfig(const MultiPathResource* path,Real pathTime,Config& q);
-
+  ///Evaluates the path at time t like EvaluateMultiPath, using a compiled
+  ///copy of the path that is kept until another path is played back or the
+  ///resource changes
+  void EvaluateMultiPathCached(const MultiPathResource* path,Real t,Config& q);
 
   ViewRobot configViewer,configsViewer;
   ViewRobot pathViewer; Real pathTime;
+  TimeCursor linearPathCursor;
+  ///The path compiled by EvaluateMultiPathCached, and the version of the
+  ///resource it was compiled from (see MultiPathResource::version)
+  int compiledVersion;
+  CompiledPath compiledPath;
+  MultiPath::InterpPolicy compiledPolicy;
+  size_t compiledSections;
+  bool compiledHasIK;
+  Config segStart,segEnd;
   Real pathIKResolution;
   ViewHold holdViewer;
   ViewStance stanceViewer;
@@ -0,0 +1,163 @@
+#include <../Modeling/BatchKinematics.h>
+#include <../Modeling/Robot.h>
+#include <gtest/gtest.h>
+#include <string.h>
+#include <algorithm>
+
+class testBatchKinematics: public ::testing::Test
+{
+protected:
+    Robot robot;
+    int N,n;
+    vector<Real> qs;
+
+    testBatchKinematics()
+    {
+        robot.Load("data/robots/athlete.rob");
+        n = (int)robot.links.size();
+        N = 150;
+        //deterministic configurations spread over the joint limits
+        qs.resize(N*n);
+        unsigned int state = 3;
+        for(int i=0;i<N;i++) {
+            for(int j=0;j<n;j++) {
+                state = state*1103515245u + 12345u;
+                Real u = Real((state>>8)&0xffff)/65535.0;
+                Real a = Max(robot.qMin(j),-2.0), b = Min(robot.qMax(j),2.0);
+                qs[i*n+j] = a + u*(b-a);
+            }
+        }
+    }
+
+    void AddQueries(BatchKinematics& batch)
+    {
+        batch.AddQuery(5);
+        batch.AddQuery(11,Vector3(0.1,0,-0.2));
+        batch.AddQuery(23,Vector3(0,0.05,0.3));
+        batch.AddQuery(9);
+    }
+};
+
+TEST_F(testBatchKinematics, testTransformsMatchUpdateFrames)
+{
+    BatchKinematics batch(robot);
+    AddQueries(batch);
+    batch.numThreads = 4;
+    batch.blockSize = 7;
+    int nq = batch.NumQueries();
+    vector<Real> T(N*nq*16);
+    batch.Transforms(&qs[0],N,&T[0]);
+    Config q(n);
+    for(int i=0;i<N;i++) {
+        q.copy(&qs[i*n]);
+        robot.UpdateConfig(q);
+        for(int k=0;k<nq;k++) {
+            const RigidTransform& Tref = robot.links[batch.links[k]].T_World;
+            const Real* Tk = &T[(i*nq+k)*16];
+            for(int r=0;r<3;r++) {
+                for(int c=0;c<3;c++)
+                    EXPECT_NEAR(Tk[r*4+c],Tref.R(r,c),1e-12);
+                EXPECT_NEAR(Tk[r*4+3],Tref.t[r],1e-12);
+                EXPECT_EQ(Tk[12+r],0.0);
+            }
+            EXPECT_EQ(Tk[15],1.0);
+        }
+    }
+}
+
+TEST_F(testBatchKinematics, testJacobiansMatchUpdateFrames)
+{
+    BatchKinematics batch(robot);
+    AddQueries(batch);
+    batch.numThreads = 4;
+    batch.blockSize = 7;
+    int nq = batch.NumQueries();
+    vector<Real> J(N*nq*6*n);
+    batch.Jacobians(&qs[0],N,&J[0]);
+    Config q(n);
+    Matrix Jref;
+    for(int i=0;i<N;i++) {
+        q.copy(&qs[i*n]);
+        robot.UpdateConfig(q);
+        for(int k=0;k<nq;k++) {
+            robot.GetFullJacobian(batch.points[k],batch.links[k],Jref);
+            const Real* Jk = &J[(i*nq+k)*6*n];
+            for(int r=0;r<6;r++)
+                for(int c=0;c<n;c++)
+                    EXPECT_NEAR(Jk[r*n+c],Jref(r,c),1e-12);
+        }
+    }
+}
+
+TEST_F(testBatchKinematics, testThreadCountIndependence)
+{
+    BatchKinematics serial(robot),parallel(robot);
+    AddQueries(serial);
+    AddQueries(parallel);
+    serial.numThreads = 1;
+    parallel.numThreads = 0;
+    parallel.blockSize = 5;
+    int nq = serial.NumQueries();
+    vector<Real> T1(N*nq*16),T2(N*nq*16);
+    serial.Transforms(&qs[0],N,&T1[0]);
+    parallel.Transforms(&qs[0],N,&T2[0]);
+    EXPECT_EQ(memcmp(&T1[0],&T2[0],T1.size()*sizeof(Real)),0);
+    vector<Real> J1(N*nq*6*n),J2(N*nq*6*n);
+    serial.Jacobians(&qs[0],N,&J1[0]);
+    parallel.Jacobians(&qs[0],N,&J2[0]);
+    EXPECT_EQ(memcmp(&J1[0],&J2[0],J1.size()*sizeof(Real)),0);
+}
+
+TEST_F(testBatchKinematics, testSmallBatchesAndReuse)
+{
+    BatchKinematics serial(robot),batch;
+    AddQueries(serial);
+    AddQueries(batch);
+    serial.numThreads = 1;
+    batch.numThreads = 4;
+    batch.blockSize = 64;
+    int nq = serial.NumQueries();
+    vector<Real> T1(N*nq*16),T2(N*nq*16);
+    serial.Transforms(&qs[0],N,&T1[0]);
+    //a single block runs on the calling thread without any copies
+    batch.SetRobot(robot);
+    batch.Transforms(&qs[0],1,&T2[0]);
+    EXPECT_TRUE(batch.threadRobots.empty());
+    EXPECT_EQ(memcmp(&T1[0],&T2[0],nq*16*sizeof(Real)),0);
+    batch.Transforms(&qs[0],0,&T2[0]);
+    //a kept batch is refreshed by SetRobot, and its copies are reused
+    batch.blockSize = 5;
+    batch.Transforms(&qs[0],N,&T2[0]);
+    EXPECT_EQ(batch.threadRobots.size(),3u);
+    EXPECT_EQ(memcmp(&T1[0],&T2[0],T1.size()*sizeof(Real)),0);
+    Robot moved = robot;
+    moved.qMin.set(0.0);
+    batch.SetRobot(moved);
+    batch.Transforms(&qs[0],N,&T2[0]);
+    EXPECT_EQ(batch.threadRobots.size(),3u);
+    EXPECT_EQ(memcmp(&T1[0],&T2[0],T1.size()*sizeof(Real)),0);
+    for(size_t i=0;i<batch.threadRobots.size();i++)
+        EXPECT_EQ(batch.threadRobots[i].qMin(0),0.0);
+}
+
+TEST_F(testBatchKinematics, testUpdateOrder)
+{
+    BatchKinematics batch(robot);
+    batch.AddQuery(11);
+    //link 11 and its ancestors, parents first
+    ASSERT_EQ(batch.updateOrder.size(),12u);
+    for(size_t i=0;i<batch.updateOrder.size();i++) {
+        int p = robot.parents[batch.updateOrder[i]];
+        if(p < 0) continue;
+        vector<int>::iterator it = find(batch.updateOrder.begin(),batch.updateOrder.begin()+i,p);
+        EXPECT_TRUE(it != batch.updateOrder.begin()+i);
+    }
+    batch.ClearQueries();
+    EXPECT_EQ(batch.NumQueries(),0);
+    EXPECT_TRUE(batch.updateOrder.empty());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
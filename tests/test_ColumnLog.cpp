@@ -0,0 +1,184 @@
+#include <../IO/ColumnLog.h>
+#include <gtest/gtest.h>
+#include <string.h>
+#include <math.h>
+#include <limits>
+
+const static char* kLogFile = "test_ColumnLog.klog";
+
+static bool SameBits(double a,double b) { return memcmp(&a,&b,sizeof(double))==0; }
+
+//a mix of slowly varying, constant, noisy, and special values
+static void MakeRows(int numRows,int numColumns,vector<vector<double> >& rows)
+{
+    rows.resize(numRows);
+    unsigned int state = 1;
+    for(int i=0;i<numRows;i++) {
+        rows[i].resize(numColumns);
+        for(int j=0;j<numColumns;j++) {
+            state = state*1103515245u + 12345u;
+            switch(j%4) {
+            case 0: rows[i][j] = i*0.001; break;
+            case 1: rows[i][j] = 2.5; break;
+            case 2: rows[i][j] = sin(i*0.01*j) + double(state)*1e-12; break;
+            default: rows[i][j] = (i%7==0 ? -0.0 : double(state)); break;
+            }
+        }
+    }
+    rows[numRows/2][0] = numeric_limits<double>::infinity();
+    rows[numRows/2][1] = numeric_limits<double>::quiet_NaN();
+    rows[numRows/2][2] = numeric_limits<double>::denorm_min();
+}
+
+static void ExpectSameRows(const vector<vector<double> >& a,const vector<vector<double> >& b,int numRows)
+{
+    ASSERT_EQ((int)b.size(),numRows);
+    for(int i=0;i<numRows;i++) {
+        ASSERT_EQ(a[i].size(),b[i].size());
+        for(size_t j=0;j<a[i].size();j++)
+            EXPECT_TRUE(SameBits(a[i][j],b[i][j])) << "row " << i << " column " << j;
+    }
+}
+
+TEST(testColumnLog, testEncodeDecode)
+{
+    vector<vector<double> > rows;
+    MakeRows(500,4,rows);
+    vector<double> flat;
+    for(size_t i=0;i<rows.size();i++)
+        flat.insert(flat.end(),rows[i].begin(),rows[i].end());
+    for(int j=0;j<4;j++) {
+        vector<unsigned char> data;
+        EncodeColumn(&flat[j],(int)rows.size(),4,data);
+        vector<double> values;
+        ASSERT_TRUE(DecodeColumn(&data[0],(int)data.size(),(int)rows.size(),values));
+        ASSERT_EQ(values.size(),rows.size());
+        for(size_t i=0;i<rows.size();i++)
+            EXPECT_TRUE(SameBits(values[i],rows[i][j]));
+    }
+    //a constant column takes about a byte per value
+    vector<unsigned char> data;
+    vector<double> constant(100,2.5);
+    EncodeColumn(&constant[0],100,1,data);
+    EXPECT_LE(data.size(),110u);
+}
+
+TEST(testColumnLog, testCorruptColumn)
+{
+    double values[5] = {1,2,3,3,-4.5};
+    vector<unsigned char> data;
+    EncodeColumn(values,5,1,data);
+    vector<double> out;
+    //too few or too many bytes, or too many values requested
+    EXPECT_FALSE(DecodeColumn(&data[0],(int)data.size()-1,5,out));
+    out.clear();
+    EXPECT_FALSE(DecodeColumn(&data[0],(int)data.size(),6,out));
+    out.clear();
+    EXPECT_FALSE(DecodeColumn(&data[0],(int)data.size(),4,out));
+    //a control byte with too many zero bytes
+    unsigned char bad[2] = {0x53,0};
+    out.clear();
+    EXPECT_FALSE(DecodeColumn(bad,2,1,out));
+    out.clear();
+    ASSERT_TRUE(DecodeColumn(&data[0],(int)data.size(),5,out));
+    for(int i=0;i<5;i++) EXPECT_EQ(out[i],values[i]);
+}
+
+TEST(testColumnLog, testWriteRead)
+{
+    vector<string> names;
+    names.push_back("time");
+    names.push_back("q[0]");
+    names.push_back("q[1]");
+    names.push_back("force");
+    names.push_back("torque");
+    vector<vector<double> > rows;
+    MakeRows(2345,5,rows);
+    ColumnLogWriter writer;
+    ASSERT_TRUE(writer.Open(kLogFile,names,"{\"robot\":\"test\"}",100));
+    for(size_t i=0;i<rows.size();i++) {
+        writer.Append(rows[i]);
+        if(i == 1000) writer.Flush();
+    }
+    writer.Close();
+
+    ColumnLogReader reader;
+    ASSERT_TRUE(reader.Open(kLogFile));
+    EXPECT_EQ(reader.NumRows(),(int)rows.size());
+    EXPECT_EQ(reader.NumColumns(),5);
+    EXPECT_TRUE(reader.columnNames == names);
+    EXPECT_EQ(reader.metadata,"{\"robot\":\"test\"}");
+    EXPECT_EQ(reader.ColumnIndex("force"),3);
+    EXPECT_EQ(reader.ColumnIndex("missing"),-1);
+    vector<vector<double> > readRows;
+    ASSERT_TRUE(reader.ReadRows(readRows));
+    ExpectSameRows(rows,readRows,(int)rows.size());
+    vector<double> column;
+    ASSERT_TRUE(reader.ReadColumn(2,column));
+    ASSERT_EQ(column.size(),rows.size());
+    for(size_t i=0;i<rows.size();i++)
+        EXPECT_TRUE(SameBits(column[i],rows[i][2]));
+    reader.Close();
+    remove(kLogFile);
+}
+
+TEST(testColumnLog, testBoundedQueue)
+{
+    //many small chunks with room for only one in the queue
+    vector<string> names(2,"x");
+    vector<vector<double> > rows;
+    MakeRows(3000,2,rows);
+    ColumnLogWriter writer;
+    writer.maxQueuedChunks = 1;
+    ASSERT_TRUE(writer.Open(kLogFile,names,"",10));
+    for(size_t i=0;i<rows.size();i++)
+        writer.Append(rows[i]);
+    writer.Close();
+
+    ColumnLogReader reader;
+    ASSERT_TRUE(reader.Open(kLogFile));
+    vector<vector<double> > readRows;
+    ASSERT_TRUE(reader.ReadRows(readRows));
+    ExpectSameRows(rows,readRows,(int)rows.size());
+    reader.Close();
+    remove(kLogFile);
+}
+
+TEST(testColumnLog, testTruncatedLog)
+{
+    vector<string> names(3,"x");
+    vector<vector<double> > rows;
+    MakeRows(1000,3,rows);
+    ColumnLogWriter writer;
+    ASSERT_TRUE(writer.Open(kLogFile,names,"",256));
+    for(size_t i=0;i<rows.size();i++)
+        writer.Append(rows[i]);
+    writer.Close();
+
+    //cut off the last chunk partway through
+    FILE* f = fopen(kLogFile,"rb");
+    ASSERT_TRUE(f != NULL);
+    vector<char> bytes;
+    char buf[4096];
+    size_t n;
+    while((n=fread(buf,1,sizeof(buf),f)) > 0) bytes.insert(bytes.end(),buf,buf+n);
+    fclose(f);
+    f = fopen(kLogFile,"wb");
+    ASSERT_TRUE(f != NULL);
+    fwrite(&bytes[0],1,bytes.size()-20,f);
+    fclose(f);
+
+    ColumnLogReader reader;
+    ASSERT_TRUE(reader.Open(kLogFile));
+    EXPECT_EQ(reader.NumRows(),768);
+    vector<vector<double> > readRows;
+    ASSERT_TRUE(reader.ReadRows(readRows));
+    ExpectSameRows(rows,readRows,768);
+    reader.Close();
+    remove(kLogFile);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,218 @@
+#include <../Modeling/CompiledPath.h>
+#include <../Modeling/Resources.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+
+//fills a section with m milestones of dimension n starting at time t0 (or
+//untimed if t0 < 0).  The first milestone is start, if given, so that
+//consecutive sections are continuous.
+static void MakeSection(MultiPath::PathSection& section,int seed,int m,int n,Real t0,bool velocities,const Vector* start=NULL)
+{
+    section.milestones.resize(m);
+    section.times.resize(0);
+    section.velocities.resize(0);
+    Real t = t0;
+    for(int j=0;j<m;j++) {
+        section.milestones[j].resize(n);
+        for(int k=0;k<n;k++)
+            section.milestones[j](k) = Sin(0.7*(seed+1)*j+1.3*k) + 0.1*k*j;
+        if(t0 >= 0) {
+            section.times.push_back(t);
+            //uneven segment durations
+            t += 0.2 + 0.15*((seed+j)%3);
+        }
+        if(velocities) {
+            section.velocities.push_back(Vector(n));
+            for(int k=0;k<n;k++)
+                section.velocities[j](k) = Cos(0.3*j+k+seed);
+        }
+    }
+    if(start) section.milestones[0] = *start;
+}
+
+static void MakePath(MultiPath& path,int numSections,bool timed,bool velocities)
+{
+    path.sections.resize(numSections);
+    Real t0 = (timed ? 0.5 : -1.0);
+    for(int s=0;s<numSections;s++) {
+        const Vector* start = (s > 0 ? &path.sections[s-1].milestones.back() : NULL);
+        MakeSection(path.sections[s],s,4+s,3,t0,velocities,start);
+        if(velocities && s > 0)
+            path.sections[s].velocities[0] = path.sections[s-1].velocities.back();
+        if(timed) t0 = path.sections[s].times.back();
+    }
+}
+
+//times strictly inside each segment of the compiled path, so that neither
+//implementation has to break a tie at a milestone
+static void InteriorTimes(const CompiledPath& compiled,vector<Real>& times)
+{
+    times.resize(0);
+    for(size_t i=0;i+1<compiled.times.size();i++) {
+        Real a = compiled.times[i], b = compiled.times[i+1];
+        if(b <= a) continue;
+        for(int k=1;k<10;k++)
+            times.push_back(a + 0.1*k*(b-a));
+    }
+}
+
+static void ExpectMatchesMultiPath(const MultiPath& path,MultiPath::InterpPolicy policy)
+{
+    CompiledPath compiled;
+    ASSERT_TRUE(compiled.Compile(path,policy));
+    vector<Real> times;
+    InteriorTimes(compiled,times);
+    ASSERT_FALSE(times.empty());
+    Vector q,v,cq,cv;
+    //forward, as in playback, then backward so the cursor has to search
+    for(int pass=0;pass<2;pass++) {
+        for(size_t i=0;i<times.size();i++) {
+            Real t = (pass==0 ? times[i] : times[times.size()-1-i]);
+            path.Evaluate(t,q,v,policy);
+            compiled.Eval(t,cq);
+            compiled.Deriv(t,cv);
+            ASSERT_EQ(cq.n,q.n);
+            ASSERT_EQ(cv.n,v.n);
+            for(int k=0;k<q.n;k++) {
+                EXPECT_NEAR(cq(k),q(k),1e-9) << "time " << t;
+                EXPECT_NEAR(cv(k),v(k),1e-7) << "time " << t;
+            }
+        }
+    }
+    //the milestones themselves
+    for(size_t i=0;i<compiled.times.size();i++) {
+        path.Evaluate(compiled.times[i],q,policy);
+        compiled.Eval(compiled.times[i],cq);
+        for(int k=0;k<q.n;k++)
+            EXPECT_NEAR(cq(k),q(k),1e-9) << "milestone " << i;
+    }
+    //clamped outside the path, with zero derivative
+    Real outside[2] = {compiled.StartTime()-1.0,compiled.EndTime()+1.0};
+    for(int i=0;i<2;i++) {
+        path.Evaluate(outside[i],q,policy);
+        compiled.Eval(outside[i],cq);
+        compiled.Deriv(outside[i],cv);
+        for(int k=0;k<q.n;k++) {
+            EXPECT_EQ(cq(k),q(k));
+            EXPECT_EQ(cv(k),0.0);
+        }
+    }
+}
+
+TEST(testCompiledPath, testTimedCubic)
+{
+    MultiPath path;
+    MakePath(path,3,true,false);
+    ExpectMatchesMultiPath(path,MultiPath::InterpCubic);
+}
+
+TEST(testCompiledPath, testTimedVelocities)
+{
+    MultiPath path;
+    MakePath(path,3,true,true);
+    ExpectMatchesMultiPath(path,MultiPath::InterpCubic);
+}
+
+TEST(testCompiledPath, testTimedLinear)
+{
+    MultiPath path;
+    MakePath(path,3,true,true);
+    ExpectMatchesMultiPath(path,MultiPath::InterpLinear);
+}
+
+TEST(testCompiledPath, testUntimed)
+{
+    MultiPath path;
+    MakePath(path,2,false,false);
+    ExpectMatchesMultiPath(path,MultiPath::InterpCubic);
+    ExpectMatchesMultiPath(path,MultiPath::InterpLinear);
+    MakePath(path,2,false,true);
+    ExpectMatchesMultiPath(path,MultiPath::InterpCubic);
+}
+
+TEST(testCompiledPath, testRejected)
+{
+    CompiledPath compiled;
+    MultiPath path;
+    EXPECT_FALSE(compiled.Compile(path));
+    //mixed timed and untimed sections
+    MakePath(path,2,true,false);
+    path.sections[1].times.resize(0);
+    EXPECT_FALSE(compiled.Compile(path));
+    EXPECT_TRUE(compiled.Empty());
+}
+
+TEST(testCompiledPath, testLinearPath)
+{
+    //Compile(times,milestones) is piecewise linear, like InterpLinear
+    MultiPath path;
+    MakePath(path,1,true,false);
+    CompiledPath compiled;
+    compiled.Compile(path.sections[0].times,path.sections[0].milestones);
+    EXPECT_TRUE(compiled.tangents.empty());
+    vector<Real> times;
+    InteriorTimes(compiled,times);
+    Vector q,v,cq,cv;
+    for(size_t i=0;i<times.size();i++) {
+        path.Evaluate(times[i],q,v,MultiPath::InterpLinear);
+        compiled.Eval(times[i],cq);
+        compiled.Deriv(times[i],cv);
+        for(int k=0;k<q.n;k++) {
+            EXPECT_NEAR(cq(k),q(k),1e-9);
+            EXPECT_NEAR(cv(k),v(k),1e-7);
+        }
+    }
+}
+
+TEST(testTimeCursor, testFind)
+{
+    //includes a zero-duration segment, as at a MultiPath section boundary
+    Real tvals[7] = {0.0,0.5,1.0,1.0,2.0,3.5,4.0};
+    vector<Real> times(tvals,tvals+7);
+    int last = (int)times.size()-2;
+    TimeCursor cursor;
+    vector<Real> queries;
+    for(int i=-5;i<=45;i++) queries.push_back(0.1*i);
+    for(size_t i=0;i<times.size();i++) queries.push_back(times[i]);
+    //forward, backward, then jumping around
+    for(int pass=0;pass<3;pass++) {
+        for(size_t i=0;i<queries.size();i++) {
+            size_t j = i;
+            if(pass == 1) j = queries.size()-1-i;
+            else if(pass == 2) j = (i*37)%queries.size();
+            Real t = queries[j];
+            int expected = (int)(upper_bound(times.begin(),times.end(),t)-times.begin())-1;
+            expected = Max(Min(expected,last),0);
+            EXPECT_EQ(cursor.Find(times,t),expected) << "time " << t;
+            EXPECT_EQ(cursor.segment,expected);
+        }
+    }
+}
+
+TEST(testMultiPathResource, testVersion)
+{
+    //the compiled path in ViewResource is keyed on the version, so a new
+    //resource at the address of a deleted one must not reuse it
+    MultiPathResource* a = new MultiPathResource;
+    int va = a->version;
+    delete a;
+    MultiPathResource b;
+    EXPECT_NE(b.version,va);
+    ResourcePtr c = b.Copy();
+    EXPECT_NE(dynamic_cast<MultiPathResource*>((ResourceBase*)c)->version,b.version);
+    int vb = b.version;
+    b.MarkChanged();
+    EXPECT_NE(b.version,vb);
+    vector<ResourcePtr> sections;
+    ConfigsResource* configs = new ConfigsResource;
+    configs->configs.resize(2,Vector(2,0.0));
+    sections.push_back(configs);
+    vb = b.version;
+    EXPECT_TRUE(b.Pack(sections));
+    EXPECT_NE(b.version,vb);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,233 @@
+#include <../Simulation/WorldSimulation.h>
+#include <gtest/gtest.h>
+
+//a contact list with n points whose values are derived from seed
+static void MakeContactList(int seed,int n,ODEContactList& list)
+{
+    list.points.resize(n);
+    list.forces.resize(n);
+    for(int i=0;i<n;i++) {
+        list.points[i].x.set(seed,i,0.5*seed);
+        list.points[i].n.set(0,0,1);
+        list.points[i].kFriction = 0.1*i;
+        list.forces[i].set(i,-seed,1);
+    }
+    list.penetrating = (seed%3 == 0);
+}
+
+static void ExpectSameContactList(const ODEContactList& a,const ODEContactList& b)
+{
+    ASSERT_EQ(a.points.size(),b.points.size());
+    ASSERT_EQ(b.points.size(),b.forces.size());
+    EXPECT_EQ(a.penetrating,b.penetrating);
+    for(size_t i=0;i<a.points.size();i++) {
+        EXPECT_EQ(a.points[i].x,b.points[i].x);
+        EXPECT_EQ(a.points[i].n,b.points[i].n);
+        EXPECT_EQ(a.points[i].kFriction,b.points[i].kFriction);
+        if(a.forces.empty()) EXPECT_EQ(b.forces[i],Vector3(0.0));
+        else EXPECT_EQ(a.forces[i],b.forces[i]);
+    }
+}
+
+static void ResetInfo(ContactFeedbackInfo& info)
+{
+    info.firstRecord = info.lastRecord = -1;
+    info.numRecords = 0;
+}
+
+TEST(testContactFeedbackPool, testInterleavedPairs)
+{
+    ContactFeedbackPool pool;
+    pool.Reserve(200,1000);
+    ContactFeedbackInfo infos[3];
+    vector<vector<ODEContactList> > added(3);
+    vector<vector<double> > addedTimes(3);
+    for(int k=0;k<3;k++) ResetInfo(infos[k]);
+    for(int step=0;step<50;step++) {
+        for(int k=0;k<3;k++) {
+            //pair 2 only records every other step
+            if(k == 2 && step%2 == 1) continue;
+            ODEContactList list;
+            MakeContactList(step*3+k,(step+k)%5,list);
+            //unsolved lists have no forces
+            if(step%7 == 0) list.forces.clear();
+            pool.Add(infos[k],0.01*step,list);
+            added[k].push_back(list);
+            addedTimes[k].push_back(0.01*step);
+        }
+    }
+    EXPECT_EQ(pool.numRecords,125);
+    EXPECT_EQ(pool.numDropped,0);
+    for(int k=0;k<3;k++) {
+        EXPECT_EQ(infos[k].numRecords,(int)added[k].size());
+        vector<double> times;
+        vector<ODEContactList> lists;
+        pool.GetTimes(infos[k],times);
+        pool.GetContactLists(infos[k],lists);
+        EXPECT_TRUE(times == addedTimes[k]);
+        ASSERT_EQ(lists.size(),added[k].size());
+        for(size_t i=0;i<lists.size();i++)
+            ExpectSameContactList(added[k][i],lists[i]);
+    }
+}
+
+TEST(testContactFeedbackPool, testOverwriteOldest)
+{
+    //room for 20 records or 30 points, so both limits are hit
+    ContactFeedbackPool pool;
+    pool.Reserve(20,30);
+    ContactFeedbackInfo infos[2];
+    vector<vector<ODEContactList> > added(2);
+    vector<vector<double> > addedTimes(2);
+    for(int k=0;k<2;k++) ResetInfo(infos[k]);
+    for(int step=0;step<100;step++) {
+        int k = (step%3 == 0 ? 1 : 0);
+        ODEContactList list;
+        MakeContactList(step,(step*7)%4,list);
+        pool.Add(infos[k],step,list);
+        added[k].push_back(list);
+        addedTimes[k].push_back(step);
+        EXPECT_LE(pool.numRecords,20);
+        EXPECT_LE(pool.pointsUsed,30);
+    }
+    EXPECT_EQ(pool.RecordCapacity(),20);
+    EXPECT_EQ(pool.PointCapacity(),30);
+    EXPECT_GT(pool.numDropped,0);
+    EXPECT_EQ(infos[0].numRecords+infos[1].numRecords,pool.numRecords);
+    EXPECT_EQ(pool.numRecords+pool.numDropped,100);
+    //each pair keeps its most recent records
+    for(int k=0;k<2;k++) {
+        vector<double> times;
+        vector<ODEContactList> lists;
+        pool.GetTimes(infos[k],times);
+        pool.GetContactLists(infos[k],lists);
+        ASSERT_EQ((int)times.size(),infos[k].numRecords);
+        ASSERT_GT(times.size(),0u);
+        size_t offset = added[k].size()-times.size();
+        for(size_t i=0;i<times.size();i++) {
+            EXPECT_EQ(times[i],addedTimes[k][offset+i]);
+            ExpectSameContactList(added[k][offset+i],lists[i]);
+        }
+    }
+    //a record larger than the pool is dropped
+    ODEContactList big;
+    MakeContactList(1,31,big);
+    int n = pool.numRecords;
+    pool.Add(infos[0],100,big);
+    EXPECT_EQ(pool.numRecords,n);
+    //one that fills the pool replaces everything
+    MakeContactList(2,30,big);
+    pool.Add(infos[0],101,big);
+    EXPECT_EQ(pool.numRecords,1);
+    EXPECT_EQ(infos[0].numRecords,1);
+    EXPECT_EQ(infos[1].numRecords,0);
+    EXPECT_EQ(infos[1].firstRecord,-1);
+    EXPECT_EQ(infos[1].lastRecord,-1);
+}
+
+TEST(testContactFeedbackPool, testReuse)
+{
+    ContactFeedbackPool pool;
+    pool.Reserve(5000,20000);
+    const ContactFeedbackRecord* records = &pool.records[0];
+    const ContactPoint* points = &pool.points[0];
+    ContactFeedbackInfo info;
+    ODEContactList list;
+    MakeContactList(1,4,list);
+    for(int pass=0;pass<3;pass++) {
+        pool.Clear();
+        ResetInfo(info);
+        for(int i=0;i<5000;i++)
+            pool.Add(info,i,list);
+        EXPECT_EQ(info.numRecords,5000);
+        EXPECT_EQ(pool.pointsUsed,20000);
+        EXPECT_EQ(pool.numDropped,0);
+    }
+    //the pool is never resized
+    EXPECT_EQ(&pool.records[0],records);
+    EXPECT_EQ(&pool.points[0],points);
+    vector<ODEContactList> lists;
+    pool.GetContactLists(info,lists);
+    ExpectSameContactList(list,lists.back());
+}
+
+//a block dropped onto a plane, recording full contact feedback
+class testContactFeedbackSim: public ::testing::Test
+{
+protected:
+    RobotWorld world;
+    int objectID,terrainID;
+
+    testContactFeedbackSim()
+    {
+        world.LoadTerrain("data/terrains/plane.off");
+        world.LoadRigidObject("data/objects/block.obj");
+        world.rigidObjects[0]->T.t.z = 0.4;
+        objectID = world.RigidObjectID(0);
+        terrainID = world.TerrainID(0);
+    }
+
+    void Setup(WorldSimulation& sim)
+    {
+        sim.Init(&world);
+        sim.EnableContactFeedback(objectID,terrainID,true,true);
+    }
+};
+
+TEST_F(testContactFeedbackSim, testHistory)
+{
+    WorldSimulation sim;
+    Setup(sim);
+    int numContactSteps = 0;
+    for(int iters=0;iters<20;iters++) {
+        Real t0 = sim.time;
+        sim.Advance(0.02);
+        ContactFeedbackInfo* info = sim.GetContactFeedback(objectID,terrainID);
+        ASSERT_TRUE(info != NULL);
+        vector<Real> times;
+        vector<ODEContactList> lists;
+        ASSERT_TRUE(sim.GetContactFeedbackHistory(objectID,terrainID,times,lists));
+        ASSERT_EQ(times.size(),lists.size());
+        EXPECT_EQ(info->numRecords,(int)times.size());
+        //one record per sub-step
+        EXPECT_EQ(info->contactCount+info->separationCount,info->numRecords);
+        int contacts = 0;
+        for(size_t i=0;i<times.size();i++) {
+            EXPECT_GT(times[i],t0);
+            EXPECT_LE(times[i],sim.time+1e-9);
+            if(i > 0) EXPECT_GT(times[i],times[i-1]);
+            if(!lists[i].forces.empty()) contacts++;
+        }
+        EXPECT_EQ(contacts,info->contactCount);
+        numContactSteps += contacts;
+    }
+    //the block must have landed
+    EXPECT_GT(numContactSteps,0);
+}
+
+TEST_F(testContactFeedbackSim, testSaveState)
+{
+    WorldSimulation sim;
+    Setup(sim);
+    for(int iters=0;iters<15;iters++)
+        sim.Advance(0.02);
+    string state;
+    ASSERT_TRUE(sim.WriteState(state));
+
+    WorldSimulation sim2;
+    Setup(sim2);
+    ASSERT_TRUE(sim2.ReadState(state));
+    vector<Real> times,times2;
+    vector<ODEContactList> lists,lists2;
+    ASSERT_TRUE(sim.GetContactFeedbackHistory(objectID,terrainID,times,lists));
+    ASSERT_TRUE(sim2.GetContactFeedbackHistory(objectID,terrainID,times2,lists2));
+    EXPECT_TRUE(times == times2);
+    ASSERT_EQ(lists.size(),lists2.size());
+    for(size_t i=0;i<lists.size();i++)
+        ExpectSameContactList(lists[i],lists2[i]);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
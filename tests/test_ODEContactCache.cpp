@@ -0,0 +1,144 @@
+#include <ode/ode.h>
+#include <../Simulation/ODECustomGeometry.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+
+//a contact as a sortable tuple: position, normal, depth
+typedef vector<double> ContactKey;
+
+static void GetContactKeys(const dContactGeom* contacts,int n,vector<ContactKey>& keys)
+{
+    keys.resize(n);
+    for(int i=0;i<n;i++) {
+        keys[i].resize(7);
+        for(int k=0;k<3;k++) {
+            keys[i][k] = contacts[i].pos[k];
+            keys[i][3+k] = contacts[i].normal[k];
+        }
+        keys[i][6] = contacts[i].depth;
+    }
+}
+
+class testODEContactCache: public ::testing::Test
+{
+protected:
+    AnyCollisionGeometry3D mesh1,mesh2;
+    dGeomID geom1,geom2;
+    CustomGeometryContactCache cache;
+    vector<dContactGeom> contacts;
+
+    testODEContactCache()
+    {
+        mesh1.Load("data/objects/cube.off");
+        mesh2.Load("data/objects/cube.off");
+        geom1 = dCreateCustomGeometry(&mesh1,0.01);
+        geom2 = dCreateCustomGeometry(&mesh2,0.01);
+        contacts.resize(1000);
+    }
+
+    virtual ~testODEContactCache() {
+        dGeomDestroy(geom1);
+        dGeomDestroy(geom2);
+    }
+
+    virtual void SetUp() {
+        //cube 2 rests on top of cube 1, slightly tilted so that the closest
+        //points of each triangle pair are unique
+        dGeomSetPosition(geom1,0,0,0);
+        dMatrix3 R;
+        dRFromAxisAndAngle(R,1,0.5,0,0.01);
+        dGeomSetRotation(geom2,R);
+        MoveTo(0.5,0.3,1.005);
+    }
+
+    void MoveTo(double x,double y,double z) {
+        dGeomSetPosition(geom2,x,y,z);
+        dCustomGeometryUpdate(geom1);
+        dCustomGeometryUpdate(geom2);
+    }
+
+    //if swapped, the pair is passed in the order (geom2,geom1), as the
+    //broadphase may report it
+    int Collide(bool cached,bool& meshesIntersect,vector<ContactKey>& keys,bool swapped=false) {
+        meshesIntersect = false;
+        dGeomID a = (swapped ? geom2 : geom1), b = (swapped ? geom1 : geom2);
+        int n = dCustomGeometryCollideReentrant(a,b,(int)contacts.size(),&contacts[0],meshesIntersect,(cached ? &cache : NULL));
+        GetContactKeys(&contacts[0],n,keys);
+        return n;
+    }
+
+    //compares the cached and uncached queries.  The contacts are compared
+    //as sets, up to rounding, since the cached query may find the same
+    //triangle pairs in a different order
+    void ExpectSameContacts(bool swapped=false) {
+        vector<ContactKey> uncached,cached;
+        bool intersect1,intersect2;
+        int n1 = Collide(false,intersect1,uncached,swapped);
+        int n2 = Collide(true,intersect2,cached,swapped);
+        EXPECT_EQ(intersect1,intersect2);
+        ASSERT_EQ(n1,n2);
+        sort(uncached.begin(),uncached.end());
+        sort(cached.begin(),cached.end());
+        for(int i=0;i<n1;i++)
+            for(int k=0;k<7;k++)
+                EXPECT_NEAR(uncached[i][k],cached[i][k],1e-6);
+    }
+};
+
+TEST_F(testODEContactCache, testFullQueryMatches)
+{
+    //the first query fills the cache, and must return the uncached result
+    ExpectSameContacts();
+    vector<ContactKey> keys;
+    bool intersect;
+    EXPECT_GT(Collide(false,intersect,keys),0);
+}
+
+TEST_F(testODEContactCache, testCachedQueryMatches)
+{
+    ExpectSameContacts();
+    //small motions (within the slack) re-check the cached candidates
+    MoveTo(0.505,0.3,1.005);
+    ExpectSameContacts();
+    MoveTo(0.505,0.305,1.003);
+    ExpectSameContacts();
+    //larger motions rebuild the cache with a full query
+    MoveTo(0.2,0.3,1.005);
+    ExpectSameContacts();
+}
+
+TEST_F(testODEContactCache, testSwappedOrder)
+{
+    //the cache is filled with the pair in one order...
+    ExpectSameContacts();
+    //...and reused and refreshed with the pair in the other
+    MoveTo(0.505,0.3,1.005);
+    ExpectSameContacts(true);
+    MoveTo(0.2,0.3,1.005);
+    ExpectSameContacts(true);
+    MoveTo(0.205,0.3,1.004);
+    ExpectSameContacts();
+    ExpectSameContacts(true);
+}
+
+TEST_F(testODEContactCache, testSeparation)
+{
+    ExpectSameContacts();
+    MoveTo(0.5,0.3,1.5);
+    vector<ContactKey> keys;
+    bool intersect;
+    EXPECT_EQ(Collide(true,intersect,keys),0);
+    EXPECT_EQ(Collide(false,intersect,keys),0);
+    MoveTo(0.5,0.3,1.005);
+    ExpectSameContacts();
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  //the custom geometry class may only be registered once
+  dInitODE();
+  InitODECustomGeometry();
+  int res = RUN_ALL_TESTS();
+  dCloseODE();
+  return res;
+}
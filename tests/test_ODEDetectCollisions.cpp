@@ -0,0 +1,75 @@
+#include <../Simulation/ODESimulator.h>
+#include <gtest/gtest.h>
+
+//a row of touching blocks resting on a plane, with a second layer on top
+class testODEDetectCollisions: public ::testing::Test
+{
+protected:
+    Terrain terrain;
+    vector<RigidObject> objects;
+
+    testODEDetectCollisions()
+    {
+        terrain.Load("data/terrains/plane.off");
+        objects.resize(8);
+        for(size_t i=0;i<objects.size();i++) {
+            objects[i].Load("data/objects/block.obj");
+            int layer = (i < 5 ? 0 : 1);
+            int col = (i < 5 ? (int)i : (int)i-5);
+            //0.4 blocks, slightly interpenetrating their neighbors
+            Math3D::Matrix3 R;
+            R.setRotateZ(0.01*i);
+            objects[i].T.R = R;
+            objects[i].T.t.set(0.399*col + 0.2*layer, 0.003*i, 0.199 + 0.399*layer);
+        }
+    }
+
+    void Setup(ODESimulator& sim,int numThreads)
+    {
+        sim.GetSettings().numCollisionThreads = numThreads;
+        sim.AddTerrain(terrain);
+        for(size_t i=0;i<objects.size();i++)
+            sim.AddObject(objects[i]);
+    }
+};
+
+static void ExpectSameContacts(ODESimulator& a,ODESimulator& b)
+{
+    ASSERT_EQ(a.contactResults.size(),b.contactResults.size());
+    list<ODEContactResult>::const_iterator i=a.contactResults.begin(),j=b.contactResults.begin();
+    for(;i!=a.contactResults.end();++i,++j) {
+        //geom IDs differ between simulators, but their data identifies the object
+        EXPECT_EQ(dGeomGetData(i->o1),dGeomGetData(j->o1));
+        EXPECT_EQ(dGeomGetData(i->o2),dGeomGetData(j->o2));
+        EXPECT_EQ(i->meshOverlap,j->meshOverlap);
+        ASSERT_EQ(i->contacts.size(),j->contacts.size());
+        for(size_t k=0;k<i->contacts.size();k++) {
+            for(int m=0;m<3;m++) {
+                EXPECT_EQ(i->contacts[k].pos[m],j->contacts[k].pos[m]);
+                EXPECT_EQ(i->contacts[k].normal[m],j->contacts[k].normal[m]);
+            }
+            EXPECT_EQ(i->contacts[k].depth,j->contacts[k].depth);
+        }
+    }
+}
+
+TEST_F(testODEDetectCollisions, testThreadCountIndependence)
+{
+    ODESimulator serial;
+    Setup(serial,1);
+    serial.DetectCollisions();
+    ASSERT_GT(serial.contactResults.size(),objects.size());
+
+    int threadCounts[3] = {2,4,0};
+    for(int k=0;k<3;k++) {
+        ODESimulator parallel;
+        Setup(parallel,threadCounts[k]);
+        parallel.DetectCollisions();
+        ExpectSameContacts(serial,parallel);
+    }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,138 @@
+#include <../Planning/RobotCSpace.h>
+#include <KrisLibrary/math/random.h>
+#include <gtest/gtest.h>
+#include <math.h>
+
+//the ATHLETE robot on a plane, with a few blocks around it
+class testParallelEdgeChecker: public ::testing::Test
+{
+protected:
+    RobotWorld world;
+    WorldPlannerSettings settings;
+
+    testParallelEdgeChecker()
+    {
+        world.LoadXML("data/athlete_plane.xml");
+        for(int i=0;i<4;i++) {
+            int index = world.LoadRigidObject("data/objects/block.obj");
+            world.rigidObjects[index]->T.t.set(1.2*cos(i*Pi/2),1.2*sin(i*Pi/2),0.3);
+        }
+        world.InitCollisions();
+        world.UpdateGeometry();
+        settings.InitializeDefault(world);
+        //keep the floating base near the obstacles
+        settings.robotSettings[0].worldBounds.bmin.set(-1.5,-1.5,0.5);
+        settings.robotSettings[0].worldBounds.bmax.set(1.5,1.5,2.0);
+        Math::Srand(1234);
+    }
+
+    //samples edges that start at feasible configurations and end a
+    //random distance away
+    void SampleEdges(SingleRobotCSpace& space,int numEdges,vector<pair<Config,Config> >& edges)
+    {
+        Config a,b;
+        for(int i=0;i<numEdges;i++) {
+            for(int iters=0;iters<1000;iters++) {
+                space.Sample(a);
+                if(space.IsFeasible(a)) break;
+            }
+            space.SampleNeighborhood(a,0.05+0.05*i,b);
+            edges.push_back(pair<Config,Config>(a,b));
+        }
+    }
+};
+
+TEST_F(testParallelEdgeChecker, testMatchesEpsilonEdgeChecker)
+{
+    SingleRobotCSpace space(world,0,&settings);
+    Real epsilon = settings.robotSettings[0].collisionEpsilon;
+    vector<pair<Config,Config> > edges;
+    SampleEdges(space,60,edges);
+    int numVisible = 0;
+    int threadCounts[3] = {2,4,8};
+    for(size_t i=0;i<edges.size();i++) {
+        EpsilonEdgeChecker serial(&space,edges[i].first,edges[i].second,epsilon);
+        bool visible = serial.IsVisible();
+        if(visible) numVisible++;
+        for(int k=0;k<3;k++) {
+            ParallelEdgeChecker parallel(&space,edges[i].first,edges[i].second,epsilon,threadCounts[k]);
+            EXPECT_EQ(parallel.IsVisible(),visible) << "edge " << i << ", " << threadCounts[k] << " threads";
+        }
+    }
+    //make sure both outcomes are exercised
+    EXPECT_GT(numVisible,0);
+    EXPECT_LT(numVisible,(int)edges.size());
+}
+
+TEST_F(testParallelEdgeChecker, testReverseAndCopy)
+{
+    SingleRobotCSpace space(world,0,&settings);
+    Real epsilon = settings.robotSettings[0].collisionEpsilon;
+    vector<pair<Config,Config> > edges;
+    SampleEdges(space,20,edges);
+    for(size_t i=0;i<edges.size();i++) {
+        ParallelEdgeChecker parallel(&space,edges[i].first,edges[i].second,epsilon,4);
+        bool visible = parallel.IsVisible();
+        SmartPointer<EdgePlanner> copy = parallel.Copy();
+        SmartPointer<EdgePlanner> reverse = parallel.ReverseCopy();
+        EXPECT_EQ(copy->IsVisible(),visible);
+        EXPECT_TRUE(reverse->Start().isEqual(edges[i].second,0));
+        EXPECT_TRUE(reverse->End().isEqual(edges[i].first,0));
+        EpsilonEdgeChecker serialReverse(&space,edges[i].second,edges[i].first,epsilon);
+        EXPECT_EQ(reverse->IsVisible(),serialReverse.IsVisible());
+    }
+}
+
+TEST_F(testParallelEdgeChecker, testPathCheckerSetting)
+{
+    SingleRobotCSpace space(world,0,&settings);
+    Config a=world.robots[0]->q,b=world.robots[0]->q;
+    b(0) += 0.1;
+    SmartPointer<EdgePlanner> e = space.PathChecker(a,b);
+    EXPECT_TRUE(dynamic_cast<EpsilonEdgeChecker*>(&*e) != NULL);
+    settings.robotSettings[0].numEdgeCheckThreads = 4;
+    e = space.PathChecker(a,b);
+    ParallelEdgeChecker* pe = dynamic_cast<ParallelEdgeChecker*>(&*e);
+    ASSERT_TRUE(pe != NULL);
+    EXPECT_EQ(pe->numThreads,4);
+}
+
+TEST_F(testParallelEdgeChecker, testSettingsAndGeometryChanges)
+{
+    SingleRobotCSpace space(world,0,&settings);
+    Real epsilon = settings.robotSettings[0].collisionEpsilon;
+    vector<pair<Config,Config> > edges;
+    SampleEdges(space,30,edges);
+    for(size_t i=0;i<edges.size();i++) {
+        ParallelEdgeChecker parallel(&space,edges[i].first,edges[i].second,epsilon,4);
+        parallel.IsVisible();
+    }
+    //collisions with the blocks are disabled after the thread data exists
+    Robot* robot = world.robots[0];
+    for(size_t j=0;j<world.rigidObjects.size();j++) {
+        int obj = world.RigidObjectID(j);
+        for(size_t k=0;k<robot->links.size();k++) {
+            int link = world.RobotLinkID(0,k);
+            settings.collisionEnabled(obj,link) = settings.collisionEnabled(link,obj) = false;
+        }
+    }
+    //and a link's geometry is replaced
+    int link = -1;
+    for(size_t k=0;k<robot->links.size() && link < 0;k++)
+        if(!robot->IsGeometryEmpty(k)) link = (int)k;
+    ASSERT_GE(link,0);
+    robot->geometry[link] = new Geometry::AnyCollisionGeometry3D(*robot->geometry[link]);
+    world.UpdateGeometry();
+    for(size_t i=0;i<edges.size();i++) {
+        EpsilonEdgeChecker serial(&space,edges[i].first,edges[i].second,epsilon);
+        ParallelEdgeChecker parallel(&space,edges[i].first,edges[i].second,epsilon,4);
+        EXPECT_EQ(parallel.IsVisible(),serial.IsVisible()) << "edge " << i;
+    }
+    for(size_t i=0;i<space.threadData.size();i++)
+        EXPECT_EQ(space.threadData[i]->source[link],&*robot->geometry[link]);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
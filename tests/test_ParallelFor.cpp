@@ -0,0 +1,91 @@
+#include <../Modeling/ParallelFor.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <gtest/gtest.h>
+#include <vector>
+using namespace std;
+
+//counts how often each index runs and on which thread
+struct CountBody : public ParallelForBody
+{
+    CountBody(int n,int numThreads) : counts(n,0),threads(n,-1),begun(numThreads,0),ended(numThreads,0) {}
+    virtual void BeginThread(int thread) { begun[thread]++; }
+    virtual void EndThread(int thread) { ended[thread]++; }
+    virtual void Run(int index,int thread) {
+        counts[index]++;
+        threads[index] = thread;
+    }
+    vector<int> counts,threads,begun,ended;
+};
+
+//runs a nested ParallelFor inside each item
+struct NestedBody : public ParallelForBody
+{
+    NestedBody(int n,int m) : inner(n,CountBody(m,4)) {}
+    virtual void Run(int index,int thread) {
+        ParallelFor((int)inner[index].counts.size(),inner[index],4);
+    }
+    vector<CountBody> inner;
+};
+
+static void* caller_thread_func(void* ptr)
+{
+    CountBody* body = reinterpret_cast<CountBody*>(ptr);
+    for(int iters=0;iters<200;iters++)
+        ParallelFor((int)body->counts.size()/200,*body,4);
+    return NULL;
+}
+
+TEST(testParallelFor, testEachIndexOnce)
+{
+    for(int numThreads=1;numThreads<=8;numThreads++) {
+        //repeated calls reuse the pool's threads
+        for(int iters=0;iters<50;iters++) {
+            CountBody body(1000,numThreads);
+            ParallelFor(1000,body,numThreads);
+            for(int i=0;i<1000;i++) {
+                ASSERT_EQ(body.counts[i],1);
+                ASSERT_GE(body.threads[i],0);
+                ASSERT_LT(body.threads[i],numThreads);
+            }
+            EXPECT_EQ(body.begun[0],0);
+            for(int t=1;t<numThreads;t++) {
+                EXPECT_EQ(body.begun[t],1);
+                EXPECT_EQ(body.ended[t],1);
+            }
+        }
+    }
+    CountBody empty(0,4);
+    ParallelFor(0,empty,4);
+}
+
+TEST(testParallelFor, testNested)
+{
+    NestedBody body(16,100);
+    ParallelFor(16,body,4);
+    for(size_t i=0;i<body.inner.size();i++) {
+        for(size_t j=0;j<body.inner[i].counts.size();j++) {
+            EXPECT_EQ(body.inner[i].counts[j],1);
+            //nested calls run serially on the calling worker
+            EXPECT_EQ(body.inner[i].threads[j],0);
+        }
+    }
+}
+
+TEST(testParallelFor, testConcurrentCallers)
+{
+    //calls from several threads take turns on the pool
+    vector<CountBody> bodies(4,CountBody(200*50,4));
+    vector<Thread> threads(bodies.size());
+    for(size_t i=0;i<bodies.size();i++)
+        threads[i] = ThreadStart(caller_thread_func,&bodies[i]);
+    for(size_t i=0;i<bodies.size();i++)
+        ThreadJoin(threads[i]);
+    for(size_t i=0;i<bodies.size();i++)
+        for(int j=0;j<50;j++)
+            EXPECT_EQ(bodies[i].counts[j],200);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
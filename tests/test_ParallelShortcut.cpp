@@ -0,0 +1,125 @@
+#include <../Modeling/DynamicPath.h>
+#include <gtest/gtest.h>
+using namespace ParabolicRamp;
+
+//a linear congruential generator, so that separate runs see the same numbers
+class SeededRNG : public RandomNumberGeneratorBase
+{
+ public:
+  SeededRNG(unsigned int seed) : state(seed) {}
+  virtual Real Rand() {
+    state = (state*1103515245u + 12345u) & 0x7fffffff;
+    return Real(state)/Real(0x80000000u);
+  }
+  unsigned int state;
+};
+
+//the plane minus a disk of radius 0.25 centered at (0.5,0.5)
+class DiskObstacleChecker : public FeasibilityCheckerBase
+{
+ public:
+  virtual bool ConfigFeasible(const Vector& x) {
+    return Math::Sqr(x[0]-0.5)+Math::Sqr(x[1]-0.5) > Math::Sqr(0.25);
+  }
+  virtual bool SegmentFeasible(const Vector& a,const Vector& b) {
+    //closest point on the segment to the center
+    Real dx=b[0]-a[0],dy=b[1]-a[1];
+    Real len2 = dx*dx+dy*dy;
+    Real u = (len2 == 0 ? 0 : ((0.5-a[0])*dx+(0.5-a[1])*dy)/len2);
+    u = Math::Clamp(u,0.0,1.0);
+    Vector x(2);
+    x[0] = a[0]+u*dx;
+    x[1] = a[1]+u*dy;
+    return ConfigFeasible(x);
+  }
+};
+
+class testParallelShortcut: public ::testing::Test
+{
+protected:
+    DynamicPath path;
+    DiskObstacleChecker feas;
+
+    testParallelShortcut()
+    {
+        path.Init(Vector(2,1.0),Vector(2,2.0));
+        //a winding path around the obstacle
+        Real pts[8][2] = {{0,0},{0.1,0.9},{0.5,1.1},{0.9,0.95},{1.1,0.5},{0.9,0.1},{0.5,-0.1},{1,-0.2}};
+        vector<Vector> milestones(8,Vector(2));
+        for(int i=0;i<8;i++) {
+            milestones[i][0] = pts[i][0];
+            milestones[i][1] = pts[i][1];
+        }
+        path.SetMilestones(milestones);
+    }
+
+    static void ExpectSamePath(const DynamicPath& a,const DynamicPath& b)
+    {
+        ASSERT_EQ(a.ramps.size(),b.ramps.size());
+        for(size_t i=0;i<a.ramps.size();i++) {
+            EXPECT_TRUE(a.ramps[i].x0 == b.ramps[i].x0);
+            EXPECT_TRUE(a.ramps[i].dx0 == b.ramps[i].dx0);
+            EXPECT_TRUE(a.ramps[i].x1 == b.ramps[i].x1);
+            EXPECT_TRUE(a.ramps[i].dx1 == b.ramps[i].dx1);
+            EXPECT_EQ(a.ramps[i].endTime,b.ramps[i].endTime);
+        }
+    }
+
+    void ExpectFeasible(const DynamicPath& p)
+    {
+        RampFeasibilityChecker check(&feas,1e-3);
+        EXPECT_TRUE(p.IsValid());
+        for(size_t i=0;i<p.ramps.size();i++)
+            EXPECT_TRUE(check.Check(p.ramps[i]));
+        EXPECT_TRUE(p.StartConfig() == path.StartConfig());
+        EXPECT_TRUE(p.EndConfig() == path.EndConfig());
+    }
+};
+
+TEST_F(testParallelShortcut, testOneCheckerMatchesShortcut)
+{
+    unsigned int seeds[3] = {1,42,12345};
+    for(int s=0;s<3;s++) {
+        RampFeasibilityChecker check(&feas,1e-3);
+        DynamicPath serial = path, parallel = path;
+        SeededRNG rng1(seeds[s]),rng2(seeds[s]);
+        int n1 = serial.Shortcut(100,check,&rng1);
+        vector<RampFeasibilityChecker*> checks(1,&check);
+        ShortcutStats stats;
+        int n2 = parallel.ParallelShortcut(100,checks,&rng2,&stats);
+        EXPECT_EQ(n1,n2);
+        EXPECT_GT(n1,0);
+        ExpectSamePath(serial,parallel);
+        EXPECT_EQ(stats.numShortcuts,n2);
+        EXPECT_EQ(stats.numConflicts,0);
+        EXPECT_EQ(rng1.state,rng2.state);
+    }
+}
+
+TEST_F(testParallelShortcut, testSeveralCheckers)
+{
+    vector<RampFeasibilityChecker> checkers(4,RampFeasibilityChecker(&feas,1e-3));
+    vector<RampFeasibilityChecker*> checks(4);
+    for(int i=0;i<4;i++) checks[i] = &checkers[i];
+    DynamicPath a = path, b = path;
+    SeededRNG rng1(7),rng2(7);
+    ShortcutStats stats;
+    int n = a.ParallelShortcut(200,checks,&rng1,&stats);
+    //the result does not depend on thread timing
+    b.ParallelShortcut(200,checks,&rng2);
+    ExpectSamePath(a,b);
+    ExpectFeasible(a);
+    EXPECT_GT(n,0);
+    EXPECT_LT(a.GetTotalTime(),path.GetTotalTime());
+    EXPECT_EQ(stats.numShortcuts,n);
+    EXPECT_GE(stats.numFeasible,stats.numShortcuts+stats.numConflicts);
+    //overlapping candidates are re-checked rather than dropped
+    EXPECT_GT(stats.numConflicts,0);
+    EXPECT_LE(stats.numCandidates,200+stats.numConflicts);
+    EXPECT_LE(stats.numCandidates,4*stats.numBatches);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
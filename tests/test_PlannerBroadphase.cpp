@@ -0,0 +1,171 @@
+#include <../Planning/PlannerSettings.h>
+#include <../Modeling/World.h>
+#include <gtest/gtest.h>
+#include <math.h>
+#include <set>
+
+//two rows of blocks over a plane that drift in and out of contact
+class testPlannerBroadphase: public ::testing::Test
+{
+protected:
+    RobotWorld world;
+    WorldPlannerSettings settings;
+    vector<int> ids;
+
+    testPlannerBroadphase()
+    {
+        world.LoadTerrain("data/terrains/plane.off");
+        for(int i=0;i<10;i++)
+            world.LoadRigidObject("data/objects/block.obj");
+        world.InitCollisions();
+        settings.InitializeDefault(world);
+        for(size_t i=0;i<world.rigidObjects.size();i++)
+            ids.push_back(world.RigidObjectID(i));
+        ids.push_back(world.TerrainID(0));
+    }
+
+    void MoveObjects(int step)
+    {
+        //every third step spreads the blocks apart
+        Real spacing = (step%3 == 0 ? 0.6 : 0.35);
+        for(size_t i=0;i<world.rigidObjects.size();i++) {
+            RigidObject* obj = world.rigidObjects[i];
+            obj->T.R.setRotateZ(0.05*step*i);
+            obj->T.t.set(spacing*(i%5) + 0.1*sin(0.3*step+i),
+                         spacing*(i/5) + 0.1*cos(0.2*step+2*i),
+                         0.21 + 0.02*sin(0.1*step*i));
+        }
+        world.UpdateGeometry();
+    }
+
+    //all enabled pairs (a,b) in ids1 x ids2 that collide, with a < b
+    void BruteForceCollisions(const vector<int>& ids1,const vector<int>& ids2,Real tol,set<pair<int,int> >& pairs)
+    {
+        pairs.clear();
+        for(size_t i=0;i<ids1.size();i++) {
+            for(size_t j=0;j<ids2.size();j++) {
+                int a=ids1[i],b=ids2[j];
+                if(a == b) continue;
+                if(!settings.collisionEnabled(a,b) && !settings.collisionEnabled(b,a)) continue;
+                Geometry::AnyCollisionQuery q(*world.GetGeometry(a),*world.GetGeometry(b));
+                if(tol == 0 ? q.Collide() : q.WithinDistance(tol))
+                    pairs.insert(pair<int,int>(Min(a,b),Max(a,b)));
+            }
+        }
+    }
+
+    void ExpectSameResult(pair<int,int> res,const set<pair<int,int> >& pairs)
+    {
+        if(pairs.empty()) {
+            EXPECT_EQ(res.first,-1);
+            EXPECT_EQ(res.second,-1);
+            return;
+        }
+        ASSERT_GE(res.first,0);
+        EXPECT_EQ(pairs.count(pair<int,int>(Min(res.first,res.second),Max(res.first,res.second))),1u);
+    }
+
+    //a persistent broadphase must be sorted, hold current boxes, and
+    //have no query sets left marked
+    void ExpectValidBroadphase(const CollisionBroadphase* broadphase=NULL)
+    {
+        const CollisionBroadphase& bp = (broadphase ? *broadphase : settings.broadphase);
+        EXPECT_EQ(bp.inUse,0);
+        for(size_t i=0;i<bp.order.size();i++) {
+            const CollisionBroadphase::Item& item = bp.items[bp.order[i]];
+            if(i > 0) EXPECT_LE(bp.items[bp.order[i-1]].bb.bmin.x,item.bb.bmin.x);
+            AABB3D bb = item.geometry->GetAABB();
+            EXPECT_EQ(item.bb.bmin,bb.bmin);
+            EXPECT_EQ(item.bb.bmax,bb.bmax);
+            EXPECT_EQ(item.mask,0);
+        }
+    }
+};
+
+TEST_F(testPlannerBroadphase, testSelfCollisionSet)
+{
+    Real tols[2] = {0,0.02};
+    int numColliding = 0;
+    for(int step=0;step<30;step++) {
+        MoveObjects(step);
+        for(int k=0;k<2;k++) {
+            set<pair<int,int> > pairs;
+            BruteForceCollisions(ids,ids,tols[k],pairs);
+            ExpectSameResult(settings.CheckCollision(world,ids,tols[k]),pairs);
+            ExpectValidBroadphase();
+            if(!pairs.empty()) numColliding++;
+        }
+    }
+    //make sure both outcomes are exercised
+    EXPECT_GT(numColliding,0);
+    EXPECT_LT(numColliding,60);
+}
+
+TEST_F(testPlannerBroadphase, testTwoSets)
+{
+    vector<int> ids1(ids.begin(),ids.begin()+5);
+    vector<int> ids2(ids.begin()+5,ids.end());
+    for(int step=0;step<30;step++) {
+        MoveObjects(step);
+        set<pair<int,int> > pairs;
+        BruteForceCollisions(ids1,ids2,0.02,pairs);
+        ExpectSameResult(settings.CheckCollision(world,ids1,ids2,0.02),pairs);
+        ExpectValidBroadphase();
+        //the within-set pairs of ids1 must not be reported
+        BruteForceCollisions(ids1,ids1,0.02,pairs);
+        ExpectSameResult(settings.CheckCollision(world,ids1,0.02),pairs);
+    }
+}
+
+TEST_F(testPlannerBroadphase, testDisabledPairs)
+{
+    MoveObjects(1);
+    set<pair<int,int> > pairs;
+    BruteForceCollisions(ids,ids,0,pairs);
+    ASSERT_FALSE(pairs.empty());
+    //disable each colliding pair in turn until nothing is left
+    while(!pairs.empty()) {
+        pair<int,int> p = *pairs.begin();
+        settings.collisionEnabled(p.first,p.second) = false;
+        settings.collisionEnabled(p.second,p.first) = false;
+        BruteForceCollisions(ids,ids,0,pairs);
+        ExpectSameResult(settings.CheckCollision(world,ids,0),pairs);
+    }
+}
+
+TEST_F(testPlannerBroadphase, testCallerBroadphase)
+{
+    //a caller's own broadphase is used instead of the settings' one
+    CollisionBroadphase bp;
+    for(int step=0;step<10;step++) {
+        MoveObjects(step);
+        set<pair<int,int> > pairs;
+        BruteForceCollisions(ids,ids,0,pairs);
+        ExpectSameResult(settings.CheckCollision(world,ids,0,&bp),pairs);
+        ExpectValidBroadphase(&bp);
+    }
+    EXPECT_FALSE(bp.order.empty());
+    EXPECT_TRUE(settings.broadphase.order.empty());
+}
+
+TEST_F(testPlannerBroadphase, testCopiesStartEmpty)
+{
+    MoveObjects(0);
+    settings.CheckCollision(world,ids,0);
+    ASSERT_FALSE(settings.broadphase.order.empty());
+    //a copy made while the broadphase is in use must not inherit the flag
+    settings.broadphase.inUse = 1;
+    WorldPlannerSettings copy = settings;
+    settings.broadphase.inUse = 0;
+    EXPECT_EQ(copy.broadphase.inUse,0);
+    EXPECT_TRUE(copy.broadphase.order.empty());
+    set<pair<int,int> > pairs;
+    BruteForceCollisions(ids,ids,0,pairs);
+    ExpectSameResult(copy.CheckCollision(world,ids,0),pairs);
+    EXPECT_FALSE(copy.broadphase.order.empty());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,39 @@
+#include <../Modeling/RandomStream.h>
+#include <gtest/gtest.h>
+
+TEST(testRandomStream, testSameSeedSameSequence)
+{
+    RandomStream a(42),b(42),c(43);
+    bool differs = false;
+    for(int i=0;i<100;i++) {
+        unsigned long long x = a.RandInt64();
+        EXPECT_EQ(x,b.RandInt64());
+        if(x != c.RandInt64()) differs = true;
+    }
+    EXPECT_TRUE(differs);
+    a.Seed(42);
+    b.Seed(42);
+    for(int i=0;i<100;i++)
+        EXPECT_EQ(a.RandGaussian(),b.RandGaussian());
+}
+
+TEST(testRandomStream, testRanges)
+{
+    RandomStream rng(7);
+    double sum = 0;
+    for(int i=0;i<10000;i++) {
+        double u = rng.Rand();
+        EXPECT_GE(u,0.0);
+        EXPECT_LT(u,1.0);
+        double v = rng.Rand(-2.0,3.0);
+        EXPECT_GE(v,-2.0);
+        EXPECT_LT(v,3.0);
+        sum += u;
+    }
+    EXPECT_NEAR(sum/10000,0.5,0.02);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,148 @@
+#include <../Planning/RealTimePlanner.h>
+#include <../Interface/RobotInterface.h>
+#include <gtest/gtest.h>
+
+//a motion queue that accepts or rejects every path, at a fixed time
+class FakeMotionQueue : public MotionQueueInterface
+{
+public:
+    FakeMotionQueue() : time(1.0),result(Success),numPaths(0) {}
+    virtual bool HadExternalChange() { return false; }
+    virtual Real GetCurTime() { return time; }
+    virtual void GetCurConfig(Config& x) {}
+    virtual void GetCurVelocity(Config& dx) {}
+    virtual Real GetEndTime() { return time; }
+    virtual void GetEndConfig(Config& x) {}
+    virtual void GetEndVelocity(Config& dx) {}
+    virtual void GetConfig(Real t,Config& x) {}
+    virtual MotionResult SendMilestone(const Config& x) { return result; }
+    virtual MotionResult SendMilestoneImmediate(const Config& x) { return result; }
+    virtual MotionResult SendPathImmediate(Real tbreak,const ParabolicRamp::DynamicPath& path) {
+        numPaths++;
+        return result;
+    }
+
+    Real time;
+    MotionResult result;
+    int numPaths;
+};
+
+//calls the planner's send callback from another thread, as the planning
+//thread would
+struct SendRequest
+{
+    SendPathCallbackBase* callback;
+    Real tplanstart,tcut;
+    bool result;
+};
+
+static void* sender_thread_func(void* ptr)
+{
+    SendRequest* req = reinterpret_cast<SendRequest*>(ptr);
+    ParabolicRamp::DynamicPath path;
+    req->result = req->callback->Send(req->tplanstart,req->tcut,path);
+    return NULL;
+}
+
+class testRealTimePlanningThread: public ::testing::Test
+{
+protected:
+    RealTimePlanningThread thread;
+    FakeMotionQueue queue;
+
+    testRealTimePlanningThread()
+    {
+        thread.SetPlanner(SmartPointer<RealTimePlanner>(new RealTimePlanner));
+    }
+
+    Thread StartSend(SendRequest& req,Real tplanstart) {
+        req.callback = thread.planner->sendPathCallback;
+        req.tplanstart = tplanstart;
+        req.tcut = 0.1;
+        req.result = false;
+        return ThreadStart(sender_thread_func,&req);
+    }
+
+    void WaitForUpdate() {
+        while(!thread.HasUpdate()) ThreadSleep(0.001);
+    }
+};
+
+TEST_F(testRealTimePlanningThread, testSendUpdate)
+{
+    EXPECT_FALSE(thread.HasUpdate());
+    EXPECT_FALSE(thread.SendUpdate(&queue));
+    EXPECT_EQ(queue.numPaths,0);
+
+    SendRequest req;
+    Thread sender = StartSend(req,0.75);
+    WaitForUpdate();
+    //the update stays pending until it is sent
+    EXPECT_TRUE(thread.HasUpdate());
+    EXPECT_TRUE(thread.SendUpdate(&queue));
+    ThreadJoin(sender);
+    EXPECT_TRUE(req.result);
+    EXPECT_EQ(queue.numPaths,1);
+    EXPECT_FALSE(thread.HasUpdate());
+    EXPECT_EQ(thread.sendDelays.stats.number(),1);
+    EXPECT_NEAR(thread.sendDelays.stats.mean(),0.25,1e-9);
+    EXPECT_EQ(thread.overrunDelays.stats.number(),0);
+
+    //a rejected path is reported to the planner as a failed send
+    queue.result = MotionQueueInterface::FailedCheck;
+    sender = StartSend(req,0.5);
+    WaitForUpdate();
+    EXPECT_FALSE(thread.SendUpdate(&queue));
+    ThreadJoin(sender);
+    EXPECT_FALSE(req.result);
+    EXPECT_EQ(queue.numPaths,2);
+    EXPECT_EQ(thread.sendDelays.stats.number(),1);
+    EXPECT_EQ(thread.overrunDelays.stats.number(),1);
+    EXPECT_NEAR(thread.overrunDelays.stats.mean(),0.5,1e-9);
+}
+
+TEST_F(testRealTimePlanningThread, testStopReleasesSender)
+{
+    ASSERT_TRUE(thread.Start());
+    SendRequest req;
+    Thread sender = StartSend(req,0.5);
+    WaitForUpdate();
+    //nobody calls SendUpdate, so only Stop can release the sender
+    thread.Stop();
+    ThreadJoin(sender);
+    EXPECT_FALSE(req.result);
+    EXPECT_EQ(queue.numPaths,0);
+
+    //the update left over from the last run is dropped on restart
+    ASSERT_TRUE(thread.Start());
+    EXPECT_FALSE(thread.HasUpdate());
+    EXPECT_FALSE(thread.SendUpdate(&queue));
+    thread.Stop();
+}
+
+TEST(testLatencyHistogram, testBins)
+{
+    LatencyHistogram hist(0.1,5);
+    hist.Add(0.05);
+    hist.Add(0.15);
+    hist.Add(0.17);
+    //out of range values go to the first and last bins
+    hist.Add(-1.0);
+    hist.Add(10.0);
+    ASSERT_EQ(hist.counts.size(),5u);
+    EXPECT_EQ(hist.counts[0],2);
+    EXPECT_EQ(hist.counts[1],2);
+    EXPECT_EQ(hist.counts[2],0);
+    EXPECT_EQ(hist.counts[4],1);
+    EXPECT_EQ(hist.stats.number(),5);
+    EXPECT_NEAR(hist.stats.maximum(),10.0,1e-9);
+    hist.Clear();
+    EXPECT_EQ(hist.stats.number(),0);
+    for(size_t i=0;i<hist.counts.size();i++)
+        EXPECT_EQ(hist.counts[i],0);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
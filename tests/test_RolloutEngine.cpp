@@ -0,0 +1,213 @@
+#include <../Simulation/RolloutEngine.h>
+#include <../Control/JointSensors.h>
+#include <gtest/gtest.h>
+#include <string.h>
+
+//drops the robot from a random height with a random leg pose and noisy
+//encoders
+class DropTask : public RolloutTask
+{
+ public:
+  virtual void MetricNames(vector<string>& names) const {
+    names.resize(3);
+    names[0] = "height";
+    names[1] = "hip";
+    names[2] = "encoders";
+  }
+  virtual void Setup(int index,RandomStream& rng,WorldSimulation& sim) {
+    Config q;
+    sim.odesim.robot(0)->GetConfig(q);
+    q(2) += rng.Rand(0.0,0.2);
+    q(7) += rng.Rand(-0.1,0.1);
+    sim.odesim.robot(0)->SetConfig(q);
+    JointPositionSensor* s = sim.controlSimulators[0].sensors.GetTypedSensor<JointPositionSensor>();
+    if(s) s->qvariance.resize(q.n,1e-4);
+  }
+  virtual void Evaluate(int index,WorldSimulation& sim,vector<double>& metrics) {
+    Config q;
+    sim.odesim.robot(0)->GetConfig(q);
+    metrics.resize(3);
+    metrics[0] = q(2);
+    metrics[1] = q(7);
+    metrics[2] = 0;
+    JointPositionSensor* s = sim.controlSimulators[0].sensors.GetTypedSensor<JointPositionSensor>();
+    if(s) {
+      vector<double> values;
+      s->GetMeasurements(values);
+      for(size_t i=0;i<values.size();i++) metrics[2] += values[i];
+    }
+  }
+};
+
+//records some of the model parameters that the rollout starts with, then
+//changes them
+class EditModelTask : public RolloutTask
+{
+ public:
+  EditModelTask(int numRollouts) : masses(numRollouts),qmaxs(numRollouts),frictions(numRollouts) {}
+  virtual void Setup(int index,RandomStream& rng,WorldSimulation& sim) {
+    Robot* robot = sim.world->robots[0];
+    masses[index] = robot->links[6].mass;
+    qmaxs[index] = robot->qMax(7);
+    robot->links[6].mass *= 2;
+    robot->qMax(7) = 0;
+    Terrain* terrain = sim.world->terrains[0];
+    frictions[index] = (terrain->kFriction.empty() ? 0 : terrain->kFriction[0]);
+    terrain->SetUniformFriction(frictions[index]+1);
+  }
+  virtual void Evaluate(int index,WorldSimulation& sim,vector<double>& metrics) {
+    metrics.resize(3);
+    metrics[0] = masses[index];
+    metrics[1] = qmaxs[index];
+    metrics[2] = frictions[index];
+  }
+  vector<double> masses,qmaxs,frictions;
+};
+
+static bool SameBits(double a,double b) { return memcmp(&a,&b,sizeof(double))==0; }
+
+static void ExpectSameResults(const RolloutEngine& a,const RolloutEngine& b)
+{
+    ASSERT_EQ(a.metrics.size(),b.metrics.size());
+    EXPECT_TRUE(a.seeds == b.seeds);
+    for(size_t i=0;i<a.metrics.size();i++) {
+        ASSERT_EQ(a.metrics[i].size(),b.metrics[i].size());
+        for(size_t j=0;j<a.metrics[i].size();j++)
+            EXPECT_TRUE(SameBits(a.metrics[i][j],b.metrics[i][j])) << "rollout " << i << " metric " << j;
+        EXPECT_EQ(a.endTimes[i],b.endTimes[i]);
+        EXPECT_EQ(a.statuses[i],b.statuses[i]);
+    }
+    ASSERT_EQ(a.stats.size(),b.stats.size());
+    for(size_t j=0;j<a.stats.size();j++) {
+        EXPECT_TRUE(SameBits(a.stats[j].mean(),b.stats[j].mean()));
+        EXPECT_TRUE(SameBits(a.stats[j].variance(),b.stats[j].variance()));
+    }
+}
+
+class testRolloutEngine: public ::testing::Test
+{
+protected:
+    DropTask task;
+
+    void Run(RolloutEngine& engine,int numThreads,unsigned long long seed)
+    {
+        ASSERT_TRUE(engine.Init("data/athlete_plane.xml"));
+        engine.duration = 0.2;
+        engine.dt = 0.02;
+        engine.baseSeed = seed;
+        engine.numThreads = numThreads;
+        ASSERT_TRUE(engine.Run(task,6));
+    }
+};
+
+TEST_F(testRolloutEngine, testReproducible)
+{
+    RolloutEngine a,b;
+    Run(a,1,100);
+    Run(b,1,100);
+    ExpectSameResults(a,b);
+    EXPECT_EQ(a.metricNames.size(),3u);
+    ASSERT_EQ(a.metrics.size(),6u);
+    //different rollouts get different random conditions
+    EXPECT_NE(a.metrics[0][0],a.metrics[1][0]);
+    EXPECT_NE(a.metrics[0][2],a.metrics[1][2]);
+}
+
+TEST_F(testRolloutEngine, testThreadCountIndependence)
+{
+    RolloutEngine serial,parallel;
+    Run(serial,1,7);
+    Run(parallel,3,7);
+    ExpectSameResults(serial,parallel);
+}
+
+TEST_F(testRolloutEngine, testSeeds)
+{
+    //rollout i depends only on baseSeed+i
+    RolloutEngine a,b;
+    Run(a,2,10);
+    Run(b,2,12);
+    for(size_t i=0;i+2<a.metrics.size();i++)
+        for(size_t j=0;j<a.metrics[i].size();j++)
+            EXPECT_TRUE(SameBits(a.metrics[i+2][j],b.metrics[i][j]));
+}
+
+TEST_F(testRolloutEngine, testInitFromWorld)
+{
+    RolloutEngine fromFile,fromWorld;
+    Run(fromFile,2,3);
+    {
+        RobotWorld world;
+        ASSERT_TRUE(world.LoadXML("data/athlete_plane.xml"));
+        fromWorld.Init(world);
+        //the engine has its own copy
+        world.robots[0]->q(2) += 1.0;
+        world.robots[0]->UpdateFrames();
+    }
+    fromWorld.duration = 0.2;
+    fromWorld.dt = 0.02;
+    fromWorld.baseSeed = 3;
+    fromWorld.numThreads = 2;
+    ASSERT_TRUE(fromWorld.Run(task,6));
+    ExpectSameResults(fromFile,fromWorld);
+}
+
+TEST_F(testRolloutEngine, testModelRestored)
+{
+    //each thread runs several rollouts, and the edits of one rollout must
+    //not be seen by the next
+    RolloutEngine engine;
+    ASSERT_TRUE(engine.Init("data/athlete_plane.xml"));
+    engine.duration = 0.02;
+    engine.dt = 0.02;
+    engine.numThreads = 2;
+    EditModelTask edit(6);
+    ASSERT_TRUE(engine.Run(edit,6));
+    const Robot& robot = *engine.initialWorld->robots[0];
+    Real friction = (engine.initialWorld->terrains[0]->kFriction.empty() ? 0 : engine.initialWorld->terrains[0]->kFriction[0]);
+    for(int i=0;i<6;i++) {
+        EXPECT_EQ(edit.masses[i],robot.links[6].mass);
+        EXPECT_EQ(edit.qmaxs[i],robot.qMax(7));
+        EXPECT_EQ(edit.frictions[i],friction);
+    }
+    //the threads do not share geometries with each other or the initial
+    //world.  There is only one thread if ODE is not thread safe.
+    ASSERT_GE(engine.workers.size(),1u);
+    for(size_t j=0;j<robot.geometry.size();j++) {
+        if(!robot.geometry[j]) continue;
+        const Geometry::AnyCollisionGeometry3D* g0 = &*robot.geometry[j];
+        const Geometry::AnyCollisionGeometry3D* g1 = &*engine.workers[0]->world.robots[0]->geometry[j];
+        EXPECT_TRUE(g0 != g1);
+        if(engine.workers.size() > 1) {
+            const Geometry::AnyCollisionGeometry3D* g2 = &*engine.workers[1]->world.robots[0]->geometry[j];
+            EXPECT_TRUE(g0 != g2 && g1 != g2);
+        }
+    }
+}
+
+TEST(testRandomStream, testSequence)
+{
+    RandomStream a(0),b(0),c(1);
+    //the first SplitMix64 output for seed 0
+    EXPECT_EQ(a.RandInt64(),0xE220A8397B1DCDAFULL);
+    b.RandInt64();
+    bool differs = false;
+    for(int i=0;i<100;i++) {
+        EXPECT_EQ(a.RandInt64(),b.RandInt64());
+        double x = c.Rand();
+        EXPECT_GE(x,0.0);
+        EXPECT_LT(x,1.0);
+        if(a.Rand() != x) differs = true;
+        b.Rand();
+    }
+    EXPECT_TRUE(differs);
+    a.Seed(5);
+    b.Seed(5);
+    for(int i=0;i<100;i++)
+        EXPECT_EQ(a.RandGaussian(),b.RandGaussian());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
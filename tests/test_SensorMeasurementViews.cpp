@@ -0,0 +1,132 @@
+#include <../Control/Sensor.h>
+#include <../Control/VisualSensors.h>
+#include <gtest/gtest.h>
+
+static const SensorMeasurementView* FindView(const vector<SensorMeasurementView>& views,const char* name)
+{
+    for(size_t i=0;i<views.size();i++)
+        if(views[i].name == name) return &views[i];
+    return NULL;
+}
+
+class testSensorMeasurementViews: public ::testing::Test
+{
+protected:
+    CameraSensor camera;
+    vector<double> measurements;
+
+    testSensorMeasurementViews()
+    {
+        camera.rgb = true;
+        camera.depth = true;
+        camera.xres = 4;
+        camera.yres = 3;
+        //colors packed as 0xAABBGGRR, then depths
+        int n = camera.xres*camera.yres;
+        measurements.resize(2*n);
+        for(int i=0;i<n;i++) {
+            unsigned int r=i, g=2*i, b=255-i;
+            measurements[i] = double(0xff000000 | (b << 16) | (g << 8) | r);
+            measurements[n+i] = 0.5*i;
+        }
+        camera.SetMeasurements(measurements);
+    }
+};
+
+TEST_F(testSensorMeasurementViews, testCameraViews)
+{
+    vector<SensorMeasurementView> views;
+    camera.GetMeasurementViews(views);
+    ASSERT_EQ(views.size(),2u);
+
+    const SensorMeasurementView* rgb = FindView(views,"rgb");
+    ASSERT_TRUE(rgb != NULL);
+    EXPECT_EQ(rgb->type,(int)SensorMeasurementView::UInt8);
+    ASSERT_EQ(rgb->shape.size(),3u);
+    EXPECT_EQ(rgb->shape[0],3);
+    EXPECT_EQ(rgb->shape[1],4);
+    EXPECT_EQ(rgb->shape[2],3);
+    EXPECT_EQ(rgb->NumElements()*rgb->ElementSize(),36);
+    //the view shares the sensor's storage
+    EXPECT_EQ(rgb->data,(const void*)&camera.rgbImage[0]);
+    const unsigned char* pix = (const unsigned char*)rgb->data;
+    for(int i=0;i<12;i++) {
+        EXPECT_EQ(pix[i*3],i);
+        EXPECT_EQ(pix[i*3+1],2*i);
+        EXPECT_EQ(pix[i*3+2],255-i);
+    }
+
+    const SensorMeasurementView* depth = FindView(views,"depth");
+    ASSERT_TRUE(depth != NULL);
+    EXPECT_EQ(depth->type,(int)SensorMeasurementView::Float32);
+    ASSERT_EQ(depth->shape.size(),2u);
+    EXPECT_EQ(depth->shape[0],3);
+    EXPECT_EQ(depth->shape[1],4);
+    EXPECT_EQ(depth->ElementSize(),(int)sizeof(float));
+    EXPECT_EQ(depth->data,(const void*)&camera.depthImage[0]);
+    const float* d = (const float*)depth->data;
+    for(int i=0;i<12;i++)
+        EXPECT_EQ(d[i],0.5f*i);
+}
+
+TEST_F(testSensorMeasurementViews, testCameraRoundTrip)
+{
+    //the views hold the same data as the measurement list, packed as 0xAABBGGRR
+    vector<double> values;
+    camera.GetMeasurements(values);
+    ASSERT_EQ(values.size(),measurements.size());
+    for(size_t i=0;i<values.size();i++)
+        EXPECT_EQ(values[i],measurements[i]);
+}
+
+TEST_F(testSensorMeasurementViews, testCameraDisabledChannel)
+{
+    camera.depth = false;
+    camera.SetMeasurements(measurements);
+    vector<SensorMeasurementView> views;
+    camera.GetMeasurementViews(views);
+    ASSERT_EQ(views.size(),1u);
+    EXPECT_EQ(views[0].name,"rgb");
+}
+
+TEST_F(testSensorMeasurementViews, testLaserView)
+{
+    LaserRangeSensor laser;
+    vector<SensorMeasurementView> views;
+    laser.GetMeasurementViews(views);
+    EXPECT_TRUE(views.empty());
+    vector<double> readings(5);
+    for(int i=0;i<5;i++) readings[i] = 1.0+i;
+    laser.SetMeasurements(readings);
+    laser.GetMeasurementViews(views);
+    ASSERT_EQ(views.size(),1u);
+    EXPECT_EQ(views[0].name,"depth");
+    EXPECT_EQ(views[0].type,(int)SensorMeasurementView::Float64);
+    ASSERT_EQ(views[0].shape.size(),1u);
+    EXPECT_EQ(views[0].shape[0],5);
+    EXPECT_EQ(views[0].data,(const void*)&laser.depthReadings[0]);
+}
+
+TEST_F(testSensorMeasurementViews, testDefaultView)
+{
+    //sensors without their own views expose the measurement list
+    JointPositionSensor sensor;
+    vector<double> q(3);
+    q[0] = 1; q[1] = 2; q[2] = 3;
+    sensor.SetMeasurements(q);
+    vector<SensorMeasurementView> views;
+    sensor.GetMeasurementViews(views);
+    ASSERT_EQ(views.size(),1u);
+    EXPECT_EQ(views[0].name,"measurements");
+    EXPECT_EQ(views[0].type,(int)SensorMeasurementView::Float64);
+    ASSERT_EQ(views[0].shape.size(),1u);
+    EXPECT_EQ(views[0].shape[0],3);
+    const double* data = (const double*)views[0].data;
+    for(int i=0;i<3;i++)
+        EXPECT_EQ(data[i],q[i]);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,139 @@
+#include <../Control/SerialProtocol.h>
+#include <KrisLibrary/utils/AnyCollection.h>
+#include <gtest/gtest.h>
+#include <string.h>
+#include <limits>
+
+static void ExpectRoundTrip(int type,int tag,const vector<double>& values)
+{
+    string msg;
+    WriteSerialBinaryMessage(type,tag,values,msg);
+    EXPECT_TRUE(IsSerialBinaryMessage(msg));
+    int type2=-1,tag2=-1;
+    vector<double> values2(3,1.0);
+    ASSERT_TRUE(ReadSerialBinaryMessage(msg,type2,tag2,values2));
+    EXPECT_EQ(type,type2);
+    EXPECT_EQ(tag,tag2);
+    ASSERT_EQ(values.size(),values2.size());
+    //values are copied bit for bit
+    if(!values.empty())
+        EXPECT_EQ(memcmp(&values[0],&values2[0],values.size()*sizeof(double)),0);
+}
+
+TEST(testSerialProtocol, testBinaryRoundTrip)
+{
+    vector<double> values;
+    ExpectRoundTrip(SerialSensorData,0,values);
+    values.push_back(1.5);
+    ExpectRoundTrip(SerialCommand,SerialQCmd|SerialTCmd,values);
+    values.push_back(-0.0);
+    values.push_back(numeric_limits<double>::infinity());
+    values.push_back(numeric_limits<double>::quiet_NaN());
+    values.push_back(numeric_limits<double>::denorm_min());
+    for(int i=0;i<100;i++) values.push_back(i*0.1-3);
+    ExpectRoundTrip(SerialSensorData,12345,values);
+    ExpectRoundTrip(-1,-7,values);
+}
+
+TEST(testSerialProtocol, testMalformedBinary)
+{
+    vector<double> values(4,2.0);
+    string msg;
+    WriteSerialBinaryMessage(SerialCommand,SerialQCmd,values,msg);
+    int type,tag;
+    vector<double> out;
+
+    //JSON messages and garbage are not binary
+    EXPECT_FALSE(IsSerialBinaryMessage("{\"qcmd\":[1,2,3]}"));
+    EXPECT_FALSE(ReadSerialBinaryMessage("{\"qcmd\":[1,2,3]}",type,tag,out));
+    EXPECT_FALSE(ReadSerialBinaryMessage("",type,tag,out));
+    EXPECT_FALSE(ReadSerialBinaryMessage("KBIN",type,tag,out));
+    string badMagic = msg;
+    badMagic[3] = 'X';
+    EXPECT_FALSE(ReadSerialBinaryMessage(badMagic,type,tag,out));
+
+    //a header that does not match the payload length
+    EXPECT_FALSE(ReadSerialBinaryMessage(msg.substr(0,msg.length()-1),type,tag,out));
+    EXPECT_FALSE(ReadSerialBinaryMessage(msg.substr(0,msg.length()-sizeof(double)),type,tag,out));
+    EXPECT_FALSE(ReadSerialBinaryMessage(msg+'\0',type,tag,out));
+    EXPECT_FALSE(ReadSerialBinaryMessage(msg+string(sizeof(double),'\0'),type,tag,out));
+
+    //a negative or huge count
+    int counts[3] = {-1,-4,numeric_limits<int>::max()};
+    for(int i=0;i<3;i++) {
+        string bad = msg;
+        memcpy(&bad[4+2*sizeof(int)],&counts[i],sizeof(int));
+        EXPECT_FALSE(ReadSerialBinaryMessage(bad,type,tag,out));
+    }
+
+    //the header alone is a valid empty message
+    string header = msg.substr(0,4+3*sizeof(int));
+    int zero = 0;
+    memcpy(&header[4+2*sizeof(int)],&zero,sizeof(int));
+    EXPECT_TRUE(ReadSerialBinaryMessage(header,type,tag,out));
+    EXPECT_TRUE(out.empty());
+}
+
+static bool ReadSchema(const string& msg,SerialSensorSchema& schema)
+{
+    AnyCollection c;
+    if(!c.read(msg.c_str())) return false;
+    return schema.Read(c);
+}
+
+static void ExpectSameSchema(const SerialSensorSchema& a,const SerialSensorSchema& b)
+{
+    EXPECT_EQ(a.id,b.id);
+    EXPECT_TRUE(a.names == b.names);
+    EXPECT_TRUE(a.offsets == b.offsets);
+}
+
+TEST(testSerialProtocol, testSchemaRoundTrip)
+{
+    SerialSensorSchema schema;
+    schema.id = 3;
+    schema.Add("t",1);
+    schema.Add("dt",1);
+    schema.Add("qcmd",7);
+    schema.Add("empty",0);
+    schema.Add("force sensor",6);
+    EXPECT_EQ(schema.NumChannels(),5);
+    EXPECT_EQ(schema.Size(),15);
+    EXPECT_EQ(schema.ChannelSize(2),7);
+
+    string msg;
+    schema.Write(msg);
+    EXPECT_FALSE(IsSerialBinaryMessage(msg));
+    SerialSensorSchema read;
+    ASSERT_TRUE(ReadSchema(msg,read));
+    ExpectSameSchema(schema,read);
+}
+
+TEST(testSerialProtocol, testMalformedSchema)
+{
+    SerialSensorSchema schema;
+    schema.id = 3;
+    schema.Add("t",1);
+    schema.Add("q",7);
+    SerialSensorSchema original = schema;
+
+    const char* bad[] = {
+        "{\"names\":[\"t\"],\"sizes\":[1]}",
+        "{\"schema\":5,\"sizes\":[1]}",
+        "{\"schema\":5,\"names\":[\"t\"]}",
+        "{\"schema\":5,\"names\":[\"t\",\"q\"],\"sizes\":[1]}",
+        "{\"schema\":5,\"names\":[\"t\"],\"sizes\":[-1]}",
+        "{\"schema\":5,\"names\":[\"t\",\"q\"],\"sizes\":[2147483647,1]}",
+        "{\"schema\":5,\"names\":[\"t\"],\"sizes\":\"one\"}",
+    };
+    for(size_t i=0;i<sizeof(bad)/sizeof(bad[0]);i++) {
+        EXPECT_FALSE(ReadSchema(bad[i],schema)) << bad[i];
+        //an invalid message leaves the current schema unchanged
+        ExpectSameSchema(original,schema);
+    }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,199 @@
+#include <../Control/MessagePipe.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <gtest/gtest.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <stdio.h>
+
+//a message whose contents depend on seed, including zero bytes
+static string MakeMessage(int seed,int size)
+{
+    string msg(size,'\0');
+    unsigned int state = (unsigned int)seed;
+    for(int i=0;i<size;i++) {
+        state = state*1103515245u + 12345u;
+        msg[i] = (char)(state >> 16);
+    }
+    return msg;
+}
+
+class testSharedMemoryPipe: public ::testing::Test
+{
+protected:
+    string name;
+    SharedMemoryPipe server;
+
+    testSharedMemoryPipe()
+        :name(UniqueName()),server(name.c_str(),true)
+    {}
+
+    static string UniqueName() {
+        static int count = 0;
+        char buf[64];
+        snprintf(buf,64,"klampt_test_shm_%d_%d",(int)getpid(),count++);
+        return buf;
+    }
+
+    virtual void SetUp() {
+        ASSERT_TRUE(server.Start());
+    }
+};
+
+TEST_F(testSharedMemoryPipe, testRoundTrip)
+{
+    SharedMemoryPipe client(name.c_str(),false,1.0);
+    ASSERT_TRUE(client.Start());
+    EXPECT_TRUE(client.IsOpen());
+    EXPECT_TRUE(client.WriteReady());
+    EXPECT_TRUE(server.WriteReady());
+    EXPECT_EQ(client.UnreadCount(),0);
+
+    string binary = MakeMessage(1,1000);
+    EXPECT_TRUE(server.Send("hello"));
+    EXPECT_TRUE(server.Send(""));
+    EXPECT_TRUE(server.Send(binary));
+    ASSERT_TRUE(client.WaitForMessage(1.0));
+    EXPECT_EQ(client.UnreadCount(),3);
+    EXPECT_EQ(client.Next(),"hello");
+    EXPECT_EQ(client.Next(),"");
+    EXPECT_TRUE(client.Next() == binary);
+    EXPECT_EQ(client.UnreadCount(),0);
+    EXPECT_FALSE(client.WaitForMessage(0.01));
+
+    EXPECT_TRUE(client.Send("a"));
+    EXPECT_TRUE(client.Send("b"));
+    ASSERT_TRUE(server.WaitForMessage(1.0));
+    EXPECT_EQ(server.Newest(),"b");
+    EXPECT_EQ(server.UnreadCount(),0);
+}
+
+TEST_F(testSharedMemoryPipe, testWrapAround)
+{
+    SharedMemoryPipe client(name.c_str(),false,1.0);
+    ASSERT_TRUE(client.Start());
+    //about 4 times the size of the ring, in messages of varying size
+    for(int i=0;i<100;i++) {
+        string msg = MakeMessage(i,300000+i*1001);
+        ASSERT_TRUE(server.Send(msg));
+        ASSERT_EQ(client.UnreadCount(),1);
+        ASSERT_TRUE(client.Next() == msg) << "message " << i;
+    }
+}
+
+TEST_F(testSharedMemoryPipe, testFullRing)
+{
+    SharedMemoryPipe client(name.c_str(),false,1.0);
+    ASSERT_TRUE(client.Start());
+    //the ring holds 8 MiB, including a 4 byte length per message
+    string msg = MakeMessage(2,1<<20);
+    int numSent = 0;
+    while(server.Send(msg)) numSent++;
+    EXPECT_EQ(numSent,7);
+    EXPECT_EQ(client.UnreadCount(),7);
+    //the dropped message does not corrupt the others, and reading one
+    //makes room for another
+    EXPECT_TRUE(client.Next() == msg);
+    EXPECT_TRUE(server.Send(msg));
+    EXPECT_FALSE(server.Send(msg));
+    EXPECT_EQ(client.UnreadCount(),7);
+    for(int i=0;i<7;i++)
+        EXPECT_TRUE(client.Next() == msg);
+    EXPECT_EQ(client.UnreadCount(),0);
+}
+
+struct ReadRequest
+{
+    SharedMemoryPipe* pipe;
+    string msg;
+    bool received;
+};
+
+static void* reader_thread_func(void* ptr)
+{
+    ReadRequest* req = reinterpret_cast<ReadRequest*>(ptr);
+    req->received = req->pipe->WaitForMessage(10.0);
+    if(req->received) req->msg = req->pipe->Next();
+    return NULL;
+}
+
+TEST_F(testSharedMemoryPipe, testLargeMessage)
+{
+    SharedMemoryPipe client(name.c_str(),false,1.0);
+    ASSERT_TRUE(client.Start());
+    //larger than the ring, so the reader must drain it while it is sent
+    string msg = MakeMessage(3,20<<20);
+    ReadRequest req;
+    req.pipe = &client;
+    req.received = false;
+    Thread reader = ThreadStart(reader_thread_func,&req);
+    bool sent = server.Send(msg);
+    ThreadJoin(reader);
+    EXPECT_TRUE(sent);
+    ASSERT_TRUE(req.received);
+    EXPECT_EQ(req.msg.size(),msg.size());
+    EXPECT_TRUE(req.msg == msg);
+    //later messages are unaffected
+    EXPECT_TRUE(server.Send("after"));
+    EXPECT_EQ(client.Next(),"after");
+}
+
+TEST_F(testSharedMemoryPipe, testSkipStale)
+{
+    //messages sent before a client attaches are not delivered to it
+    EXPECT_TRUE(server.Send("before"));
+    SharedMemoryPipe client1(name.c_str(),false,1.0);
+    ASSERT_TRUE(client1.Start());
+    EXPECT_EQ(client1.UnreadCount(),0);
+    EXPECT_TRUE(server.Send("during"));
+    EXPECT_EQ(client1.Next(),"during");
+
+    //nor are messages that an earlier client left unread
+    EXPECT_TRUE(client1.Send("stale"));
+    client1.Stop();
+    EXPECT_FALSE(server.WriteReady());
+    SharedMemoryPipe client2(name.c_str(),false,1.0);
+    ASSERT_TRUE(client2.Start());
+    EXPECT_TRUE(server.WriteReady());
+    EXPECT_EQ(server.UnreadCount(),0);
+    EXPECT_TRUE(client2.Send("fresh"));
+    EXPECT_EQ(server.UnreadCount(),1);
+    EXPECT_EQ(server.Next(),"fresh");
+}
+
+TEST_F(testSharedMemoryPipe, testDeadPeer)
+{
+    pid_t pid = fork();
+    ASSERT_GE(pid,0);
+    if(pid == 0) {
+        //the child attaches, sends, and exits without calling Stop
+        SharedMemoryPipe client(name.c_str(),false,1.0);
+        if(!client.Start()) _exit(1);
+        client.Send("from child");
+        _exit(0);
+    }
+    int status;
+    ASSERT_EQ(waitpid(pid,&status,0),pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status),0);
+    EXPECT_FALSE(server.PeerAlive());
+    EXPECT_FALSE(server.WriteReady());
+    EXPECT_TRUE(server.IsOpen());
+    EXPECT_EQ(server.Next(),"from child");
+    //a message larger than the ring is not sent to a dead client
+    EXPECT_FALSE(server.Send(MakeMessage(4,9<<20)));
+
+    //a client sees a server that stopped
+    SharedMemoryPipe client(name.c_str(),false,1.0);
+    ASSERT_TRUE(client.Start());
+    EXPECT_TRUE(client.IsOpen());
+    server.Stop();
+    EXPECT_FALSE(client.IsOpen());
+    EXPECT_FALSE(client.WriteReady());
+    EXPECT_FALSE(client.WaitForMessage(1.0));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
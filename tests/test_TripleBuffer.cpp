@@ -0,0 +1,92 @@
+#include <../Modeling/TripleBuffer.h>
+#include <KrisLibrary/utils/threadutils.h>
+#include <gtest/gtest.h>
+#include <vector>
+using namespace std;
+
+//a value that is only consistent if it was not torn by a concurrent write:
+//every entry of data equals seq
+struct Message
+{
+    Message() : seq(0) {}
+    void Set(int _seq) {
+        seq = _seq;
+        data.resize(1+seq%50);
+        for(size_t i=0;i<data.size();i++) data[i] = seq;
+    }
+    bool Consistent() const {
+        if(data.size() != size_t(1+seq%50)) return false;
+        for(size_t i=0;i<data.size();i++)
+            if(data[i] != seq) return false;
+        return true;
+    }
+    int seq;
+    vector<int> data;
+};
+
+const static int kNumMessages = 200000;
+
+static void* producer_thread_func(void* ptr)
+{
+    TripleBuffer<Message>* buffer = reinterpret_cast<TripleBuffer<Message>*>(ptr);
+    for(int i=1;i<=kNumMessages;i++) {
+        buffer->Back().Set(i);
+        buffer->Publish();
+    }
+    return NULL;
+}
+
+TEST(testTripleBuffer, testSingleThread)
+{
+    TripleBuffer<Message> buffer;
+    EXPECT_FALSE(buffer.Update());
+    buffer.Back().Set(1);
+    buffer.Publish();
+    ASSERT_TRUE(buffer.Update());
+    EXPECT_EQ(buffer.Front().seq,1);
+    EXPECT_FALSE(buffer.Update());
+    EXPECT_EQ(buffer.Front().seq,1);
+    //older values are dropped
+    buffer.Back().Set(2);
+    buffer.Publish();
+    buffer.Back().Set(3);
+    buffer.Publish();
+    ASSERT_TRUE(buffer.Update());
+    EXPECT_EQ(buffer.Front().seq,3);
+    EXPECT_FALSE(buffer.Update());
+    //writing the back buffer does not touch the front
+    buffer.Back().Set(4);
+    EXPECT_EQ(buffer.Front().seq,3);
+    EXPECT_TRUE(buffer.Front().Consistent());
+    EXPECT_NE(&buffer.Back(),&buffer.Front());
+}
+
+TEST(testTripleBuffer, testHandoff)
+{
+    TripleBuffer<Message> buffer;
+    Thread producer = ThreadStart(producer_thread_func,&buffer);
+    int last = 0, numReceived = 0;
+    bool torn = false, outOfOrder = false;
+    while(last < kNumMessages) {
+        if(!buffer.Update()) continue;
+        const Message& msg = buffer.Front();
+        if(!msg.Consistent()) { torn = true; break; }
+        //values arrive in order, possibly skipping some
+        if(msg.seq <= last) { outOfOrder = true; break; }
+        last = msg.seq;
+        numReceived++;
+    }
+    //join before checking, so that a failure does not leave the producer
+    //writing to a destroyed buffer
+    ThreadJoin(producer);
+    ASSERT_FALSE(torn) << "torn message " << buffer.Front().seq;
+    ASSERT_FALSE(outOfOrder) << "message " << buffer.Front().seq << " after " << last;
+    EXPECT_EQ(last,kNumMessages);
+    EXPECT_GT(numReceived,0);
+    EXPECT_FALSE(buffer.Update());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
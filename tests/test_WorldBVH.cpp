@@ -0,0 +1,169 @@
+#include <../Modeling/World.h>
+#include <gtest/gtest.h>
+#include <math.h>
+
+//a robot on a plane, surrounded by a ring of blocks
+class testWorldBVH: public ::testing::Test
+{
+protected:
+    RobotWorld world;
+    vector<Ray3D> rays;
+
+    testWorldBVH()
+    {
+        world.LoadXML("data/athlete_plane.xml");
+        for(int i=0;i<6;i++) {
+            int index = world.LoadRigidObject("data/objects/block.obj");
+            RigidObject* obj = world.rigidObjects[index];
+            obj->T.R.setRotateZ(0.3*i);
+            obj->T.t.set(1.5*cos(i*Pi/3),1.5*sin(i*Pi/3),0.3+0.2*i);
+        }
+        world.UpdateBVH();
+        //a fan of rays from two viewpoints.  Directions are not normalized.
+        Vector3 sources[2] = {Vector3(3,2,2.5),Vector3(-2,-3,0.5)};
+        for(int s=0;s<2;s++) {
+            for(int i=0;i<40;i++) {
+                for(int j=0;j<40;j++) {
+                    Vector3 target(-2+0.1*i,-2+0.1*j,0.05*((i*7+j*3)%40));
+                    Ray3D r;
+                    r.source = sources[s];
+                    r.direction = (1+0.1*(i%3))*(target-sources[s]);
+                    rays.push_back(r);
+                }
+            }
+        }
+    }
+
+    //returns the world ID of the closest geometry hit, checking every
+    //geometry in the world
+    int BruteForceRayCast(const Ray3D& ray,Real& distance)
+    {
+        Ray3D r = ray;
+        r.direction.inplaceNormalize();
+        int id = -1;
+        distance = Inf;
+        Real d;
+        for(size_t j=0;j<world.robots.size();j++) {
+            Robot* robot = world.robots[j];
+            for(size_t i=0;i<robot->links.size();i++) {
+                if(robot->IsGeometryEmpty(i)) continue;
+                if(robot->geometry[i]->RayCast(r,&d) && d < distance) {
+                    distance = d;
+                    id = world.RobotLinkID(j,i);
+                }
+            }
+        }
+        for(size_t j=0;j<world.rigidObjects.size();j++) {
+            if(world.rigidObjects[j]->geometry->RayCast(r,&d) && d < distance) {
+                distance = d;
+                id = world.RigidObjectID(j);
+            }
+        }
+        for(size_t j=0;j<world.terrains.size();j++) {
+            if(world.terrains[j]->geometry->RayCast(r,&d) && d < distance) {
+                distance = d;
+                id = world.TerrainID(j);
+            }
+        }
+        return id;
+    }
+};
+
+TEST_F(testWorldBVH, testRayCastMatchesBruteForce)
+{
+    int numHits = 0;
+    for(size_t i=0;i<rays.size();i++) {
+        WorldBVH::Hit hit;
+        Real distance;
+        int id = BruteForceRayCast(rays[i],distance);
+        bool res = world.bvh.RayCast(rays[i],hit);
+        ASSERT_EQ(res,(id >= 0));
+        if(!res) continue;
+        numHits++;
+        EXPECT_EQ(world.bvh.items[hit.item].id,id);
+        EXPECT_EQ(hit.distance,distance);
+        Vector3 worldpt;
+        EXPECT_EQ(world.RayCast(rays[i],worldpt),id);
+    }
+    //make sure the test exercises robots, objects, and terrains
+    EXPECT_GT(numHits,(int)rays.size()/2);
+}
+
+TEST_F(testWorldBVH, testRayCastTypes)
+{
+    for(size_t i=0;i<rays.size();i++) {
+        WorldBVH::Hit hit;
+        if(!world.bvh.RayCast(rays[i],hit,WorldBVH::RigidObjects,false)) continue;
+        EXPECT_GE(world.IsRigidObject(world.bvh.items[hit.item].id),0);
+        Vector3 localpt;
+        RigidObject* obj = world.RayCastObject(rays[i],localpt);
+        ASSERT_TRUE(obj != NULL);
+        EXPECT_EQ(obj,(RigidObject*)world.rigidObjects[world.bvh.items[hit.item].index]);
+    }
+}
+
+TEST_F(testWorldBVH, testBatchRayCast)
+{
+    vector<WorldBVH::Hit> serial,parallel;
+    world.bvh.RayCast(rays,serial,WorldBVH::All,true,NULL,1);
+    world.bvh.RayCast(rays,parallel,WorldBVH::All,true,NULL,4);
+    ASSERT_EQ(serial.size(),rays.size());
+    ASSERT_EQ(parallel.size(),rays.size());
+    for(size_t i=0;i<rays.size();i++) {
+        EXPECT_EQ(serial[i].item,parallel[i].item);
+        if(serial[i].item < 0) continue;
+        EXPECT_EQ(serial[i].distance,parallel[i].distance);
+        EXPECT_EQ(serial[i].normal,parallel[i].normal);
+    }
+}
+
+TEST_F(testWorldBVH, testRefit)
+{
+    //move some of the blocks and the robot, without invalidating, and
+    //compare the refit hierarchy against brute force
+    Robot* robot = world.robots[0];
+    for(int step=0;step<3;step++) {
+        for(size_t j=step%2;j<world.rigidObjects.size();j+=2)
+            world.rigidObjects[j]->T.t.z += 0.5;
+        Config q = robot->q;
+        for(int k=6;k<q.n;k++)
+            q(k) = Clamp(q(k)+0.2*(step+1),robot->qMin(k),robot->qMax(k));
+        robot->UpdateConfig(q);
+        world.UpdateBVH();
+        for(size_t i=0;i<rays.size();i++) {
+            WorldBVH::Hit hit;
+            Real distance;
+            Vector3 pt;
+            int id = BruteForceRayCast(rays[i],distance);
+            ASSERT_EQ(world.bvh.RayCast(rays[i],hit),(id >= 0));
+            if(id >= 0) EXPECT_EQ(world.bvh.items[hit.item].id,id);
+            EXPECT_EQ(world.RayCast(rays[i],pt),id);
+        }
+    }
+}
+
+TEST_F(testWorldBVH, testOverlappingPairs)
+{
+    const WorldBVH& bvh = world.bvh;
+    Real margins[3] = {0,0.05,0.5};
+    for(int m=0;m<3;m++) {
+        vector<pair<int,int> > pairs,bruteForce;
+        bvh.OverlappingPairs(margins[m],pairs);
+        for(size_t i=0;i<bvh.items.size();i++) {
+            for(size_t j=i+1;j<bvh.items.size();j++) {
+                const AABB3D& a = bvh.items[i].bb;
+                const AABB3D& b = bvh.items[j].bb;
+                bool overlap = true;
+                for(int k=0;k<3;k++)
+                    if(a.bmin[k] > b.bmax[k]+margins[m] || b.bmin[k] > a.bmax[k]+margins[m]) overlap = false;
+                if(overlap) bruteForce.push_back(pair<int,int>((int)i,(int)j));
+            }
+        }
+        EXPECT_TRUE(pairs == bruteForce);
+    }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
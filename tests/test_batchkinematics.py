@@ -0,0 +1,80 @@
+import unittest
+import threading
+import numpy as np
+from klampt import *
+from klampt.math import so3
+
+class batchKinematicsTest(unittest.TestCase):
+
+    def setUp(self):
+        self.world = WorldModel()
+        self.world.readFile('data/athlete_plane.xml')
+        self.robot = self.world.robot(0)
+        n = self.robot.numLinks()
+        qmin,qmax = self.robot.getJointLimits()
+        qmin = np.maximum(qmin,-2.0)
+        qmax = np.minimum(qmax,2.0)
+        rng = np.random.RandomState(0)
+        self.qs = qmin + rng.rand(20,n)*(qmax-qmin)
+        self.links = [5,11,23]
+
+    def test_batchLinkTransforms(self):
+        q0 = self.robot.getConfig()
+        T = self.robot.batchLinkTransforms(self.qs,self.links,2)
+        self.assertEqual(T.shape,(len(self.qs),len(self.links),4,4))
+        #the robot's configuration is not changed
+        self.assertEqual(self.robot.getConfig(),q0)
+        for i,q in enumerate(self.qs):
+            self.robot.setConfig(list(q))
+            for k,l in enumerate(self.links):
+                R,t = self.robot.link(l).getTransform()
+                np.testing.assert_allclose(T[i,k,:3,:3],np.array(so3.matrix(R)),atol=1e-12)
+                np.testing.assert_allclose(T[i,k,:3,3],t,atol=1e-12)
+                np.testing.assert_array_equal(T[i,k,3],[0,0,0,1])
+
+    def test_batchLinkJacobians(self):
+        points = [0,0,0, 0.1,0,-0.2, 0,0.05,0.3]
+        J = self.robot.batchLinkJacobians(self.qs,self.links,points,2)
+        n = self.robot.numLinks()
+        self.assertEqual(J.shape,(len(self.qs),len(self.links),6,n))
+        for i,q in enumerate(self.qs):
+            self.robot.setConfig(list(q))
+            for k,l in enumerate(self.links):
+                Jref = self.robot.link(l).getJacobian(points[3*k:3*k+3])
+                np.testing.assert_allclose(J[i,k],np.array(Jref),atol=1e-12)
+        #empty localPoints uses the link origins
+        J0 = self.robot.batchLinkJacobians(self.qs,self.links,[],1)
+        np.testing.assert_array_equal(J0[:,0],J[:,0])
+
+    def test_threadCountIndependence(self):
+        T1 = self.robot.batchLinkTransforms(self.qs,self.links,1)
+        T4 = self.robot.batchLinkTransforms(self.qs,self.links,4)
+        np.testing.assert_array_equal(T1,T4)
+
+    def test_robotChangedBetweenCalls(self):
+        #the kept batch picks up edits to the robot, and handles small N
+        T1 = self.robot.batchLinkTransforms(self.qs[:1],self.links,4)
+        self.robot.link(5).setParentTransform(so3.identity(),[0,0,1])
+        T2 = self.robot.batchLinkTransforms(self.qs[:1],self.links,4)
+        self.robot.setConfig(list(self.qs[0]))
+        R,t = self.robot.link(5).getTransform()
+        np.testing.assert_allclose(T2[0,0,:3,3],t,atol=1e-12)
+        self.assertFalse(np.array_equal(T1,T2))
+        self.assertEqual(self.robot.batchLinkTransforms(self.qs[:0],self.links).shape,(0,len(self.links),4,4))
+
+    def test_pythonThreads(self):
+        #calls from several Python threads give the same results
+        ref = self.robot.batchLinkTransforms(self.qs,self.links,2)
+        results = []
+        def run():
+            for i in range(10):
+                results.append(self.robot.batchLinkTransforms(self.qs,self.links,2))
+        threads = [threading.Thread(target=run) for i in range(4)]
+        for t in threads: t.start()
+        for t in threads: t.join()
+        self.assertEqual(len(results),40)
+        for T in results:
+            np.testing.assert_array_equal(T,ref)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,85 @@
+import unittest
+from klampt import *
+from klampt.math import so3
+from klampt.model.collide import WorldCollider
+
+class worldColliderTest(unittest.TestCase):
+
+    def setUp(self):
+        self.world = WorldModel()
+        self.world.readFile('data/athlete_plane.xml')
+        self.robot = self.world.robot(0)
+        #lower the robot into the plane, and put a block around one link
+        q = self.robot.getConfig()
+        q[2] -= 0.3
+        self.robot.setConfig(q)
+        obj = self.world.makeRigidObject("block")
+        obj.geometry().loadFile('data/objects/block.obj')
+        T = self.robot.link(5).getTransform()
+        obj.setTransform(so3.identity(),T[1])
+        self.collider = WorldCollider(self.world)
+        if self.collider.native is None:
+            self.skipTest("WorldCollisionQuery is not available")
+
+    def query(self,ordered,method,*args):
+        """Returns the results of the native and the Python implementations
+        as sets of ID pairs, which are unordered unless ordered is True"""
+        def ids(pairs):
+            if ordered: return set((a.getID(),b.getID()) for (a,b) in pairs)
+            return set(frozenset((a.getID(),b.getID())) for (a,b) in pairs)
+        native = ids(method(*args))
+        saved = self.collider.native
+        self.collider.native = None
+        try:
+            python = ids(method(*args))
+        finally:
+            self.collider.native = saved
+        return native,python
+
+    def assertSameResults(self,method,*args):
+        native,python = self.query(False,method,*args)
+        self.assertEqual(native,python)
+        return native
+
+    def test_collisions(self):
+        res = self.assertSameResults(self.collider.collisions)
+        self.assertTrue(len(res) > 0)
+
+    def test_filters(self):
+        isLink = lambda o: isinstance(o,RobotModelLink)
+        isTerrain = lambda o: isinstance(o,TerrainModel)
+        self.assertSameResults(self.collider.collisions,isLink)
+        #the pairs are ordered as (filter1,filter2)
+        native,python = self.query(True,self.collider.collisions,isLink,isTerrain)
+        self.assertEqual(native,python)
+        self.assertTrue(len(native) > 0)
+
+    def test_withinDistance(self):
+        near = self.assertSameResults(self.collider.withinDistance,0.05)
+        colliding = self.assertSameResults(self.collider.collisions)
+        self.assertTrue(colliding.issubset(near))
+
+    def test_ignoreCollision(self):
+        self.collider.ignoreCollision(self.world.terrain(0))
+        self.collider.ignoreCollision((self.robot.link(5),self.world.rigidObject(0)))
+        res = self.assertSameResults(self.collider.collisions)
+        terrain = self.world.terrain(0).getID()
+        pair = frozenset((self.robot.link(5).getID(),self.world.rigidObject(0).getID()))
+        self.assertFalse(any(terrain in p for p in res))
+        self.assertFalse(pair in res)
+
+    def test_maskEdited(self):
+        #edits of the mask attribute are seen by the native queries
+        res = self.assertSameResults(self.collider.collisions)
+        a,b = list(res)[0]
+        i,j = self.collider.idToGeomIndex[a],self.collider.idToGeomIndex[b]
+        self.collider.mask[i].discard(j)
+        self.collider.mask[j].discard(i)
+        res2 = self.assertSameResults(self.collider.collisions)
+        self.assertEqual(res2,res - set([frozenset((a,b))]))
+        self.collider.mask[i].add(j)
+        self.collider.mask[j].add(i)
+        self.assertEqual(self.assertSameResults(self.collider.collisions),res)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,77 @@
+import unittest
+import os
+import struct
+import math
+from klampt.io import columnlog
+
+def encodeColumn(values):
+    """Encodes values the same way as the C++ EncodeColumn"""
+    bits = struct.unpack('<%dQ'%len(values),struct.pack('<%dd'%len(values),*values))
+    data = []
+    prev = 0
+    for b in bits:
+        x = b ^ prev
+        prev = b
+        if x == 0:
+            data.append(chr(0x88))
+            continue
+        nbytes = [(x >> (8*k)) & 0xff for k in range(8)]
+        lz = 0
+        while nbytes[7-lz] == 0: lz += 1
+        tz = 0
+        while nbytes[tz] == 0: tz += 1
+        data.append(chr(16*lz+tz))
+        for k in range(7-lz,tz-1,-1):
+            data.append(chr(nbytes[k]))
+    return ''.join(data)
+
+def packString(s):
+    return struct.pack('=i',len(s))+s
+
+def writeLog(fn,names,metadata,chunks):
+    with open(fn,'wb') as f:
+        f.write('KCOL'+struct.pack('=ii',1,len(names)))
+        for name in names:
+            f.write(packString(name))
+        f.write(packString(metadata))
+        for rows in chunks:
+            f.write('CHNK'+struct.pack('=i',len(rows)))
+            for j in range(len(names)):
+                f.write(packString(encodeColumn([r[j] for r in rows])))
+
+class columnlogTest(unittest.TestCase):
+
+    def setUp(self):
+        self.fn = 'test_columnlog.klog'
+        self.rows = [[i*0.01,2.5,math.sin(i*0.1),float(i*i),-0.0] for i in range(250)]
+        self.chunks = [self.rows[0:100],self.rows[100:200],self.rows[200:250]]
+        writeLog(self.fn,['time','a','b','c','d'],'{"names":["plane","robot"]}',self.chunks)
+
+    def tearDown(self):
+        os.remove(self.fn)
+
+    def test_decodeColumn(self):
+        values = [0.0,1.0,1.0,-3.5,1e-300,float('inf')]
+        self.assertEqual(columnlog.decodeColumn(encodeColumn(values),len(values)),values)
+        self.assertRaises(Exception,columnlog.decodeColumn,encodeColumn(values)+'\0',len(values))
+
+    def test_read(self):
+        log = columnlog.ColumnLog(self.fn)
+        self.assertEqual(log.columns,['time','a','b','c','d'])
+        self.assertEqual(log.numRows,250)
+        self.assertEqual(log.names(),['plane','robot'])
+        self.assertEqual(log.column('b'),[r[2] for r in self.rows])
+        self.assertEqual(log.column(0),[r[0] for r in self.rows])
+        self.assertEqual(log.rows(),self.rows)
+
+    def test_truncated(self):
+        with open(self.fn,'rb') as f:
+            data = f.read()
+        with open(self.fn,'wb') as f:
+            f.write(data[:-10])
+        log = columnlog.ColumnLog(self.fn)
+        self.assertEqual(log.numRows,200)
+        self.assertEqual(log.rows(),self.rows[:200])
+
+if __name__ == '__main__':
+    unittest.main()
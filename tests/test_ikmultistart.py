@@ -0,0 +1,113 @@
+import unittest
+from klampt import *
+from klampt.model import ik
+from klampt.math import vectorops
+
+class IKMultiStartTest(unittest.TestCase):
+
+    def setUp(self):
+        self.world = WorldModel()
+        self.world.readFile('data/athlete_plane.xml')
+        self.robot = self.world.robot(0)
+        self.link = 11
+        #the joints between the base and the link
+        self.legDofs = []
+        i = self.robot.link(self.link).getParent()
+        while i >= 6:
+            self.legDofs.append(i)
+            i = self.robot.link(i).getParent()
+        self.legDofs.append(self.link)
+        #two solutions reaching the same point
+        self.qA = self.robot.getConfig()
+        self.goal = self.robot.link(self.link).getWorldPosition([0,0,0])
+        q = self.qA[:]
+        for i in self.legDofs:
+            q[i] += 0.3
+        self.robot.setConfig(q)
+        s = self.makeSolver()
+        s.setMaxIters(1000)
+        self.assertTrue(s.solve())
+        self.qB = self.robot.getConfig()
+        self.assertGreater(vectorops.distance(self.qA,self.qB),0.1)
+
+    def makeSolver(self):
+        s = IKSolver(self.robot)
+        s.add(ik.objective(self.robot.link(self.link),local=[0,0,0],world=self.goal))
+        s.setActiveDofs(self.legDofs)
+        return s
+
+    def moveBase(self,q):
+        #the goal can't be reached from a start whose base is far away
+        q = q[:]
+        q[0] += 10
+        self.robot.setConfig(q)
+        return q
+
+    def assertSolution(self,q,qref,qother):
+        #reaches the goal, from the start at qref rather than the one at qother
+        self.robot.setConfig(q)
+        p = self.robot.link(self.link).getWorldPosition([0,0,0])
+        self.assertLess(vectorops.distance(p,self.goal),1e-2)
+        self.assertLess(vectorops.distance(q,qref),vectorops.distance(q,qother))
+
+    def test_unreachable(self):
+        q = self.moveBase(self.qA)
+        s = self.makeSolver()
+        self.assertFalse(s.solveMultiStart(4,2))
+        self.assertEqual(self.robot.getConfig(),q)
+
+    def test_addSeed(self):
+        self.moveBase(self.qA)
+        s = self.makeSolver()
+        s.addSeed(self.qB)
+        self.assertTrue(s.solveMultiStart(2,2))
+        self.assertSolution(self.robot.getConfig(),self.qB,self.qA)
+        self.assertRaises(Exception,s.addSeed,self.qB[:-1])
+        #without seeds, only the current configuration and samples are tried
+        s.clearSeeds()
+        self.moveBase(self.qA)
+        self.assertFalse(s.solveMultiStart(4,2))
+
+    def test_firstConverged(self):
+        #both seeds converge, and the earlier one is chosen for any number
+        #of threads and random restarts
+        for threads in [1,2,4]:
+            for restarts in [3,8]:
+                self.moveBase(self.qB)
+                s = self.makeSolver()
+                s.addSeed(self.qA)
+                s.addSeed(self.qB)
+                self.assertTrue(s.solveMultiStart(restarts,threads))
+                self.assertSolution(self.robot.getConfig(),self.qA,self.qB)
+
+    def test_best(self):
+        #the converged result nearest the current configuration is chosen
+        for threads in [1,4]:
+            self.moveBase(self.qB)
+            s = self.makeSolver()
+            s.addSeed(self.qA)
+            s.addSeed(self.qB)
+            self.assertTrue(s.solveMultiStart(3,threads,True))
+            self.assertSolution(self.robot.getConfig(),self.qB,self.qA)
+        #or the one nearest the bias configuration, if set
+        self.moveBase(self.qB)
+        s = self.makeSolver()
+        s.addSeed(self.qA)
+        s.addSeed(self.qB)
+        s.setBiasConfig(self.qA)
+        self.assertTrue(s.solveMultiStart(3,2,True))
+        self.assertSolution(self.robot.getConfig(),self.qA,self.qB)
+
+    def test_currentConfiguration(self):
+        #a start that converges is used before any seed
+        q = self.qA[:]
+        for i in self.legDofs:
+            q[i] += 0.05
+        self.robot.setConfig(q)
+        s = self.makeSolver()
+        s.addSeed(self.qB)
+        self.assertTrue(s.solveMultiStart(2,2))
+        self.assertSolution(self.robot.getConfig(),self.qA,self.qB)
+
+if __name__ == '__main__':
+    unittest.main()
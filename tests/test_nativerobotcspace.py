@@ -0,0 +1,68 @@
+import unittest
+import threading
+from klampt import *
+from klampt.math import so3
+from klampt.plan.robotcspace import NativeRobotCSpace
+
+class NativeRobotCSpaceTest(unittest.TestCase):
+
+    def setUp(self):
+        self.world = WorldModel()
+        self.world.readFile('data/athlete_plane.xml')
+        self.robot = self.world.robot(0)
+        #lifted off the plane, and lowered into it
+        self.free = self.robot.getConfig()
+        self.free[2] += 0.5
+        self.colliding = self.robot.getConfig()
+        self.colliding[2] -= 0.5
+        self.space = NativeRobotCSpace(self.world,0)
+        self.space.setup()
+
+    def tearDown(self):
+        self.space.close()
+
+    def test_feasible(self):
+        self.assertTrue(self.space.feasible(self.free))
+        self.assertFalse(self.space.feasible(self.colliding))
+        self.assertTrue(self.space.isVisible(self.free,self.free))
+        self.assertFalse(self.space.isVisible(self.free,self.colliding))
+
+    def test_sharedRobotUnchanged(self):
+        #the native checks use a private copy of the robot
+        q = self.robot.getConfig()
+        self.space.feasible(self.free)
+        self.space.isVisible(self.free,self.colliding)
+        self.assertEqual(self.robot.getConfig(),q)
+
+    def test_threads(self):
+        results = []
+        def check():
+            for i in range(20):
+                results.append(self.space.feasible(self.free))
+                results.append(not self.space.feasible(self.colliding))
+        threads = [threading.Thread(target=check) for i in range(4)]
+        for t in threads: t.start()
+        for t in threads: t.join()
+        self.assertEqual(len(results),160)
+        self.assertTrue(all(results))
+
+    def test_worldKeptAlive(self):
+        #the space holds the world's capsule, and the capsule the world
+        capsule = self.world.getNativePointer()
+        del capsule
+        self.world = None
+        self.robot = None
+        self.assertTrue(self.space.feasible(self.free))
+        self.assertFalse(self.space.feasible(self.colliding))
+
+    def test_objectAdded(self):
+        #a block placed around the lifted robot is seen by the next check
+        obj = self.world.makeRigidObject("block")
+        obj.geometry().loadFile('data/objects/block.obj')
+        self.robot.setConfig(self.free)
+        T = self.robot.link(5).getTransform()
+        obj.setTransform(so3.identity(),T[1])
+        self.assertFalse(self.space.feasible(self.free))
+
+if __name__ == '__main__':
+    unittest.main()
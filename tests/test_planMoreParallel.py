@@ -0,0 +1,66 @@
+import unittest
+from klampt import *
+from klampt.plan.cspace import MotionPlan
+from klampt.plan.robotcspace import NativeRobotCSpace
+
+class planMoreParallelTest(unittest.TestCase):
+
+    def setUp(self):
+        self.world = WorldModel()
+        self.world.readFile('data/athlete_plane.xml')
+        self.robot = self.world.robot(0)
+        #lift the robot off the plane, then move one leg
+        self.start = self.robot.getConfig()
+        self.start[2] += 0.5
+        self.goal = self.start[:]
+        self.goal[7] += 0.3
+        self.plans = []
+
+    def tearDown(self):
+        for plan in self.plans:
+            plan.close()
+
+    def makePlan(self,space):
+        plan = MotionPlan(space,type='sbl')
+        plan.setEndpoints(self.start,self.goal)
+        self.plans.append(plan)
+        return plan
+
+    def test_planMoreParallel(self):
+        space = NativeRobotCSpace(self.world,0)
+        space.setup()
+        self.assertTrue(space.feasible(self.start))
+        self.assertTrue(space.feasible(self.goal))
+        plan = self.makePlan(space)
+        plan.planMoreParallel(1000,4)
+        path = plan.getPath()
+        self.assertIsNotNone(path)
+        self.assertGreaterEqual(len(path),2)
+        for a,b in zip(path[0],self.start):
+            self.assertAlmostEqual(a,b)
+        for a,b in zip(path[-1],self.goal):
+            self.assertAlmostEqual(a,b)
+        for q in path:
+            self.assertTrue(space.feasible(q))
+
+    def test_repeatedCalls(self):
+        #the planners made by the first call are reused by the second
+        space = NativeRobotCSpace(self.world,0)
+        space.setup()
+        plan = self.makePlan(space)
+        plan.planMoreParallel(1,4)
+        plan.planMoreParallel(1000,4)
+        path = plan.getPath()
+        self.assertIsNotNone(path)
+        for q in path:
+            self.assertTrue(space.feasible(q))
+
+    def test_pythonFeasibilityTest(self):
+        space = NativeRobotCSpace(self.world,0)
+        space.addFeasibilityTest(lambda q: True,"python")
+        space.setup()
+        plan = self.makePlan(space)
+        self.assertRaises(Exception,plan.planMoreParallel,100,2)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,99 @@
+import unittest
+import numpy as np
+from klampt import *
+
+class robotArraysTest(unittest.TestCase):
+
+    def setUp(self):
+        self.world = WorldModel()
+        self.world.readFile('data/athlete_plane.xml')
+        self.robot = self.world.robot(0)
+        n = self.robot.numLinks()
+        rng = np.random.RandomState(0)
+        qmin,qmax = self.robot.getJointLimits()
+        qmin = np.maximum(qmin,-1.0)
+        qmax = np.minimum(qmax,1.0)
+        self.robot.setConfig(list(qmin + rng.rand(n)*(qmax-qmin)))
+        self.robot.setVelocity(list(rng.rand(n)-0.5))
+        self.n = n
+
+    def assertArrayEqual(self,a,b):
+        self.assertTrue(np.allclose(a,np.array(b),rtol=0,atol=1e-12))
+
+    def test_state(self):
+        q = self.robot.getConfigArray()
+        self.assertEqual(q.shape,(self.n,))
+        self.assertEqual(q.dtype,np.float64)
+        self.assertArrayEqual(q,self.robot.getConfig())
+        self.assertArrayEqual(self.robot.getVelocityArray(),self.robot.getVelocity())
+        q2 = q*0.5
+        self.robot.setConfigArray(q2)
+        self.assertArrayEqual(self.robot.getConfig(),q2)
+        #the link transforms are updated
+        T = self.robot.link(5).getTransform()
+        self.robot.setConfig(list(q2))
+        self.assertEqual(self.robot.link(5).getTransform(),T)
+        dq = np.linspace(-1,1,self.n)
+        self.robot.setVelocityArray(dq)
+        self.assertArrayEqual(self.robot.getVelocity(),dq)
+
+    def test_out(self):
+        out = np.zeros(self.n)
+        res = self.robot.getConfigArray(out)
+        self.assertTrue(res is out)
+        self.assertArrayEqual(out,self.robot.getConfig())
+        B = np.zeros((self.n,self.n))
+        res = self.robot.getMassMatrixArray(B)
+        self.assertTrue(res is B)
+        self.assertArrayEqual(B,self.robot.getMassMatrix())
+        J = np.zeros((6,self.n))
+        res = self.robot.link(5).getJacobianArray([0.1,0,0],J)
+        self.assertTrue(res is J)
+
+    def test_badInputs(self):
+        q = self.robot.getConfigArray()
+        self.assertRaises(Exception,self.robot.setConfigArray,q[:-1])
+        self.assertRaises(Exception,self.robot.setConfigArray,q.astype(np.float32))
+        self.assertRaises(Exception,self.robot.setConfigArray,np.repeat(q,2)[::2])
+        self.assertRaises(Exception,self.robot.getConfigArray,np.zeros(self.n+1))
+        self.assertRaises(Exception,self.robot.getMassMatrixArray,np.zeros((self.n,self.n),dtype=np.float32))
+        self.assertArrayEqual(self.robot.getConfigArray(),q)
+
+    def test_fixedSizeArguments(self):
+        #the const double [3] arguments accept any length-3 sequence, and
+        #other lengths do not match the overloads
+        G = self.robot.getGravityForces([0,0,-9.8])
+        self.assertArrayEqual(self.robot.getGravityForcesArray([0,0,-9.8]),G)
+        self.assertArrayEqual(self.robot.getGravityForcesArray((0,0,-9.8)),G)
+        self.assertArrayEqual(self.robot.getGravityForcesArray(np.array([0,0,-9.8])),G)
+        out = np.zeros(self.n)
+        self.assertTrue(self.robot.getGravityForcesArray(np.array([0,0,-9.8]),out) is out)
+        self.assertArrayEqual(out,G)
+        self.assertRaises(Exception,self.robot.getGravityForcesArray,[0,-9.8])
+        self.assertRaises(Exception,self.robot.getGravityForcesArray,[0,0,0,-9.8])
+        self.assertRaises(Exception,self.robot.getGravityForcesArray,5.0)
+        link = self.robot.link(5)
+        self.assertArrayEqual(link.getPositionJacobianArray(np.array([0.1,0.2,0.3])),link.getPositionJacobian([0.1,0.2,0.3]))
+        self.assertRaises(Exception,link.getPositionJacobianArray,[0.1,0.2])
+
+    def test_jacobians(self):
+        link = self.robot.link(5)
+        p = [0.1,-0.2,0.3]
+        self.assertArrayEqual(link.getJacobianArray(p),link.getJacobian(p))
+        self.assertArrayEqual(link.getPositionJacobianArray(p),link.getPositionJacobian(p))
+        self.assertArrayEqual(link.getOrientationJacobianArray(),link.getOrientationJacobian())
+        self.assertArrayEqual(self.robot.getComJacobianArray(),self.robot.getComJacobian())
+
+    def test_dynamics(self):
+        self.assertArrayEqual(self.robot.getMassMatrixArray(),self.robot.getMassMatrix())
+        self.assertArrayEqual(self.robot.getMassMatrixInvArray(),self.robot.getMassMatrixInv())
+        self.assertArrayEqual(self.robot.getCoriolisForceMatrixArray(),self.robot.getCoriolisForceMatrix())
+        self.assertArrayEqual(self.robot.getCoriolisForcesArray(),self.robot.getCoriolisForces())
+        ddq = np.linspace(-1,1,self.n)
+        t = self.robot.torquesFromAccelArray(ddq)
+        self.assertArrayEqual(t,self.robot.torquesFromAccel(list(ddq)))
+        self.assertArrayEqual(self.robot.accelFromTorquesArray(t),self.robot.accelFromTorques(list(t)))
+        self.assertRaises(Exception,self.robot.torquesFromAccelArray,ddq[:-1])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,60 @@
+import unittest
+import gc
+import numpy as np
+from klampt import *
+
+class sensorArraysTest(unittest.TestCase):
+
+    def setUp(self):
+        self.world = WorldModel()
+        self.world.readFile('data/simulation_test_worlds/sensortest.xml')
+        self.sim = Simulator(self.world)
+        self.camera = self.sim.controller(0).sensor('rgbd_camera')
+        self.camera.setSetting('xres','32')
+        self.camera.setSetting('yres','16')
+        self.sim.simulate(0.01)
+
+    def test_names(self):
+        self.assertEqual(self.camera.measurementArrayNames(),['rgb','depth'])
+        self.assertEqual(self.sim.controller(0).sensor('lidar').measurementArrayNames(),['depth'])
+        self.assertEqual(self.sim.controller(0).sensor('encoders').measurementArrayNames(),['measurements'])
+        self.assertRaises(Exception,self.camera.getMeasurementArray,'nonexistent')
+
+    def test_matchesMeasurements(self):
+        rgb = self.camera.getMeasurementArray('rgb')
+        depth = self.camera.getMeasurementArray('depth')
+        self.assertEqual(rgb.shape,(16,32,3))
+        self.assertEqual(rgb.dtype,np.uint8)
+        self.assertEqual(depth.shape,(16,32))
+        self.assertEqual(depth.dtype,np.float32)
+        #the measurement list packs colors as 0xAABBGGRR
+        values = self.camera.getMeasurements()
+        abgr = np.array(values[0:16*32]).reshape(16,32).astype(np.uint32)
+        self.assertTrue(np.all(np.right_shift(abgr,24) == 0xff))
+        self.assertTrue(np.array_equal(rgb[:,:,0],np.bitwise_and(abgr,0xff)))
+        self.assertTrue(np.array_equal(rgb[:,:,1],np.bitwise_and(np.right_shift(abgr,8),0xff)))
+        self.assertTrue(np.array_equal(rgb[:,:,2],np.bitwise_and(np.right_shift(abgr,16),0xff)))
+        self.assertTrue(np.array_equal(depth.ravel(),np.array(values[16*32:],dtype=np.float32)))
+        encoders = self.sim.controller(0).sensor('encoders')
+        self.assertTrue(np.array_equal(encoders.getMeasurementArray('measurements'),encoders.getMeasurements()))
+
+    def test_readOnlyView(self):
+        a = self.camera.getMeasurementArray('depth')
+        b = self.camera.getMeasurementArray('depth')
+        self.assertFalse(a.flags.writeable)
+        def write():
+            a[0,0] = 1
+        self.assertRaises(ValueError,write)
+        #both arrays share the sensor's storage
+        self.assertEqual(a.__array_interface__['data'][0],b.__array_interface__['data'][0])
+
+    def test_sensorKeptAlive(self):
+        rgb = self.camera.getMeasurementArray('rgb')
+        saved = rgb.copy()
+        self.camera = None
+        self.sim = None
+        gc.collect()
+        self.assertTrue(np.array_equal(rgb,saved))
+
+if __name__ == '__main__':
+    unittest.main()